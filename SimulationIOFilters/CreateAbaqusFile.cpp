@@ -38,6 +38,7 @@
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/DataContainers/DataContainerArray.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
+#include "SIMPLib/FilterParameters/BooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
 #include "SIMPLib/FilterParameters/DynamicTableFilterParameter.h"
 #include "SIMPLib/FilterParameters/IntFilterParameter.h"
@@ -79,6 +80,8 @@ CreateAbaqusFile::CreateAbaqusFile()
 : p_Impl(std::make_unique<Impl>())
 , m_NumDepvar(1)
 , m_NumUserOutVar(1)
+, m_NumThreads(0)
+, m_MeanOrientations(false)
 , m_AbqFeatureIdsArrayPath(SIMPL::Defaults::ImageDataContainerName, SIMPL::Defaults::CellAttributeMatrixName, SIMPL::CellData::FeatureIds)
 , m_CellEulerAnglesArrayPath(SIMPL::Defaults::ImageDataContainerName, SIMPL::Defaults::CellAttributeMatrixName, SIMPL::CellData::EulerAngles)
 , m_CellPhasesArrayPath(SIMPL::Defaults::ImageDataContainerName, SIMPL::Defaults::CellAttributeMatrixName, SIMPL::CellData::Phases)
@@ -110,6 +113,8 @@ void CreateAbaqusFile::setupFilterParameters()
   parameters.push_back(SIMPL_NEW_STRING_FP("Job Name", JobName, FilterParameter::Category::Parameter, CreateAbaqusFile));
   parameters.push_back(SIMPL_NEW_INTEGER_FP("Number of Solution Dependent State Variables", NumDepvar, FilterParameter::Category::Parameter, CreateAbaqusFile));
   parameters.push_back(SIMPL_NEW_INTEGER_FP("Number of User Output Variables", NumUserOutVar, FilterParameter::Category::Parameter, CreateAbaqusFile));
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Number of Writer Threads (0 = All Cores)", NumThreads, FilterParameter::Category::Parameter, CreateAbaqusFile));
+  parameters.push_back(SIMPL_NEW_BOOL_FP("Use Mean Grain Orientations", MeanOrientations, FilterParameter::Category::Parameter, CreateAbaqusFile));
 
   // Table - Dynamic rows and fixed columns
   {
@@ -149,6 +154,8 @@ void CreateAbaqusFile::readFilterParameters(AbstractFilterParametersReader* read
   setJobName(reader->readString("JobName", getJobName()));
   setNumDepvar(reader->readValue("NumDepvar", getNumDepvar()));
   setNumUserOutVar(reader->readValue("NumUserOutVar", getNumUserOutVar()));
+  setNumThreads(reader->readValue("NumThreads", getNumThreads()));
+  setMeanOrientations(reader->readValue("MeanOrientations", getMeanOrientations()));
   setMatConst(reader->readDynamicTableData("MatConst", getMatConst()));
   setAbqFeatureIdsArrayPath(reader->readDataArrayPath("AbqFeatureIdsArrayPath", getAbqFeatureIdsArrayPath()));
   setCellEulerAnglesArrayPath(reader->readDataArrayPath("CellEulerAnglesArrayPath", getCellEulerAnglesArrayPath()));
@@ -170,6 +177,12 @@ void CreateAbaqusFile::dataCheck()
     setErrorCondition(-12001, ss);
   }
 
+  if(m_NumThreads < 0)
+  {
+    QString ss = QObject::tr("The number of writer threads must be 0 (all cores) or greater");
+    setErrorCondition(-12002, ss);
+  }
+
   QDir dir(m_OutputPath);
   if(!dir.exists())
   {
@@ -269,7 +282,8 @@ void CreateAbaqusFile::execute()
     return;
   }
 
-  if(!AbaqusFileWriter::write(this, *imageGeom, *featureIds, *cellPhases, *cellEulerAngles, m_MatConst, m_OutputPath, m_OutputFilePrefix, m_JobName, m_NumDepvar, m_NumUserOutVar))
+  if(!AbaqusFileWriter::write(this, *imageGeom, *featureIds, *cellPhases, *cellEulerAngles, m_MatConst, m_OutputPath, m_OutputFilePrefix, m_JobName, m_NumDepvar, m_NumUserOutVar, m_NumThreads,
+                               m_MeanOrientations ? FeatureAggregator::Orientation::Mean : FeatureAggregator::Orientation::LastVoxel))
   {
     QString ss = QObject::tr("Error writing file at '%1'").arg(m_OutputPath);
     setErrorCondition(-10207, ss);
@@ -420,6 +434,30 @@ int CreateAbaqusFile::getNumUserOutVar() const
   return m_NumUserOutVar;
 }
 
+// -----------------------------------------------------------------------------
+void CreateAbaqusFile::setNumThreads(int value)
+{
+  m_NumThreads = value;
+}
+
+// -----------------------------------------------------------------------------
+int CreateAbaqusFile::getNumThreads() const
+{
+  return m_NumThreads;
+}
+
+// -----------------------------------------------------------------------------
+void CreateAbaqusFile::setMeanOrientations(bool value)
+{
+  m_MeanOrientations = value;
+}
+
+// -----------------------------------------------------------------------------
+bool CreateAbaqusFile::getMeanOrientations() const
+{
+  return m_MeanOrientations;
+}
+
 // -----------------------------------------------------------------------------
 void CreateAbaqusFile::setMatConst(const DynamicTableData& value)
 {
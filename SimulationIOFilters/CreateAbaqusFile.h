@@ -58,6 +58,8 @@ class SimulationIO_EXPORT CreateAbaqusFile : public AbstractFilter
   PYB11_PROPERTY(QString JobName READ getJobName WRITE setJobName)
   PYB11_PROPERTY(int NumDepvar READ getNumDepvar WRITE setNumDepvar)
   PYB11_PROPERTY(int NumUserOutVar READ getNumUserOutVar WRITE setNumUserOutVar)
+  PYB11_PROPERTY(int NumThreads READ getNumThreads WRITE setNumThreads)
+  PYB11_PROPERTY(bool MeanOrientations READ getMeanOrientations WRITE setMeanOrientations)
   PYB11_PROPERTY(DynamicTableData MatConst READ getMatConst WRITE setMatConst)
   PYB11_PROPERTY(DataArrayPath AbqFeatureIdsArrayPath READ getAbqFeatureIdsArrayPath WRITE setAbqFeatureIdsArrayPath)
   PYB11_PROPERTY(DataArrayPath CellEulerAnglesArrayPath READ getCellEulerAnglesArrayPath WRITE setCellEulerAnglesArrayPath)
@@ -152,6 +154,32 @@ public:
   void setNumUserOutVar(int value);
   Q_PROPERTY(int NumUserOutVar READ getNumUserOutVar WRITE setNumUserOutVar)
 
+  /**
+   * @brief Getter property for NumThreads
+   * @return
+   */
+  int getNumThreads() const;
+
+  /**
+   * @brief Setter property for NumThreads
+   * @param value
+   */
+  void setNumThreads(int value);
+  Q_PROPERTY(int NumThreads READ getNumThreads WRITE setNumThreads)
+
+  /**
+   * @brief Getter property for MeanOrientations
+   * @return
+   */
+  bool getMeanOrientations() const;
+
+  /**
+   * @brief Setter property for MeanOrientations
+   * @param value
+   */
+  void setMeanOrientations(bool value);
+  Q_PROPERTY(bool MeanOrientations READ getMeanOrientations WRITE setMeanOrientations)
+
   /**
    * @brief Getter property for MatConst
    * @return
@@ -287,6 +315,8 @@ private:
   QString m_JobName;
   int m_NumDepvar;
   int m_NumUserOutVar;
+  int m_NumThreads;
+  bool m_MeanOrientations;
   DynamicTableData m_MatConst;
   DataArrayPath m_AbqFeatureIdsArrayPath;
   DataArrayPath m_CellEulerAnglesArrayPath;
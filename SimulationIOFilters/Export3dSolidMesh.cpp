@@ -44,6 +44,12 @@
 #include "SimulationIO/SimulationIOConstants.h"
 #include "SimulationIO/SimulationIOVersion.h"
 
+#include "SimulationIO/SimulationIOFilters/Utility/NetgenVolMerger.h"
+#include "SimulationIO/SimulationIOFilters/Utility/ProcessPool.h"
+#include "SimulationIO/SimulationIOFilters/Utility/FeatureStlWriter.h"
+#include "SimulationIO/SimulationIOFilters/Utility/GmshMesher.h"
+#include "SimulationIO/SimulationIOFilters/Utility/TetGenMesher.h"
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -101,6 +107,7 @@ void Export3dSolidMesh::setupFilterParameters()
                                         "GmshSTLFileName",
                                         "NetgenSTLFileName",
                                         "MeshSize",
+                                        "NumProcesses",
                                         "MeshFileFormat"};
     parameter->setLinkedProperties(linkedProps);
     parameter->setEditable(false);
@@ -109,6 +116,11 @@ void Export3dSolidMesh::setupFilterParameters()
     linkedProps.clear();
   }
 
+  // With the Gmsh library linked in, Gmsh meshes the surface mesh in process and creates the same output as TetGen
+  const std::vector<int32_t> tetOutputGroups = GmshMesher::isAvailable() ? std::vector<int32_t>{0, 2} : std::vector<int32_t>{0};
+  // Netgen reads STL files the filter writes from the surface mesh
+  const std::vector<int32_t> faceLabelGroups = GmshMesher::isAvailable() ? std::vector<int32_t>{0, 1, 2} : std::vector<int32_t>{0, 1};
+
   parameters.push_back(SIMPL_NEW_OUTPUT_PATH_FP("Path", outputPath, FilterParameter::Category::Parameter, Export3dSolidMesh));
   parameters.push_back(SIMPL_NEW_OUTPUT_PATH_FP("Package Location", PackageLocation, FilterParameter::Category::Parameter, Export3dSolidMesh));
 
@@ -123,7 +135,7 @@ void Export3dSolidMesh::setupFilterParameters()
   parameters.push_back(SeparatorFilterParameter::Create("Face Data", FilterParameter::Category::RequiredArray));
   {
     DataArraySelectionFilterParameter::RequirementType req = DataArraySelectionFilterParameter::CreateRequirement(SIMPL::TypeNames::Int32, 2, AttributeMatrix::Type::Face, IGeometry::Type::Triangle);
-    parameters.push_back(SIMPL_NEW_DA_SELECTION_FP("Face Labels", SurfaceMeshFaceLabelsArrayPath, FilterParameter::Category::RequiredArray, Export3dSolidMesh, req, {0}));
+    parameters.push_back(SIMPL_NEW_DA_SELECTION_FP("Face Labels", SurfaceMeshFaceLabelsArrayPath, FilterParameter::Category::RequiredArray, Export3dSolidMesh, req, faceLabelGroups));
   }
 
   parameters.push_back(SeparatorFilterParameter::Create("Feature Data", FilterParameter::Category::RequiredArray));
@@ -135,7 +147,7 @@ void Export3dSolidMesh::setupFilterParameters()
   {
     DataArraySelectionFilterParameter::RequirementType req =
         DataArraySelectionFilterParameter::CreateRequirement(SIMPL::TypeNames::Int32, 1, AttributeMatrix::Type::CellFeature, IGeometry::Type::Image);
-    parameters.push_back(SIMPL_NEW_DA_SELECTION_FP("Phases", FeaturePhasesArrayPath, FilterParameter::Category::RequiredArray, Export3dSolidMesh, req, {0}));
+    parameters.push_back(SIMPL_NEW_DA_SELECTION_FP("Phases", FeaturePhasesArrayPath, FilterParameter::Category::RequiredArray, Export3dSolidMesh, req, tetOutputGroups));
   }
   {
     DataArraySelectionFilterParameter::RequirementType req =
@@ -186,6 +198,14 @@ void Export3dSolidMesh::setupFilterParameters()
     parameter->setCategory(FilterParameter::Category::Parameter);
     parameters.push_back(parameter);
   }
+  if(GmshMesher::isAvailable())
+  {
+    parameters.push_back(SIMPL_NEW_INTEGER_FP("Number of Netgen Processes or Gmsh Threads (0 = All Cores)", NumProcesses, FilterParameter::Category::Parameter, Export3dSolidMesh, {1, 2}));
+  }
+  else
+  {
+    parameters.push_back(SIMPL_NEW_INTEGER_FP("Number of Concurrent Netgen Processes (0 = All Cores)", NumProcesses, FilterParameter::Category::Parameter, Export3dSolidMesh, {1}));
+  }
 
   {
     parameters.push_back(SeparatorFilterParameter::Create("Topology Options", FilterParameter::Category::Parameter));
@@ -205,9 +225,9 @@ void Export3dSolidMesh::setupFilterParameters()
 
   {
     parameters.push_back(SeparatorFilterParameter::Create("", FilterParameter::Category::CreatedArray));
-    parameters.push_back(SIMPL_NEW_STRING_FP("Data Container Name", TetDataContainerName, FilterParameter::Category::CreatedArray, Export3dSolidMesh, {0}));
-    parameters.push_back(SIMPL_NEW_STRING_FP("Vertex Attribute Matrix Name", VertexAttributeMatrixName, FilterParameter::Category::CreatedArray, Export3dSolidMesh, {0}));
-    parameters.push_back(SIMPL_NEW_STRING_FP("Cell Attribute Matrix Name", CellAttributeMatrixName, FilterParameter::Category::CreatedArray, Export3dSolidMesh, {0}));
+    parameters.push_back(SIMPL_NEW_STRING_FP("Data Container Name", TetDataContainerName, FilterParameter::Category::CreatedArray, Export3dSolidMesh, tetOutputGroups));
+    parameters.push_back(SIMPL_NEW_STRING_FP("Vertex Attribute Matrix Name", VertexAttributeMatrixName, FilterParameter::Category::CreatedArray, Export3dSolidMesh, tetOutputGroups));
+    parameters.push_back(SIMPL_NEW_STRING_FP("Cell Attribute Matrix Name", CellAttributeMatrixName, FilterParameter::Category::CreatedArray, Export3dSolidMesh, tetOutputGroups));
   }
 
   setFilterParameters(parameters);
@@ -231,6 +251,7 @@ void Export3dSolidMesh::readFilterParameters(AbstractFilterParametersReader* rea
   setCellAttributeMatrixName(reader->readString("CellAttributeMatrixName", getCellAttributeMatrixName()));
   setNetgenSTLFileName(reader->readString("NetgenSTLFileName", getNetgenSTLFileName()));
   setMeshSize(reader->readValue("MeshSize", getMeshSize()));
+  setNumProcesses(reader->readValue("NumProcesses", getNumProcesses()));
   setGmshSTLFileName(reader->readString("GmshSTLFileName", getGmshSTLFileName()));
   setMeshFileFormat(reader->readValue("MeshFileFormat", getMeshFileFormat()));
   reader->closeFilterGroup();
@@ -251,8 +272,9 @@ void Export3dSolidMesh::dataCheck()
   {
   case 0: // TetGen
   {
+    // With the TetGen library linked in the executable is not needed
     QFileInfo fi(m_PackageLocation);
-    if(!fi.exists())
+    if(!TetGenMesher::isAvailable() && !fi.exists())
     {
       setErrorCondition(56, "TetGen Executable Package Location does not exist on the file system.");
       return;
@@ -320,37 +342,28 @@ void Export3dSolidMesh::dataCheck()
 
     getDataContainerArray()->validateNumberOfTuples(this, dataArrayPaths);
 
-    // Create the output Data Container
-    DataContainer::Pointer m = getDataContainerArray()->createNonPrereqDataContainer(this, getTetDataContainerName());
-    if(getErrorCode() < 0)
-    {
-      return;
-    }
-
-    // Create our output Vertex and Cell Matrix objects
-    std::vector<size_t> tDims(1, 0);
-    AttributeMatrix::Pointer vertexAttrMat = m->createNonPrereqAttributeMatrix(this, getVertexAttributeMatrixName(), tDims, AttributeMatrix::Type::Vertex);
-    if(getErrorCode() < 0)
-    {
-      return;
-    }
-    AttributeMatrix::Pointer cellAttrMat = m->createNonPrereqAttributeMatrix(this, getCellAttributeMatrixName(), tDims, AttributeMatrix::Type::Cell);
-    if(getErrorCode() < 0)
-    {
-      return;
-    }
-
-    SharedVertexList::Pointer tetvertexPtr = TetrahedralGeom::CreateSharedVertexList(0);
-    TetrahedralGeom::Pointer tetGeomPtr = TetrahedralGeom::CreateGeometry(0, tetvertexPtr, SIMPL::Geometry::TetrahedralGeometry, !getInPreflight());
-    m->setGeometry(tetGeomPtr);
+    createTetDataContainer();
 
     break;
   }
 
   case 1:
   {
+    if(getNumProcesses() < 0)
+    {
+      QString ss = QObject::tr("The number of concurrent Netgen processes must be 0 (all cores) or greater");
+      setErrorCondition(-4011, ss);
+    }
+
     QVector<DataArrayPath> dataArrayPaths;
     std::vector<size_t> cDims(1, 1);
+    cDims[0] = 2;
+    m_SurfaceMeshFaceLabelsPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<int32_t>>(this, getSurfaceMeshFaceLabelsArrayPath(), cDims);
+    if(nullptr != m_SurfaceMeshFaceLabelsPtr.lock())
+    {
+      m_SurfaceMeshFaceLabels = m_SurfaceMeshFaceLabelsPtr.lock()->getPointer(0);
+    } /* Now assign the raw pointer to data from the DataArray<T> object */
+
     cDims[0] = 3;
     m_FeatureEulerAnglesPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<float>>(this, getFeatureEulerAnglesArrayPath(), cDims);
     if(nullptr != m_FeatureEulerAnglesPtr.lock())
@@ -379,6 +392,40 @@ void Export3dSolidMesh::dataCheck()
       dataArrayPaths.push_back(getFeatureEulerAnglesArrayPath());
     }
 
+    if(!GmshMesher::isAvailable())
+    {
+      break;
+    }
+
+    // The Gmsh library meshes the surface mesh directly instead of the per feature STL files
+    if(getNumProcesses() < 0)
+    {
+      QString ss = QObject::tr("The number of Gmsh threads must be 0 (all cores) or greater");
+      setErrorCondition(-4011, ss);
+    }
+
+    cDims[0] = 2;
+    m_SurfaceMeshFaceLabelsPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<int32_t>>(this, getSurfaceMeshFaceLabelsArrayPath(), cDims);
+    if(nullptr != m_SurfaceMeshFaceLabelsPtr.lock())
+    {
+      m_SurfaceMeshFaceLabels = m_SurfaceMeshFaceLabelsPtr.lock()->getPointer(0);
+    } /* Now assign the raw pointer to data from the DataArray<T> object */
+
+    cDims[0] = 1;
+    m_FeaturePhasesPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<int32_t>>(this, getFeaturePhasesArrayPath(), cDims);
+    if(nullptr != m_FeaturePhasesPtr.lock())
+    {
+      m_FeaturePhases = m_FeaturePhasesPtr.lock()->getPointer(0);
+    } /* Now assign the raw pointer to data from the DataArray<T> object */
+    if(getErrorCode() >= 0)
+    {
+      dataArrayPaths.push_back(getFeaturePhasesArrayPath());
+    }
+
+    getDataContainerArray()->validateNumberOfTuples(this, dataArrayPaths);
+
+    createTetDataContainer();
+
     break;
   }
   }
@@ -419,6 +466,33 @@ void Export3dSolidMesh::execute()
 
     size_t numfeatures = m_FeatureEulerAnglesPtr.lock()->getNumberOfTuples();
 
+    DataContainer::Pointer m = getDataContainerArray()->getDataContainer(getTetDataContainerName());
+    AttributeMatrix::Pointer vertexAttrMat = m->getAttributeMatrix(getVertexAttributeMatrixName());
+    AttributeMatrix::Pointer cellAttrMat = m->getAttributeMatrix(getCellAttributeMatrixName());
+
+    if(TetGenMesher::isAvailable())
+    {
+      // Mesh in process: the surface mesh goes to TetGen and the tetrahedra come back without any files
+      std::vector<float> holes;
+      std::vector<float> regions;
+      createTetgenRegions(numfeatures, m_FeatureCentroid, holes, regions);
+
+      std::vector<int32_t> tetRegions;
+      if(TetGenMesher::tetrahedralize(this, *triangleGeom, holes, regions, createTetgenSwitches(), *m->getGeometryAs<TetrahedralGeom>(), *vertexAttrMat, *cellAttrMat, tetRegions))
+      {
+        TetGenFileReader::FeatureData featureData = createTetCellData(cellAttrMat.get(), tetRegions.size());
+        for(size_t i = 0; i < tetRegions.size(); i++)
+        {
+          if(!featureData.assign(i, tetRegions[i]))
+          {
+            setErrorCondition(-4021, QObject::tr("TetGen assigned tetrahedron %1 to feature %2, which does not exist").arg(i).arg(tetRegions[i]));
+            break;
+          }
+        }
+      }
+      break;
+    }
+
     // creating TetGen input file
     QString tetgenInpFile = m_outputPath + QDir::separator() + "tetgenInp.smesh";
 
@@ -427,10 +501,6 @@ void Export3dSolidMesh::execute()
     // running TetGen
     runPackage(tetgenInpFile, tetgenInpFile);
 
-    DataContainer::Pointer m = getDataContainerArray()->getDataContainer(getTetDataContainerName());
-    AttributeMatrix::Pointer vertexAttrMat = m->getAttributeMatrix(getVertexAttributeMatrixName());
-    AttributeMatrix::Pointer cellAttrMat = m->getAttributeMatrix(getCellAttributeMatrixName());
-
     QString tetgenEleFile = m_outputPath + QDir::separator() + "tetgenInp.1.ele";
     QString tetgenNodeFile = m_outputPath + QDir::separator() + "tetgenInp.1.node";
     scanTetGenFile(tetgenEleFile, tetgenNodeFile, m.get(), vertexAttrMat.get(), cellAttrMat.get());
@@ -444,50 +514,32 @@ void Export3dSolidMesh::execute()
     QString netgenMeshFile;
     QString mergedMesh = m_NetgenSTLFileName + "MergedMesh.vol";
     QString workPath = m_outputPath;
-    QString asciiSTLFile;
-    QString binSTLFile;
 
-    for(size_t i = 1; i < numfeatures; i++)
+    // The binary STL file of every feature is written straight from the surface mesh
+    DataContainer::Pointer sm = getDataContainerArray()->getDataContainer(getSurfaceMeshFaceLabelsArrayPath().getDataContainerName());
+    TriangleGeom::Pointer triangleGeom = sm->getGeometryAs<TriangleGeom>();
+    auto featureSTLFile = [this, &workPath](size_t feature) { return QDir(workPath).filePath(m_NetgenSTLFileName + QString("Feature_") + QString::number(feature) + ".stlb"); };
+    if(FeatureStlWriter::writeBinary(this, *triangleGeom, m_SurfaceMeshFaceLabels, numfeatures, featureSTLFile, getNumProcesses()))
     {
-      asciiSTLFile = m_NetgenSTLFileName + QString("Feature_") + QString::number(i) + ".stl";
-      binSTLFile = m_NetgenSTLFileName + QString("Feature_") + QString::number(i) + ".stlb";
-
-      QDir::setCurrent(workPath);
-      QFile::copy(asciiSTLFile, binSTLFile);
+      // Mesh the features in concurrent Netgen processes
+      meshFeatures(numfeatures);
     }
 
-    for(size_t i = 1; i < numfeatures; i++)
+    if(getErrorCode() >= 0 && !getCancel())
     {
-
-      binSTLFile = m_NetgenSTLFileName + QString("Feature_") + QString::number(i) + ".stlb";
-      netgenMeshFile = m_NetgenSTLFileName + QString("Feature_") + QString::number(i) + ".vol";
-
-      // running Netgen
-      runPackage(binSTLFile, netgenMeshFile);
-    }
-
-    netgenMeshFile = m_NetgenSTLFileName + QString("Feature_") + QString::number(1) + ".vol";
-    QDir::setCurrent(workPath);
-    QFile::copy(netgenMeshFile, mergedMesh);
-
-    if(numfeatures > 2)
-    {
-      for(size_t i = 2; i < numfeatures; i++)
+      // All feature meshes are merged in one pass instead of one Netgen run per feature
+      QStringList netgenMeshFiles;
+      for(size_t i = 1; i < numfeatures; i++)
       {
-
         netgenMeshFile = m_NetgenSTLFileName + QString("Feature_") + QString::number(i) + ".vol";
-
-        // running Netgen
-        mergeMesh(mergedMesh, netgenMeshFile);
+        netgenMeshFiles << QDir(workPath).filePath(netgenMeshFile);
       }
+      NetgenVolMerger::merge(this, netgenMeshFiles, QDir(workPath).filePath(mergedMesh), getNumProcesses());
     }
 
     for(size_t i = 1; i < numfeatures; i++)
     {
-      binSTLFile = m_NetgenSTLFileName + QString("Feature_") + QString::number(i) + ".stlb";
-
-      QDir::setCurrent(workPath);
-      QFile::remove(binSTLFile);
+      QFile::remove(featureSTLFile(i));
     }
 
     break;
@@ -496,6 +548,33 @@ void Export3dSolidMesh::execute()
   {
 
     size_t numfeatures = m_FeatureEulerAnglesPtr.lock()->getNumberOfTuples();
+
+    if(GmshMesher::isAvailable())
+    {
+      // Mesh in process: the triangles between each pair of features go to Gmsh and the tetrahedra come back without any files
+      DataContainer::Pointer sm = getDataContainerArray()->getDataContainer(getSurfaceMeshFaceLabelsArrayPath().getDataContainerName());
+      TriangleGeom::Pointer triangleGeom = sm->getGeometryAs<TriangleGeom>();
+
+      DataContainer::Pointer m = getDataContainerArray()->getDataContainer(getTetDataContainerName());
+      AttributeMatrix::Pointer vertexAttrMat = m->getAttributeMatrix(getVertexAttributeMatrixName());
+      AttributeMatrix::Pointer cellAttrMat = m->getAttributeMatrix(getCellAttributeMatrixName());
+
+      std::vector<int32_t> tetFeatures;
+      if(GmshMesher::tetrahedralize(this, *triangleGeom, m_SurfaceMeshFaceLabels, numfeatures, getNumProcesses(), *m->getGeometryAs<TetrahedralGeom>(), *vertexAttrMat, *cellAttrMat, tetFeatures))
+      {
+        TetGenFileReader::FeatureData featureData = createTetCellData(cellAttrMat.get(), tetFeatures.size());
+        for(size_t i = 0; i < tetFeatures.size(); i++)
+        {
+          if(!featureData.assign(i, tetFeatures[i]))
+          {
+            setErrorCondition(-4021, QObject::tr("Gmsh assigned tetrahedron %1 to feature %2, which does not exist").arg(i).arg(tetFeatures[i]));
+            break;
+          }
+        }
+      }
+      break;
+    }
+
     // creating Gmsh .geo file
     QString gmshGeoFile = m_outputPath + QDir::separator() + "gmsh.geo";
     QString STLFileNamewExt;
@@ -542,6 +621,36 @@ void Export3dSolidMesh::execute()
   }
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void Export3dSolidMesh::createTetDataContainer()
+{
+  // Create the output Data Container
+  DataContainer::Pointer m = getDataContainerArray()->createNonPrereqDataContainer(this, getTetDataContainerName());
+  if(getErrorCode() < 0)
+  {
+    return;
+  }
+
+  // Create our output Vertex and Cell Matrix objects
+  std::vector<size_t> tDims(1, 0);
+  AttributeMatrix::Pointer vertexAttrMat = m->createNonPrereqAttributeMatrix(this, getVertexAttributeMatrixName(), tDims, AttributeMatrix::Type::Vertex);
+  if(getErrorCode() < 0)
+  {
+    return;
+  }
+  AttributeMatrix::Pointer cellAttrMat = m->createNonPrereqAttributeMatrix(this, getCellAttributeMatrixName(), tDims, AttributeMatrix::Type::Cell);
+  if(getErrorCode() < 0)
+  {
+    return;
+  }
+
+  SharedVertexList::Pointer tetvertexPtr = TetrahedralGeom::CreateSharedVertexList(0);
+  TetrahedralGeom::Pointer tetGeomPtr = TetrahedralGeom::CreateGeometry(0, tetvertexPtr, SIMPL::Geometry::TetrahedralGeometry, !getInPreflight());
+  m->setGeometry(tetGeomPtr);
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -609,6 +718,55 @@ void Export3dSolidMesh::createTetgenInpFile(const QString& file, MeshIndexType n
   fclose(f1);
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void Export3dSolidMesh::createTetgenRegions(size_t numfeatures, const float* centroid, std::vector<float>& holes, std::vector<float>& regions) const
+{
+  // The same holes and regions the .smesh file lists: a hole at the centroid of every feature of the hole phase and
+  // a region with the feature id as its attribute at the centroid of every feature
+  holes.clear();
+  if(m_IncludeHolesUsingPhaseID)
+  {
+    for(size_t i = 1; i < numfeatures; i++)
+    {
+      if(m_FeaturePhases[i] == m_PhaseID)
+      {
+        holes.insert(holes.end(), centroid + i * 3, centroid + i * 3 + 3);
+      }
+    }
+  }
+
+  regions.clear();
+  regions.reserve(numfeatures * 4);
+  for(size_t i = 1; i < numfeatures; i++)
+  {
+    regions.insert(regions.end(), centroid + i * 3, centroid + i * 3 + 3);
+    regions.push_back(static_cast<float>(i));
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString Export3dSolidMesh::createTetgenSwitches() const
+{
+  QString switches = "pYAO" + QString::number(m_OptimizationLevel);
+
+  if(m_RefineMesh)
+  {
+    QString tmp = "q" + QString::number(m_MaxRadiusEdgeRatio) + "/" + QString::number(m_MinDihedralAngle);
+    switches += tmp;
+  }
+
+  if(m_LimitTetrahedraVolume)
+  {
+    QString tmp = "a" + QString::number(m_MaxTetrahedraVolume);
+    switches += tmp;
+  }
+  return switches;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -627,19 +785,7 @@ void Export3dSolidMesh::runPackage(const QString& file, const QString& meshFile)
   {
     // cmd to run: "tetgen -pYAqOa file
 
-    switches = "-pYAO" + QString::number(m_OptimizationLevel);
-
-    if(m_RefineMesh)
-    {
-      QString tmp = "q" + QString::number(m_MaxRadiusEdgeRatio) + "/" + QString::number(m_MinDihedralAngle);
-      switches += tmp;
-    }
-
-    if(m_LimitTetrahedraVolume)
-    {
-      QString tmp = "a" + QString::number(m_MaxTetrahedraVolume);
-      switches += tmp;
-    }
+    switches = "-" + createTetgenSwitches();
 
     program += "tetgen";
 #ifdef Q_OS_WIN
@@ -652,40 +798,11 @@ void Export3dSolidMesh::runPackage(const QString& file, const QString& meshFile)
   case 1:
   {
 
-    // cmd to run: "netgen file.stlb -batchmode -verycoarse/coarse/moderate/fine/veryfine -meshfile=output filename
-
-    switches = "-";
-    if(m_MeshSize == 0)
-    {
-      switches += "verycoarse";
-    }
-    else if(m_MeshSize == 1)
-    {
-      switches += "coarse";
-    }
-    else if(m_MeshSize == 2)
-    {
-      switches += "moderate";
-    }
-    else if(m_MeshSize == 3)
-    {
-      switches += "fine";
-    }
-    else if(m_MeshSize == 4)
-    {
-      switches += "veryfine";
-    }
-
     program += "netgen";
 #ifdef Q_OS_WIN
     program += ".exe";
 #endif
-    QString switchMeshFile;
-
-    switchMeshFile = "-meshfile=";
-    switchMeshFile += meshFile;
-
-    arguments << file << "-batchmode" << switchMeshFile << "-V" << switches;
+    arguments = createNetgenArguments(file, meshFile);
 
     break;
   }
@@ -719,26 +836,7 @@ void Export3dSolidMesh::runPackage(const QString& file, const QString& meshFile)
 
   m_ProcessPtr = QSharedPointer<QProcess>(new QProcess(nullptr));
 
-  QProcessEnvironment env = QProcessEnvironment::systemEnvironment();
-
-#if defined(Q_OS_MAC)
-  if(m_MeshingPackage == 1)
-  {
-    QString env_PYTHONPATH = m_PackageLocation + QDir::separator() + QString("..") + QDir::separator() + QString("Resources") + QDir::separator() + QString("lib") + QDir::separator() +
-                             QString("python3.7") + QDir::separator() + QString("site-packages");
-    QString env_NETGENDIR = m_PackageLocation;
-    QString env_DYLD_LIBRARYPATH = m_PackageLocation;
-
-    env.insert("PYTHONPATH", env_PYTHONPATH);
-    env.insert("NETGENDIR", env_NETGENDIR);
-    env.insert("DYLD_LIBRARY_PATH", env_DYLD_LIBRARYPATH);
-
-    //      env.insert("PYTHONPATH", "/Applications/Netgen.app/Contents/Resources/lib/python3.7/site-packages:.");
-    //  env.insert("NETGENDIR", "/Applications/Netgen.app/Contents/MacOS");
-    // env.insert("DYLD_LIBRARY_PATH", "/Applications/Netgen.app/Contents/MacOS");
-    // env.insert("PATH", "$NETGENDIR:$PATH");
-  }
-#endif
+  QProcessEnvironment env = createPackageEnvironment();
   m_ProcessPtr->setProcessEnvironment(env);
 
   qRegisterMetaType<QProcess::ExitStatus>("QProcess::ExitStatus");
@@ -759,65 +857,125 @@ void Export3dSolidMesh::runPackage(const QString& file, const QString& meshFile)
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void Export3dSolidMesh::mergeMesh(const QString& mergeFile, const QString& meshFile)
+void Export3dSolidMesh::meshFeatures(size_t numfeatures)
 {
+  QString program = m_PackageLocation + QDir::separator() + "netgen";
+#ifdef Q_OS_WIN
+  program += ".exe";
+#endif
+  QProcessEnvironment env = createPackageEnvironment();
 
-  QString program;
-  QStringList arguments;
-
-  QString switch1;
-  switch1 = "-inputmeshfile=";
-  switch1 += mergeFile;
-
-  QString switch2;
-  switch2 = "-mergefile=";
-  switch2 += meshFile;
-
-  QString switch3;
-  switch3 = "-meshfile=";
-  switch3 += mergeFile;
-
-  program = m_PackageLocation + QDir::separator() + "netgen";
+  // Every feature is meshed from its own STL file into its own volume mesh, so the processes are independent
+  std::vector<ProcessPool::Job> jobs;
+  for(size_t i = 1; i < numfeatures; i++)
+  {
+    QString binSTLFile = m_NetgenSTLFileName + QString("Feature_") + QString::number(i) + ".stlb";
+    QString netgenMeshFile = m_NetgenSTLFileName + QString("Feature_") + QString::number(i) + ".vol";
+
+    ProcessPool::Job job;
+    job.program = program;
+    job.arguments = createNetgenArguments(binSTLFile, netgenMeshFile);
+    job.workingDirectory = m_outputPath;
+    job.environment = env;
+    jobs.push_back(job);
+  }
 
-  // cmd to run: netgen -inputmeshfile=m.vol -mergefile=c.vol -batchmode -meshfile=m.vol
+  std::vector<ProcessPool::Result> results = ProcessPool::run(
+      jobs, getNumProcesses(),
+      [this](size_t job, const QString& output) {
+        QString text = output.trimmed();
+        if(!text.isEmpty())
+        {
+          notifyStatusMessage(QObject::tr("Feature %1: %2").arg(job + 1).arg(text));
+        }
+      },
+      [this, &jobs](size_t numEnded) { notifyStatusMessage(QObject::tr("Meshed %1/%2 features").arg(numEnded).arg(jobs.size())); }, [this]() { return getCancel(); });
 
-  arguments << "-batchmode" << switch1 << switch2 << switch3 << "-V";
+  if(getCancel())
+  {
+    return;
+  }
 
-  m_ProcessPtr = QSharedPointer<QProcess>(new QProcess(nullptr));
+  QStringList failures;
+  for(size_t i = 0; i < results.size(); i++)
+  {
+    if(results[i].status != ProcessPool::Status::Succeeded)
+    {
+      failures << QObject::tr("Feature %1 (%2)").arg(i + 1).arg(ProcessPool::describe(results[i]));
+    }
+  }
+  if(!failures.isEmpty())
+  {
+    const int k_MaxListed = 10;
+    QString list = QStringList(failures.mid(0, k_MaxListed)).join(", ");
+    if(failures.size() > k_MaxListed)
+    {
+      list += ", ...";
+    }
+    QString ss = QObject::tr("Netgen failed to mesh %1 of %2 features: %3").arg(failures.size()).arg(jobs.size()).arg(list);
+    setErrorCondition(-4012, ss);
+  }
+}
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QProcessEnvironment Export3dSolidMesh::createPackageEnvironment() const
+{
   QProcessEnvironment env = QProcessEnvironment::systemEnvironment();
 
 #if defined(Q_OS_MAC)
-  QString env_PYTHONPATH = m_PackageLocation + QDir::separator() + QString("..") + QDir::separator() + QString("Resources") + QDir::separator() + QString("lib") + QDir::separator() +
-                           QString("python3.7") + QDir::separator() + QString("site-packages");
-  QString env_NETGENDIR = m_PackageLocation;
-  QString env_DYLD_LIBRARYPATH = m_PackageLocation;
-
-  env.insert("PYTHONPATH", env_PYTHONPATH);
-  env.insert("NETGENDIR", env_NETGENDIR);
-  env.insert("DYLD_LIBRARY_PATH", env_DYLD_LIBRARYPATH);
-#endif
+  if(m_MeshingPackage == 1)
+  {
+    QString env_PYTHONPATH = m_PackageLocation + QDir::separator() + QString("..") + QDir::separator() + QString("Resources") + QDir::separator() + QString("lib") + QDir::separator() +
+                             QString("python3.7") + QDir::separator() + QString("site-packages");
+    QString env_NETGENDIR = m_PackageLocation;
+    QString env_DYLD_LIBRARYPATH = m_PackageLocation;
 
-  // env.insert("PYTHONPATH", "/Applications/Netgen.app/Contents/Resources/lib/python3.7/site-packages:.");
-  // env.insert("NETGENDIR", "/Applications/Netgen.app/Contents/MacOS");
-  // env.insert("DYLD_LIBRARY_PATH", "/Applications/Netgen.app/Contents/MacOS");
-  // env.insert("PATH", "$NETGENDIR:$PATH");
+    env.insert("PYTHONPATH", env_PYTHONPATH);
+    env.insert("NETGENDIR", env_NETGENDIR);
+    env.insert("DYLD_LIBRARY_PATH", env_DYLD_LIBRARYPATH);
+  }
+#endif
+  return env;
+}
 
-  m_ProcessPtr->setProcessEnvironment(env);
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QStringList Export3dSolidMesh::createNetgenArguments(const QString& file, const QString& meshFile) const
+{
+  // cmd to run: "netgen file.stlb -batchmode -verycoarse/coarse/moderate/fine/veryfine -meshfile=output filename
 
-  qRegisterMetaType<QProcess::ExitStatus>("QProcess::ExitStatus");
-  qRegisterMetaType<QProcess::ProcessError>("QProcess::ProcessError");
-  connect(m_ProcessPtr.data(), SIGNAL(finished(int, QProcess::ExitStatus)), this, SLOT(processHasFinished(int, QProcess::ExitStatus)), Qt::QueuedConnection);
-  connect(m_ProcessPtr.data(), SIGNAL(error(QProcess::ProcessError)), this, SLOT(processHasErroredOut(QProcess::ProcessError)), Qt::QueuedConnection);
-  connect(m_ProcessPtr.data(), SIGNAL(readyReadStandardError()), this, SLOT(sendErrorOutput()), Qt::QueuedConnection);
-  connect(m_ProcessPtr.data(), SIGNAL(readyReadStandardOutput()), this, SLOT(sendStandardOutput()), Qt::QueuedConnection);
+  QString switches = "-";
+  if(m_MeshSize == 0)
+  {
+    switches += "verycoarse";
+  }
+  else if(m_MeshSize == 1)
+  {
+    switches += "coarse";
+  }
+  else if(m_MeshSize == 2)
+  {
+    switches += "moderate";
+  }
+  else if(m_MeshSize == 3)
+  {
+    switches += "fine";
+  }
+  else if(m_MeshSize == 4)
+  {
+    switches += "veryfine";
+  }
 
-  m_ProcessPtr->setWorkingDirectory(m_outputPath);
-  m_ProcessPtr->start(program, arguments);
-  m_ProcessPtr->waitForStarted(2000);
-  m_ProcessPtr->waitForFinished(-1);
+  QString switchMeshFile;
+  switchMeshFile = "-meshfile=";
+  switchMeshFile += meshFile;
 
-  notifyStatusMessage("Merging individual volume meshes");
+  QStringList arguments;
+  arguments << file << "-batchmode" << switchMeshFile << "-V" << switches;
+  return arguments;
 }
 
 // -----------------------------------------------------------------------------
@@ -930,44 +1088,17 @@ void Export3dSolidMesh::sendStandardOutput()
 // -----------------------------------------------------------------------------
 void Export3dSolidMesh::scanTetGenFile(const QString& fileEle, const QString& fileNode, DataContainer* dataContainer, AttributeMatrix* vertexAttrMat, AttributeMatrix* cellAttrMat)
 {
-
-  bool allocate = true;
-  bool ok = false;
-  QFile inStreamNode(fileNode);
-  QFile inStreamEle(fileEle);
-
-  if(!inStreamEle.open(QIODevice::ReadOnly | QIODevice::Text))
+  TetGenFileReader reader;
+  if(!reader.open(this, fileNode, fileEle))
   {
-    QString ss = QObject::tr("Input file could not be opened: %1").arg(fileEle);
-    setErrorCondition(-100, ss);
     return;
   }
 
-  if(!inStreamNode.open(QIODevice::ReadOnly | QIODevice::Text))
-  {
-    QString ss = QObject::tr("Input file could not be opened: %1").arg(fileNode);
-    setErrorCondition(-100, ss);
-    return;
-  }
-
-  QByteArray bufNode;
-  QByteArray bufEle;
-  QList<QByteArray> tokensNode;
-  QList<QByteArray> tokensEle;
-
-  bufEle = inStreamEle.readLine();
-  bufEle = bufEle.trimmed();
-  bufEle = bufEle.simplified();
-  tokensEle = bufEle.split(' ');
-  size_t numCells = tokensEle.at(0).toULongLong(&ok);
+  size_t numCells = reader.getNumTets();
   std::vector<size_t> tDims(1, numCells);
   cellAttrMat->resizeAttributeArrays(tDims);
 
-  bufNode = inStreamNode.readLine();
-  bufNode = bufNode.trimmed();
-  bufNode = bufNode.simplified();
-  tokensNode = bufNode.split(' ');
-  size_t numVerts = tokensNode.at(0).toULongLong(&ok);
+  size_t numVerts = reader.getNumVertices();
   tDims[0] = numVerts;
   vertexAttrMat->resizeAttributeArrays(tDims);
 
@@ -975,24 +1106,17 @@ void Export3dSolidMesh::scanTetGenFile(const QString& fileEle, const QString& fi
   tetGeomPtr->resizeTetList(numCells);
   tetGeomPtr->resizeVertexList(numVerts);
 
-  //  SharedVertexList::Pointer tetvertexPtr = TetrahedralGeom::CreateSharedVertexList(static_cast<int64_t>(numVerts), allocate);
-  float* tetvertex = tetGeomPtr->getVertexPointer(0);
-  for(size_t i = 0; i < numVerts; i++)
-  {
-    bufNode = inStreamNode.readLine();
-    bufNode = bufNode.trimmed();
-    bufNode = bufNode.simplified();
-    tokensNode = bufNode.split(' ');
-    tetvertex[3 * i] = tokensNode[1].toFloat(&ok);
-    tetvertex[3 * i + 1] = tokensNode[2].toFloat(&ok);
-    tetvertex[3 * i + 2] = tokensNode[3].toFloat(&ok);
-  }
-
-  //  SharedVertexList::Pointer tetvertexPtr = TetrahedralGeom::CreateSharedVertexList(static_cast<int64_t>(numVerts), allocate);
-  // TetrahedralGeom::Pointer tetGeomPtr = TetrahedralGeom::CreateGeometry(static_cast<int64_t>(numCells), tetvertexPtr, SIMPL::Geometry::TetrahedralGeometry, allocate);
-  //  tetGeomPtr->setSpatialDimensionality(3);
+  // Both files are parsed at once, straight into the geometry and the feature arrays
+  TetGenFileReader::FeatureData featureData = createTetCellData(cellAttrMat, numCells);
+  reader.read(this, tetGeomPtr->getVertexPointer(0), tetGeomPtr->getTetPointer(0), featureData);
+}
 
-  MeshIndexType* tets = tetGeomPtr->getTetPointer(0);
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+TetGenFileReader::FeatureData Export3dSolidMesh::createTetCellData(AttributeMatrix* cellAttrMat, size_t numCells)
+{
+  bool allocate = true;
 
   QString dataArrayName = "FeatureIDs";
   Int32ArrayType::Pointer featureIDsdata = Int32ArrayType::NullPointer();
@@ -1015,29 +1139,15 @@ void Export3dSolidMesh::scanTetGenFile(const QString& fileEle, const QString& fi
   phasesdata = Int32ArrayType::CreateArray(numCells, cDims, dataArrayName, allocate);
   cellAttrMat->insertOrAssign(phasesdata);
 
-  for(size_t i = 0; i < numCells; i++)
-  {
-    bufEle = inStreamEle.readLine();
-    bufEle = bufEle.trimmed();
-    bufEle = bufEle.simplified();
-    tokensEle = bufEle.split(' ');
-    tets[4 * i] = tokensEle[1].toInt(&ok) - 1;
-    tets[4 * i + 1] = tokensEle[2].toInt(&ok) - 1;
-    tets[4 * i + 2] = tokensEle[3].toInt(&ok) - 1;
-    tets[4 * i + 3] = tokensEle[4].toInt(&ok) - 1;
-
-    int32_t value = tokensEle[5].toInt(&ok);
-    featureIDsdata->setComponent(i, 0, value);
-
-    int32_t pvalue = m_FeaturePhases[value];
-    phasesdata->setComponent(i, 0, pvalue);
-
-    for(size_t j = 0; j < 3; j++)
-    {
-      float evalue = m_FeatureEulerAngles[3 * value + j];
-      eulerangles->setComponent(i, j, evalue);
-    }
-  }
+  // The region attribute of a tetrahedron is the id of the feature it belongs to
+  TetGenFileReader::FeatureData featureData;
+  featureData.featurePhases = m_FeaturePhases;
+  featureData.featureEulerAngles = m_FeatureEulerAngles;
+  featureData.numFeatures = m_FeatureEulerAnglesPtr.lock()->getNumberOfTuples();
+  featureData.featureIds = featureIDsdata->getPointer(0);
+  featureData.phases = phasesdata->getPointer(0);
+  featureData.eulerAngles = eulerangles->getPointer(0);
+  return featureData;
 }
 
 // -----------------------------------------------------------------------------
@@ -1381,6 +1491,18 @@ int Export3dSolidMesh::getMeshSize() const
   return m_MeshSize;
 }
 
+// -----------------------------------------------------------------------------
+void Export3dSolidMesh::setNumProcesses(int value)
+{
+  m_NumProcesses = value;
+}
+
+// -----------------------------------------------------------------------------
+int Export3dSolidMesh::getNumProcesses() const
+{
+  return m_NumProcesses;
+}
+
 // -----------------------------------------------------------------------------
 void Export3dSolidMesh::setIncludeHolesUsingPhaseID(bool value)
 {
@@ -5,6 +5,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include <QtCore/QMutex>
 #include <QtCore/QProcess>
@@ -20,6 +21,7 @@
 #include "SIMPLib/Filtering/AbstractFilter.h"
 #include "SIMPLib/Geometry/IGeometry.h"
 
+#include "SimulationIO/SimulationIOFilters/Utility/TetGenFileReader.h"
 #include "SimulationIO/SimulationIOPlugin.h"
 
 class QProcess;
@@ -59,6 +61,7 @@ class SimulationIO_EXPORT Export3dSolidMesh : public AbstractFilter
   PYB11_PROPERTY(int MeshFileFormat READ getMeshFileFormat WRITE setMeshFileFormat)
   PYB11_PROPERTY(QString NetgenSTLFileName READ getNetgenSTLFileName WRITE setNetgenSTLFileName)
   PYB11_PROPERTY(int MeshSize READ getMeshSize WRITE setMeshSize)
+  PYB11_PROPERTY(int NumProcesses READ getNumProcesses WRITE setNumProcesses)
   PYB11_END_BINDINGS()
   // End Python bindings declarations
 
@@ -325,6 +328,17 @@ public:
   int getMeshSize() const;
   Q_PROPERTY(int MeshSize READ getMeshSize WRITE setMeshSize)
 
+  /**
+   * @brief Setter property for NumProcesses
+   */
+  void setNumProcesses(int value);
+  /**
+   * @brief Getter property for NumProcesses
+   * @return Value of NumProcesses
+   */
+  int getNumProcesses() const;
+  Q_PROPERTY(int NumProcesses READ getNumProcesses WRITE setNumProcesses)
+
   /**
    * @brief getCompiledLibraryName Reimplemented from @see AbstractFilter class
    */
@@ -415,6 +429,8 @@ private:
   float* m_FeatureCentroid = nullptr;
   std::weak_ptr<DataArray<int32_t>> m_FeaturePhasesPtr;
   int32_t* m_FeaturePhases = nullptr;
+  std::weak_ptr<DataArray<int32_t>> m_SurfaceMeshFaceLabelsPtr;
+  int32_t* m_SurfaceMeshFaceLabels = nullptr;
 
   int m_MeshingPackage = {0};
   QString m_outputPath = {""};
@@ -436,11 +452,17 @@ private:
   int m_MeshFileFormat = {0};
   QString m_NetgenSTLFileName = {""};
   int m_MeshSize = {0};
+  int m_NumProcesses = {0};
 
   void runPackage(const QString& file, const QString& meshFile);
-  void mergeMesh(const QString& mergefile, const QString& indivFile);
+  void meshFeatures(size_t numfeatures);
+  QProcessEnvironment createPackageEnvironment() const;
+  QStringList createNetgenArguments(const QString& file, const QString& meshFile) const;
 
+  void createTetDataContainer();
   void createTetgenInpFile(const QString& file, MeshIndexType numNodes, float* nodes, MeshIndexType numTri, MeshIndexType* triangles, size_t numfeatures, float* centroid);
+  void createTetgenRegions(size_t numfeatures, const float* centroid, std::vector<float>& holes, std::vector<float>& regions) const;
+  QString createTetgenSwitches() const;
 
   QWaitCondition m_WaitCondition;
   QMutex m_Mutex;
@@ -449,6 +471,7 @@ private:
   QStringList arguments;
 
   void scanTetGenFile(const QString& fileEle, const QString& fileNode, DataContainer* dataContainer, AttributeMatrix* vertexAttributeMatrix, AttributeMatrix* cellAttributeMatrix);
+  TetGenFileReader::FeatureData createTetCellData(AttributeMatrix* cellAttrMat, size_t numCells);
 
 public:
   /* Rule of 5: All special member functions should be defined if any are defined.
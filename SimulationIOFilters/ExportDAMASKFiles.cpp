@@ -4,6 +4,8 @@
 
 #include "ExportDAMASKFiles.h"
 
+#include <algorithm>
+
 #include <QtCore/QDir>
 #include <QtCore/QTextStream>
 
@@ -35,6 +37,9 @@
 #include "SimulationIO/SimulationIOConstants.h"
 #include "SimulationIO/SimulationIOVersion.h"
 
+#include "SimulationIO/SimulationIOFilters/Utility/DamaskFileWriter.h"
+#include "SimulationIO/SimulationIOFilters/Utility/FeatureAggregator.h"
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -74,19 +79,34 @@ void ExportDAMASKFiles::setupFilterParameters()
     choices.push_back("pointwise");
     choices.push_back("grainwise");
     parameter->setChoices(choices);
-    std::vector<QString> linkedProps = {"CompressGeomFile"};
+    std::vector<QString> linkedProps = {"CompressGeomFile", "MeanOrientations"};
     parameter->setLinkedProperties(linkedProps);
     parameter->setEditable(false);
     parameter->setCategory(FilterParameter::Category::Parameter);
     parameters.push_back(parameter);
   }
 
+  {
+    ChoiceFilterParameter::Pointer parameter = ChoiceFilterParameter::New();
+    parameter->setHumanLabel("File Format");
+    parameter->setPropertyName("FileFormat");
+    parameter->setSetterCallback(SIMPL_BIND_SETTER(ExportDAMASKFiles, this, FileFormat));
+    parameter->setGetterCallback(SIMPL_BIND_GETTER(ExportDAMASKFiles, this, FileFormat));
+    std::vector<QString> choices;
+    choices.push_back("geom + material.config");
+    choices.push_back("vti + material.yaml");
+    parameter->setChoices(choices);
+    parameter->setCategory(FilterParameter::Category::Parameter);
+    parameters.push_back(parameter);
+  }
+
   parameters.push_back(SIMPL_NEW_OUTPUT_PATH_FP("Output Path ", OutputPath, FilterParameter::Category::Parameter, ExportDAMASKFiles));
   parameters.push_back(SIMPL_NEW_STRING_FP("Geometry File Name", GeometryFileName, FilterParameter::Category::Parameter, ExportDAMASKFiles));
 
   parameters.push_back(SIMPL_NEW_INTEGER_FP("Homogenization Index", HomogenizationIndex, FilterParameter::Category::Parameter, ExportDAMASKFiles));
 
-  parameters.push_back(SIMPL_NEW_BOOL_FP("Compress Geom File", CompressGeomFile, FilterParameter::Category::Parameter, ExportDAMASKFiles, {0}));
+  parameters.push_back(SIMPL_NEW_BOOL_FP("Compress Geom File", CompressGeomFile, FilterParameter::Category::Parameter, ExportDAMASKFiles, {0, 1}));
+  parameters.push_back(SIMPL_NEW_BOOL_FP("Use Mean Grain Orientations", MeanOrientations, FilterParameter::Category::Parameter, ExportDAMASKFiles, {1}));
 
   parameters.push_back(SeparatorFilterParameter::Create("Cell Data", FilterParameter::Category::RequiredArray));
   {
@@ -113,10 +133,12 @@ void ExportDAMASKFiles::readFilterParameters(AbstractFilterParametersReader* rea
   reader->openFilterGroup(this, index);
 
   setDataFormat(reader->readValue("DataFormat", getDataFormat()));
+  setFileFormat(reader->readValue("FileFormat", getFileFormat()));
   setOutputPath(reader->readString("OutputPath", getOutputPath()));
   setGeometryFileName(reader->readString("GeometryFileName", getGeometryFileName()));
   setHomogenizationIndex(reader->readValue("HomogenizationIndex", getHomogenizationIndex()));
   setCompressGeomFile(reader->readValue("CompressGeomFile", getCompressGeomFile()));
+  setMeanOrientations(reader->readValue("MeanOrientations", getMeanOrientations()));
   setCellEulerAnglesArrayPath(reader->readDataArrayPath("CellEulerAnglesArrayPath", getCellEulerAnglesArrayPath()));
   setCellPhasesArrayPath(reader->readDataArrayPath("CellPhasesArrayPath", getCellPhasesArrayPath()));
   setFeatureIdsArrayPath(reader->readDataArrayPath("FeatureIdsArrayPath", getFeatureIdsArrayPath()));
@@ -187,202 +209,76 @@ void ExportDAMASKFiles::execute()
     setErrorCondition(-1, ss);
     return;
   }
-  //
-  //
-  QString geomFile = m_OutputPath + QDir::separator() + m_GeometryFileName + ".geom";
-  QString matFile = m_OutputPath + QDir::separator() + "material.config";
-  FILE* geomf = fopen(geomFile.toLatin1().data(), "wb");
-  FILE* matf = fopen(matFile.toLatin1().data(), "wb");
-  //
-  //
-  DataContainer::Pointer m = getDataContainerArray()->getDataContainer(getFeatureIdsArrayPath().getDataContainerName());
-
-  SizeVec3Type dims = m->getGeometryAs<ImageGeom>()->getDimensions();
-  FloatVec3Type spacing = m->getGeometryAs<ImageGeom>()->getSpacing();
-  FloatVec3Type origin = m->getGeometryAs<ImageGeom>()->getOrigin();
-  float size[3] = {0.0f, 0.0f, 0.0f};
-
-  for(int32_t i = 0; i < 3; i++)
-  {
-    size[i] = dims[i] * spacing[i];
-  }
 
-  int32_t totalPoints = m->getGeometryAs<ImageGeom>()->getNumberOfElements();
+  // The DAMASK 3 files are a binary VTK image grid and a YAML material file
+  const bool vtkFormat = (m_FileFormat == 1);
+  QString geomFile = m_OutputPath + QDir::separator() + m_GeometryFileName + (vtkFormat ? ".vti" : ".geom");
+  QString matFile = m_OutputPath + QDir::separator() + (vtkFormat ? "material.yaml" : "material.config");
 
-  // find total number of features
-  int32_t maxGrainId = 0;
-  for(int32_t i = 0; i < totalPoints; i++)
-  {
-    if(m_FeatureIds[i] > maxGrainId)
-    {
-      maxGrainId = m_FeatureIds[i];
-    }
-  }
-  //
-  //
-  fprintf(geomf, "6       header\n");
-  fprintf(geomf, "# Generated by DREAM.3D\n");
-  fprintf(geomf, "grid    a %zu    b %zu    c %zu\n", dims[0], dims[1], dims[2]);
-  fprintf(geomf, "size    x %.3f    y %.3f    z %.3f\n", size[0], size[1], size[2]);
-  fprintf(geomf, "origin    x %.3f    y %.3f    z %.3f\n", origin[0], origin[1], origin[2]);
-  fprintf(geomf, "homogenization  %d\n", m_HomogenizationIndex);
+  DataContainer::Pointer m = getDataContainerArray()->getDataContainer(getFeatureIdsArrayPath().getDataContainerName());
+  const ImageGeom& imageGeom = *(m->getGeometryAs<ImageGeom>());
+  size_t totalPoints = imageGeom.getNumberOfElements();
 
+  // Both files are formatted in blocks on all cores and written in order
   switch(m_DataFormat)
   {
   case 0: // pointwise
   {
-    fprintf(geomf, "microstructures %d\n", totalPoints);
-
-    if(m_CompressGeomFile)
-    {
-      fprintf(geomf, "1 to %10d", totalPoints);
-    }
-    else
+    if(vtkFormat)
     {
-      int32_t entriesPerLine = 0;
-      for(int32_t i = 1; i <= totalPoints; i++)
+      if(!DamaskFileWriter::writeVtiFile(this, geomFile, imageGeom, nullptr, m_CompressGeomFile))
       {
-        if(entriesPerLine != 0)
-        {
-          if((entriesPerLine % dims[0]) != 0) // dims[0] per line
-          {
-            fprintf(geomf, " ");
-          }
-          else
-          {
-            fprintf(geomf, "\n");
-            entriesPerLine = 0;
-          }
-        }
-        fprintf(geomf, "%10d", i);
-        entriesPerLine++;
+        return;
       }
-    }
-    break;
-  }
-  case 1: // grainwise
-  {
-    fprintf(geomf, "microstructures %d\n", maxGrainId);
-
-    int32_t entriesPerLine = 0;
-    for(int32_t i = 0; i < totalPoints; i++)
-    {
-      if(entriesPerLine != 0)
+      if(!DamaskFileWriter::writePointwiseMaterialYaml(this, matFile, m_HomogenizationIndex, m_CellPhases, m_CellEulerAngles, totalPoints))
       {
-        if((entriesPerLine % dims[0]) != 0) // dims[0] per line
-        {
-          fprintf(geomf, " ");
-        }
-        else
-        {
-          fprintf(geomf, "\n");
-          entriesPerLine = 0;
-        }
+        return;
       }
-      fprintf(geomf, "%10d", m_FeatureIds[i]);
-      entriesPerLine++;
-      //
+      break;
     }
-    break;
-  }
-  }
-
-  //
-  //
-  fprintf(matf, "#############################################################################\n");
-  fprintf(matf, "# Generated by DREAM.3D\n");
-  fprintf(matf, "#############################################################################\n");
-  fprintf(matf, "# Add <homogenization>, <crystallite>, and <phase> for a complete definition\n");
-  fprintf(matf, "#############################################################################\n");
-  //
-  //
-  switch(m_DataFormat)
-  {
-  case 0: // pointwise
-  {
-
-    fprintf(matf, "<texture>\n");
-    for(int32_t i = 0; i < totalPoints; i++)
+    if(!DamaskFileWriter::writeGeomFile(this, geomFile, imageGeom, m_HomogenizationIndex, nullptr, totalPoints, m_CompressGeomFile))
     {
-      fprintf(matf, "[point%d]\n", i + 1);
-      fprintf(matf, "(gauss) phi1 %.3f   Phi %.3f    phi2 %.3f   scatter 0.0   fraction 1.0 \n", m_CellEulerAngles[i * 3] * 180.0 * SIMPLib::Constants::k_1OverPiD,
-              m_CellEulerAngles[i * 3 + 1] * 180.0 * SIMPLib::Constants::k_1OverPiD, m_CellEulerAngles[i * 3 + 2] * 180.0 * SIMPLib::Constants::k_1OverPiD);
+      return;
     }
-
-    fprintf(matf, "<microstructure>\n");
-    for(int32_t i = 0; i < totalPoints; i++)
+    if(!DamaskFileWriter::writePointwiseMaterialConfig(this, matFile, m_CellPhases, m_CellEulerAngles, totalPoints))
     {
-      fprintf(matf, "[point%d]\n", i + 1);
-      fprintf(matf, "crystallite 1\n");
-      fprintf(matf, "(constituent)   phase %d texture %d fraction 1.0\n", m_CellPhases[i], i + 1);
+      return;
     }
-    //
-    //
     break;
   }
   case 1: // grainwise
   {
-    //
-    Int32ArrayType::Pointer m_phaseIdLengthPtr = Int32ArrayType::CreateArray(maxGrainId, std::string("PHASEID_INTERNAL_USE_ONLY"), true);
-    int32_t* m_phaseId = m_phaseIdLengthPtr->getPointer(0);
-
-    FloatArrayType::Pointer m_orientLengthPtr = FloatArrayType::CreateArray(maxGrainId * 3, std::string("ORIENTATION_INTERNAL_USE_ONLY"), true);
-    float* m_orient = m_orientLengthPtr->getPointer(0);
+    // Phase, orientation and total number of features, gathered in one parallel pass over the voxels
+    FeatureAggregator::Orientation orientation = m_MeanOrientations ? FeatureAggregator::Orientation::Mean : FeatureAggregator::Orientation::LastVoxel;
+    FeatureAggregator::FeatureData grains = FeatureAggregator::aggregate(m_FeatureIds, m_CellPhases, m_CellEulerAngles, totalPoints, orientation);
+    size_t maxGrainId = static_cast<size_t>(std::max(grains.maxFeatureId, 0));
 
-    int32_t grainId = 1;
-    while(grainId <= maxGrainId)
+    if(vtkFormat)
     {
-      for(int32_t i = 0; i < totalPoints; i++)
+      // The feature ids are the material indices, material 0 stands for feature id 0
+      if(!DamaskFileWriter::writeVtiFile(this, geomFile, imageGeom, m_FeatureIds, m_CompressGeomFile))
+      {
+        return;
+      }
+      if(!DamaskFileWriter::writeGrainwiseMaterialYaml(this, matFile, m_HomogenizationIndex, grains))
       {
-        if(m_FeatureIds[i] == grainId)
-        {
-          m_phaseId[grainId - 1] = m_CellPhases[i];
-          m_orient[(grainId - 1) * 3] = m_CellEulerAngles[i * 3] * 180.0 * SIMPLib::Constants::k_1OverPiD;
-          m_orient[(grainId - 1) * 3 + 1] = m_CellEulerAngles[i * 3 + 1] * 180.0 * SIMPLib::Constants::k_1OverPiD;
-          m_orient[(grainId - 1) * 3 + 2] = m_CellEulerAngles[i * 3 + 2] * 180.0 * SIMPLib::Constants::k_1OverPiD;
-        }
+        return;
       }
-      grainId++;
+      break;
     }
-    //
-    //
-    //
-    fprintf(matf, "<texture>\n");
-    for(int32_t i = 1; i <= maxGrainId; i++)
+    if(!DamaskFileWriter::writeGeomFile(this, geomFile, imageGeom, m_HomogenizationIndex, m_FeatureIds, maxGrainId, m_CompressGeomFile))
     {
-      fprintf(matf, "[grain%d]\n", i);
-      fprintf(matf, "(gauss) phi1 %.3f   Phi %.3f    phi2 %.3f   scatter 0.0   fraction 1.0 \n", m_orient[(i - 1) * 3], m_orient[(i - 1) * 3 + 1], m_orient[(i - 1) * 3 + 2]);
+      return;
     }
-
-    fprintf(matf, "<microstructure>\n");
-    for(int32_t i = 1; i <= maxGrainId; i++)
+    if(!DamaskFileWriter::writeGrainwiseMaterialConfig(this, matFile, grains))
     {
-      fprintf(matf, "[grain%d]\n", i);
-      fprintf(matf, "crystallite 1\n");
-      fprintf(matf, "(constituent)   phase %d texture %d fraction 1.0\n", m_phaseId[i - 1], i);
+      return;
     }
-    //
-    //
     break;
   }
-    //
-  }
-  //
-  //
-  fclose(geomf);
-  fclose(matf);
-  //
-  //
-  if(getErrorCode() < 0)
-  {
-    return;
-  }
-  //
-  if(getCancel())
-  {
-    return;
+  default:
+    break;
   }
-  //
 }
 
 // -----------------------------------------------------------------------------
@@ -498,6 +394,18 @@ int ExportDAMASKFiles::getDataFormat() const
   return m_DataFormat;
 }
 
+// -----------------------------------------------------------------------------
+void ExportDAMASKFiles::setFileFormat(int value)
+{
+  m_FileFormat = value;
+}
+
+// -----------------------------------------------------------------------------
+int ExportDAMASKFiles::getFileFormat() const
+{
+  return m_FileFormat;
+}
+
 // -----------------------------------------------------------------------------
 void ExportDAMASKFiles::setOutputPath(const QString& value)
 {
@@ -581,3 +489,15 @@ bool ExportDAMASKFiles::getCompressGeomFile() const
 {
   return m_CompressGeomFile;
 }
+
+// -----------------------------------------------------------------------------
+void ExportDAMASKFiles::setMeanOrientations(bool value)
+{
+  m_MeanOrientations = value;
+}
+
+// -----------------------------------------------------------------------------
+bool ExportDAMASKFiles::getMeanOrientations() const
+{
+  return m_MeanOrientations;
+}
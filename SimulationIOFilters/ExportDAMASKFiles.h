@@ -36,6 +36,7 @@ class SimulationIO_EXPORT ExportDAMASKFiles : public AbstractFilter
   PYB11_SHARED_POINTERS(ExportDAMASKFiles)
   PYB11_FILTER_NEW_MACRO(ExportDAMASKFiles)
   PYB11_PROPERTY(int DataFormat READ getDataFormat WRITE setDataFormat)
+  PYB11_PROPERTY(int FileFormat READ getFileFormat WRITE setFileFormat)
   PYB11_PROPERTY(QString OutputPath READ getOutputPath WRITE setOutputPath)
   PYB11_PROPERTY(QString GeometryFileName READ getGeometryFileName WRITE setGeometryFileName)
   PYB11_PROPERTY(int HomogenizationIndex READ getHomogenizationIndex WRITE setHomogenizationIndex)
@@ -43,6 +44,7 @@ class SimulationIO_EXPORT ExportDAMASKFiles : public AbstractFilter
   PYB11_PROPERTY(DataArrayPath CellPhasesArrayPath READ getCellPhasesArrayPath WRITE setCellPhasesArrayPath)
   PYB11_PROPERTY(DataArrayPath CellEulerAnglesArrayPath READ getCellEulerAnglesArrayPath WRITE setCellEulerAnglesArrayPath)
   PYB11_PROPERTY(bool CompressGeomFile READ getCompressGeomFile WRITE setCompressGeomFile)
+  PYB11_PROPERTY(bool MeanOrientations READ getMeanOrientations WRITE setMeanOrientations)
   PYB11_END_BINDINGS()
   // End Python bindings declarations
 
@@ -78,6 +80,17 @@ public:
   int getDataFormat() const;
   Q_PROPERTY(int DataFormat READ getDataFormat WRITE setDataFormat)
 
+  /**
+   * @brief Setter property for FileFormat
+   */
+  void setFileFormat(int value);
+  /**
+   * @brief Getter property for FileFormat
+   * @return Value of FileFormat
+   */
+  int getFileFormat() const;
+  Q_PROPERTY(int FileFormat READ getFileFormat WRITE setFileFormat)
+
   /**
    * @brief Setter property for OutputPath
    */
@@ -155,6 +168,17 @@ public:
   bool getCompressGeomFile() const;
   Q_PROPERTY(bool CompressGeomFile READ getCompressGeomFile WRITE setCompressGeomFile)
 
+  /**
+   * @brief Setter property for MeanOrientations
+   */
+  void setMeanOrientations(bool value);
+  /**
+   * @brief Getter property for MeanOrientations
+   * @return Value of MeanOrientations
+   */
+  bool getMeanOrientations() const;
+  Q_PROPERTY(bool MeanOrientations READ getMeanOrientations WRITE setMeanOrientations)
+
   /**
    * @brief getCompiledLibraryName Reimplemented from @see AbstractFilter class
    */
@@ -238,6 +262,7 @@ private:
   float* m_CellEulerAngles = nullptr;
 
   int m_DataFormat = {0};
+  int m_FileFormat = {0};
   QString m_OutputPath = {""};
   QString m_GeometryFileName = {""};
   int m_HomogenizationIndex = {1};
@@ -245,6 +270,7 @@ private:
   DataArrayPath m_CellPhasesArrayPath = {SIMPL::Defaults::ImageDataContainerName, SIMPL::Defaults::CellAttributeMatrixName, SIMPL::CellData::Phases};
   DataArrayPath m_CellEulerAnglesArrayPath = {SIMPL::Defaults::ImageDataContainerName, SIMPL::Defaults::CellAttributeMatrixName, SIMPL::CellData::EulerAngles};
   bool m_CompressGeomFile = {true};
+  bool m_MeanOrientations = {false};
 
 public:
   /* Rule of 5: All special member functions should be defined if any are defined.
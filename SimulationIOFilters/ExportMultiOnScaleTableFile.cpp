@@ -34,11 +34,13 @@
 #include "ExportMultiOnScaleTableFile.h"
 
 #include <QtCore/QDir>
+#include <QtCore/QStringList>
 
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/DataContainers/DataContainerArray.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
 #include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
+#include "SIMPLib/FilterParameters/IntFilterParameter.h"
 #include "SIMPLib/FilterParameters/IntVec3FilterParameter.h"
 #include "SIMPLib/FilterParameters/OutputPathFilterParameter.h"
 #include "SIMPLib/FilterParameters/PreflightUpdatedValueFilterParameter.h"
@@ -51,10 +53,13 @@
 
 #include "SimulationIO/SimulationIOFilters/ExportOnScaleTableFile.h"
 #include "SimulationIO/SimulationIOFilters/Utility/OnScaleTableFileWriter.h"
+#include "SimulationIO/SimulationIOFilters/Utility/SlabWriter.hpp"
+#include "SimulationIO/SimulationIOFilters/Utility/TaskPool.hpp"
 
 struct ExportMultiOnScaleTableFile::Impl
 {
   std::vector<DataArrayPath> m_FeatureIdsList;
+  std::vector<size_t> m_NumCellsList;
 
   Impl() = default;
 
@@ -68,6 +73,7 @@ struct ExportMultiOnScaleTableFile::Impl
   void reset()
   {
     m_FeatureIdsList.clear();
+    m_NumCellsList.clear();
   }
 };
 
@@ -75,6 +81,8 @@ struct ExportMultiOnScaleTableFile::Impl
 ExportMultiOnScaleTableFile::ExportMultiOnScaleTableFile()
 : p_Impl(std::make_unique<Impl>())
 , m_NumKeypoints(2, 2, 2)
+, m_NumWorkers(0)
+, m_MemoryBudget(0)
 , m_PhaseNamesArrayPath(SIMPL::Defaults::ImageDataContainerName, SIMPL::Defaults::EnsembleAttributeMatrixName, SIMPL::EnsembleData::PhaseName)
 {
   initialize();
@@ -104,6 +112,8 @@ void ExportMultiOnScaleTableFile::setupFilterParameters()
   parameters.push_back(SIMPL_NEW_STRING_FP("Array Name", ArrayName, FilterParameter::Category::Parameter, ExportMultiOnScaleTableFile));
 
   parameters.push_back(SIMPL_NEW_INT_VEC3_FP("Number of Keypoints", NumKeypoints, FilterParameter::Category::Parameter, ExportMultiOnScaleTableFile));
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Number of Concurrent Exports (0 = All Cores)", NumWorkers, FilterParameter::Category::Parameter, ExportMultiOnScaleTableFile));
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Memory Budget (MB, 0 = Unlimited)", MemoryBudget, FilterParameter::Category::Parameter, ExportMultiOnScaleTableFile));
   parameters.push_back(SeparatorFilterParameter::Create("Ensemble Data", FilterParameter::Category::RequiredArray));
 
   parameters.push_back(SIMPL_NEW_PREFLIGHTUPDATEDVALUE_FP("Selected Arrays", SelectedArrays, FilterParameter::Category::Parameter, ExportMultiOnScaleTableFile));
@@ -127,6 +137,8 @@ void ExportMultiOnScaleTableFile::readFilterParameters(AbstractFilterParametersR
   setArrayName(reader->readString("ArrayName", getArrayName()));
   setSelectedArrays(reader->readString("SelectedArrays", getSelectedArrays()));
   setNumKeypoints(reader->readIntVec3("NumKeypoints", getNumKeypoints()));
+  setNumWorkers(reader->readValue("NumWorkers", getNumWorkers()));
+  setMemoryBudget(reader->readValue("MemoryBudget", getMemoryBudget()));
   setPhaseNamesArrayPath(reader->readDataArrayPath("PhaseNamesArrayPath", getPhaseNamesArrayPath()));
   reader->closeFilterGroup();
 }
@@ -146,6 +158,18 @@ void ExportMultiOnScaleTableFile::dataCheck()
     setErrorCondition(-10400, ss);
   }
 
+  if(m_NumWorkers < 0)
+  {
+    QString ss = QObject::tr("The number of concurrent exports must be 0 (all cores) or greater");
+    setErrorCondition(-10408, ss);
+  }
+
+  if(m_MemoryBudget < 0)
+  {
+    QString ss = QObject::tr("The memory budget must be 0 (unlimited) or greater");
+    setErrorCondition(-10409, ss);
+  }
+
   QDir dir(m_OutputPath);
   if(!dir.exists())
   {
@@ -225,6 +249,7 @@ void ExportMultiOnScaleTableFile::dataCheck()
     DataArrayPath path = dataArray->getDataArrayPath();
 
     p_Impl->m_FeatureIdsList.push_back(path);
+    p_Impl->m_NumCellsList.push_back(dataArray->getNumberOfTuples());
 
     m_SelectedArrays += path.serialize() + "\n";
   }
@@ -253,29 +278,82 @@ void ExportMultiOnScaleTableFile::execute()
     return;
   }
 
-  ExportOnScaleTableFile::Pointer createOnScaleFilter = ExportOnScaleTableFile::New();
-  createOnScaleFilter->setDataContainerArray(getDataContainerArray());
+  const std::vector<DataArrayPath>& featureIdsList = p_Impl->m_FeatureIdsList;
+  size_t numExports = featureIdsList.size();
+  size_t numWorkers = std::min(SlabWriter::resolveThreadCount(m_NumWorkers), numExports);
 
-  createOnScaleFilter->setOutputPath(m_OutputPath);
-  createOnScaleFilter->setNumKeypoints(m_NumKeypoints);
-  createOnScaleFilter->setPhaseNamesArrayPath(m_PhaseNamesArrayPath);
-
-  for(const auto& featureIdsPath : p_Impl->m_FeatureIdsList)
+  // Share the cores between the concurrent exports instead of letting each writer use all of them
+  int32_t writerThreads = 0;
+  if(numWorkers > 1)
+  {
+    writerThreads = static_cast<int32_t>(std::max<size_t>(SlabWriter::resolveThreadCount(0) / numWorkers, 1));
+  }
+  size_t memoryBudget = static_cast<size_t>(m_MemoryBudget) * 1024 * 1024;
+
+  // Each Data Container gets its own sub-filter so the exports share no state
+  std::vector<ExportOnScaleTableFile::Pointer> exportFilters;
+  std::vector<size_t> memoryCosts;
+  exportFilters.reserve(numExports);
+  memoryCosts.reserve(numExports);
+  for(size_t i = 0; i < numExports; i++)
   {
-    QString dcName = featureIdsPath.getDataContainerName();
+    ExportOnScaleTableFile::Pointer createOnScaleFilter = ExportOnScaleTableFile::New();
+    createOnScaleFilter->setDataContainerArray(getDataContainerArray());
+
+    createOnScaleFilter->setOutputPath(m_OutputPath);
+    createOnScaleFilter->setNumKeypoints(m_NumKeypoints);
+    createOnScaleFilter->setPhaseNamesArrayPath(m_PhaseNamesArrayPath);
+    createOnScaleFilter->setOutputFilePrefix(featureIdsList[i].getDataContainerName());
+    createOnScaleFilter->setPzflexFeatureIdsArrayPath(featureIdsList[i]);
+    createOnScaleFilter->setNumThreads(writerThreads);
+
+    exportFilters.push_back(createOnScaleFilter);
+    memoryCosts.push_back(OnScaleTableFileWriter::estimateMaterialBufferSize(p_Impl->m_NumCellsList[i], writerThreads));
+  }
+
+  std::vector<int> errorCodes(numExports, 0);
 
-    createOnScaleFilter->setOutputFilePrefix(dcName);
-    createOnScaleFilter->setPzflexFeatureIdsArrayPath(featureIdsPath);
+  auto exportDataContainer = [&exportFilters, &errorCodes](size_t i) {
+    exportFilters[i]->execute();
+    errorCodes[i] = exportFilters[i]->getErrorCode();
+  };
+
+  auto reportProgress = [this, numExports](size_t numFinished) { notifyStatusMessage(QObject::tr("Exported %1/%2 Data Containers").arg(numFinished).arg(numExports)); };
 
-    createOnScaleFilter->execute();
+  // Canceling is passed on to the sub-filters, which stop the running exports before their next chunk of materials
+  auto shouldStop = [this, &exportFilters]() {
+    if(!getCancel())
+    {
+      return false;
+    }
+    for(const auto& exportFilter : exportFilters)
+    {
+      exportFilter->setCancel(true);
+    }
+    return true;
+  };
+
+  TaskPool::run(numExports, numWorkers, memoryBudget, memoryCosts, exportDataContainer, reportProgress, shouldStop);
+
+  if(getCancel())
+  {
+    return;
+  }
 
-    int error = createOnScaleFilter->getErrorCode();
-    if(error < 0)
+  QStringList failures;
+  for(size_t i = 0; i < numExports; i++)
+  {
+    if(errorCodes[i] < 0)
     {
-      setErrorCondition(-10407, QObject::tr("ExportOnScaleTableFile sub-filter failed with error code %1").arg(error));
-      return;
+      failures << QObject::tr("'%1' (error code %2)").arg(featureIdsList[i].getDataContainerName()).arg(errorCodes[i]);
     }
   }
+
+  if(!failures.empty())
+  {
+    QString ss = QObject::tr("ExportOnScaleTableFile sub-filter failed for %1 of %2 Data Containers: %3").arg(failures.size()).arg(numExports).arg(failures.join(", "));
+    setErrorCondition(-10407, ss);
+  }
 }
 //
 // -----------------------------------------------------------------------------
@@ -433,6 +511,30 @@ IntVec3Type ExportMultiOnScaleTableFile::getNumKeypoints() const
   return m_NumKeypoints;
 }
 
+// -----------------------------------------------------------------------------
+void ExportMultiOnScaleTableFile::setNumWorkers(int value)
+{
+  m_NumWorkers = value;
+}
+
+// -----------------------------------------------------------------------------
+int ExportMultiOnScaleTableFile::getNumWorkers() const
+{
+  return m_NumWorkers;
+}
+
+// -----------------------------------------------------------------------------
+void ExportMultiOnScaleTableFile::setMemoryBudget(int value)
+{
+  m_MemoryBudget = value;
+}
+
+// -----------------------------------------------------------------------------
+int ExportMultiOnScaleTableFile::getMemoryBudget() const
+{
+  return m_MemoryBudget;
+}
+
 // -----------------------------------------------------------------------------
 void ExportMultiOnScaleTableFile::setPhaseNamesArrayPath(const DataArrayPath& value)
 {
@@ -59,6 +59,8 @@ class SimulationIO_EXPORT ExportMultiOnScaleTableFile : public AbstractFilter
   PYB11_PROPERTY(QString ArrayName READ getArrayName WRITE setArrayName)
   PYB11_PROPERTY(QString SelectedArrays READ getSelectedArrays WRITE setSelectedArrays)
   PYB11_PROPERTY(IntVec3Type NumKeypoints READ getNumKeypoints WRITE setNumKeypoints)
+  PYB11_PROPERTY(int NumWorkers READ getNumWorkers WRITE setNumWorkers)
+  PYB11_PROPERTY(int MemoryBudget READ getMemoryBudget WRITE setMemoryBudget)
   PYB11_PROPERTY(DataArrayPath PhaseNamesArrayPath READ getPhaseNamesArrayPath WRITE setPhaseNamesArrayPath)
   PYB11_END_BINDINGS()
   // End Python bindings declarations
@@ -163,6 +165,32 @@ public:
   void setNumKeypoints(const IntVec3Type& value);
   Q_PROPERTY(IntVec3Type NumKeypoints READ getNumKeypoints WRITE setNumKeypoints)
 
+  /**
+   * @brief Getter property for NumWorkers
+   * @return
+   */
+  int getNumWorkers() const;
+
+  /**
+   * @brief Setter property for NumWorkers
+   * @param value
+   */
+  void setNumWorkers(int value);
+  Q_PROPERTY(int NumWorkers READ getNumWorkers WRITE setNumWorkers)
+
+  /**
+   * @brief Getter property for MemoryBudget
+   * @return
+   */
+  int getMemoryBudget() const;
+
+  /**
+   * @brief Setter property for MemoryBudget
+   * @param value
+   */
+  void setMemoryBudget(int value);
+  Q_PROPERTY(int MemoryBudget READ getMemoryBudget WRITE setMemoryBudget)
+
   /**
    * @brief Getter property for PhaseNamesArrayPath
    * @return
@@ -260,6 +288,8 @@ private:
   QString m_ArrayName;
   QString m_SelectedArrays;
   IntVec3Type m_NumKeypoints;
+  int m_NumWorkers;
+  int m_MemoryBudget;
   DataArrayPath m_PhaseNamesArrayPath;
 
 public:
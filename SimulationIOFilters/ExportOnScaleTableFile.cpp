@@ -40,12 +40,11 @@
 #include "SIMPLib/DataContainers/DataContainerArray.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
 #include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
+#include "SIMPLib/FilterParameters/IntFilterParameter.h"
 #include "SIMPLib/FilterParameters/IntVec3FilterParameter.h"
 #include "SIMPLib/FilterParameters/OutputPathFilterParameter.h"
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
-#include "SIMPLib/Filtering/FilterManager.h"
-#include "SIMPLib/Filtering/IFilterFactory.hpp"
 #include "SIMPLib/Geometry/ImageGeom.h"
 #include "SIMPLib/Geometry/RectGridGeom.h"
 #include "SIMPLib/Math/SIMPLibMath.h"
@@ -57,69 +56,6 @@
 
 namespace
 {
-std::vector<std::vector<double>> matrixToTable(const Eigen::Matrix3f& matrix)
-{
-  std::vector<std::vector<double>> tableData;
-
-  for(size_t i = 0; i < 3; i++)
-  {
-    std::vector<double> row;
-    for(size_t j = 0; j < 3; j++)
-    {
-      row.push_back(matrix(i, j));
-    }
-    tableData.emplace_back(row);
-  }
-
-  return tableData;
-}
-
-int rotateData(DataContainerArray::Pointer dca, const Eigen::Matrix3f& rotationMatrix, const DataArrayPath& cellMatrixPath)
-{
-  const QString filtName = "RotateSampleRefFrame";
-  FilterManager* fm = FilterManager::Instance();
-  IFilterFactory::Pointer filterFactory = fm->getFactoryFromClassName(filtName);
-  if(filterFactory == nullptr)
-  {
-    return 0;
-  }
-
-  AbstractFilter::Pointer filter = filterFactory->create();
-
-  if(filter == nullptr)
-  {
-    return 0;
-  }
-
-  filter->setDataContainerArray(dca);
-
-  DynamicTableData table(matrixToTable(rotationMatrix));
-
-  QVariant value;
-
-  value.setValue(1);
-  if(!filter->setProperty("RotationRepresentationChoice", value))
-  {
-    return 0;
-  }
-
-  value.setValue(table);
-  if(!filter->setProperty("RotationTable", value))
-  {
-    return 0;
-  }
-
-  value.setValue(cellMatrixPath);
-  if(!filter->setProperty("CellAttributeMatrixPath", value))
-  {
-    return 0;
-  }
-
-  filter->execute();
-
-  return filter->getErrorCode();
-}
-
 template <class T>
 bool convertDataArrayPtr(IDataArray::ConstPointer dataArray, std::weak_ptr<const DataArray<T>>& weakPtr, ExportOnScaleTableFile* filter)
 {
@@ -216,9 +152,25 @@ Eigen::Matrix3f determineRotationMatrix(const std::array<size_t, 3>& dims)
   return matrix;
 }
 
+// Express a rotation by multiples of 90 degrees as a view of the unrotated grid: the rotated coordinates are
+// rotationMatrix * coords, so each row of the matrix picks the source axis (and direction) of a rotated axis.
+OnScaleTableFileWriter::PermutedGridView createPermutedView(const std::array<size_t, 3>& dims, const Eigen::Matrix3f& rotationMatrix)
+{
+  OnScaleTableFileWriter::PermutedGridView view;
+  view.sourceDims = dims;
+  for(size_t axis = 0; axis < 3; axis++)
+  {
+    Eigen::Index sourceAxis = 0;
+    rotationMatrix.row(axis).cwiseAbs().maxCoeff(&sourceAxis);
+    view.axes[axis] = static_cast<size_t>(sourceAxis);
+    view.reversed[axis] = rotationMatrix(axis, sourceAxis) < 0.0f;
+  }
+  return view;
+}
+
 template <class T>
 bool writeOnScaleFile(std::weak_ptr<const DataArray<T>> featureIdsPtr, const StringDataArray& phaseNames, const QString& outputPath, const QString& outputFilePrefix, const IntVec3Type& numKeypoints,
-                      ExportOnScaleTableFile* filter)
+                      int32_t numThreads, ExportOnScaleTableFile* filter)
 {
   auto featureIds = featureIdsPtr.lock();
   if(featureIds == nullptr)
@@ -259,20 +211,6 @@ bool writeOnScaleFile(std::weak_ptr<const DataArray<T>> featureIdsPtr, const Str
     return false;
   }
 
-  DataContainerArray::Pointer dcaRotated = DataContainerArray::New();
-
-  DataContainer::Pointer dcRotated = DataContainer::New(dc->getName());
-  dcRotated->setGeometry(dc->getGeometry()->deepCopy());
-
-  AttributeMatrix::Pointer matrixRotated = AttributeMatrix::New(matrix->getTupleDimensions(), matrix->getName(), matrix->getType());
-
-  IDataArray::Pointer featureIdsRotatedPtr = featureIds->deepCopy();
-  matrixRotated->addOrReplaceAttributeArray(featureIdsRotatedPtr);
-
-  dcRotated->addOrReplaceAttributeMatrix(matrixRotated);
-
-  dcaRotated->addOrReplaceDataContainer(dcRotated);
-
   std::vector<size_t> tupleDims = matrix->getTupleDimensions();
 
   if(tupleDims.size() != 3)
@@ -286,37 +224,26 @@ bool writeOnScaleFile(std::weak_ptr<const DataArray<T>> featureIdsPtr, const Str
 
   std::copy(tupleDims.cbegin(), tupleDims.cend(), dims.begin());
 
+  // OnScale expects the dimensions sorted from largest to smallest. Rather than copying and rotating the data,
+  // the writer reads the feature ids through a view of the grid rotated into that order.
+  OnScaleTableFileWriter::PermutedGridView view;
+  view.sourceDims = dims;
+
   if(!std::is_sorted(dims.cbegin(), dims.cend(), std::greater<size_t>()))
   {
     Eigen::Matrix3f rotationMatrix = determineRotationMatrix(dims);
 
-    int error = rotateData(dcaRotated, rotationMatrix, matrixPath);
-
-    if(error < 0)
-    {
-      QString ss = QObject::tr("Data rotation with RotateSampleRefFrame sub-filter failed with error code %1").arg(error);
-      filter->setErrorCondition(-10115, ss);
-      return false;
-    }
+    view = createPermutedView(dims, rotationMatrix);
   }
 
-  auto featureIdsRotated = matrixRotated->getAttributeArrayAs<DataArray<T>>(featureIdsRotatedPtr->getName());
-
-  if(featureIdsRotated == nullptr)
-  {
-    QString ss = QObject::tr("Failed to obtain data");
-    filter->setErrorCondition(-10116, ss);
-    return false;
-  }
-
-  IGeometryGrid::Pointer geomRotated = dcRotated->getPrereqGeometry<IGeometryGrid>(filter);
-  if(geomRotated == nullptr)
+  IGeometryGrid::Pointer geom = dc->getPrereqGeometry<IGeometryGrid>(filter);
+  if(geom == nullptr)
   {
     QString ss = QObject::tr("The data container '%1' does not have a rectilinear grid or image geometry.");
     filter->setErrorCondition(-10117, ss);
     return false;
   }
-  auto result = OnScaleTableFileWriter::write(geomRotated, phaseNames, *featureIdsRotated, outputPath, outputFilePrefix, numKeypoints);
+  auto result = OnScaleTableFileWriter::write(geom, phaseNames, *featureIds, outputPath, outputFilePrefix, numKeypoints, view, numThreads, [filter]() { return filter->getCancel(); });
 
   int error = result.first;
   QString errorString = result.second;
@@ -403,6 +330,7 @@ void ExportOnScaleTableFile::setupFilterParameters()
   parameters.push_back(SIMPL_NEW_STRING_FP("Output File Prefix", OutputFilePrefix, FilterParameter::Category::Parameter, ExportOnScaleTableFile));
 
   parameters.push_back(SIMPL_NEW_INT_VEC3_FP("Number of Keypoints", NumKeypoints, FilterParameter::Category::Parameter, ExportOnScaleTableFile));
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Number of Writer Threads (0 = All Cores)", NumThreads, FilterParameter::Category::Parameter, ExportOnScaleTableFile));
   parameters.push_back(SeparatorFilterParameter::Create("Ensemble Data", FilterParameter::Category::RequiredArray));
 
   {
@@ -430,6 +358,7 @@ void ExportOnScaleTableFile::readFilterParameters(AbstractFilterParametersReader
   setOutputPath(reader->readString("OutputPath", getOutputPath()));
   setOutputFilePrefix(reader->readString("OutputFilePrefix", getOutputFilePrefix()));
   setNumKeypoints(reader->readIntVec3("NumKeypoints", getNumKeypoints()));
+  setNumThreads(reader->readValue("NumThreads", getNumThreads()));
   setPzflexFeatureIdsArrayPath(reader->readDataArrayPath("PzflexFeatureIdsArrayPath", getPzflexFeatureIdsArrayPath()));
   setPhaseNamesArrayPath(reader->readDataArrayPath("PhaseNamesArrayPath", getPhaseNamesArrayPath()));
   reader->closeFilterGroup();
@@ -449,6 +378,12 @@ void ExportOnScaleTableFile::dataCheck()
     setErrorCondition(-10100, ss);
   }
 
+  if(m_NumThreads < 0)
+  {
+    QString ss = QObject::tr("The number of writer threads must be 0 (all cores) or greater");
+    setErrorCondition(-10119, ss);
+  }
+
   QDir dir(m_OutputPath);
   if(!dir.exists())
   {
@@ -563,56 +498,56 @@ void ExportOnScaleTableFile::execute()
 
   if(p_Impl->m_Type == SIMPL::TypeNames::Int8)
   {
-    if(!writeOnScaleFile(p_Impl->m_FeatureIds8Ptr, *phaseNames, m_OutputPath, m_OutputFilePrefix, m_NumKeypoints, this))
+    if(!writeOnScaleFile(p_Impl->m_FeatureIds8Ptr, *phaseNames, m_OutputPath, m_OutputFilePrefix, m_NumKeypoints, m_NumThreads, this))
     {
       return;
     }
   }
   else if(p_Impl->m_Type == SIMPL::TypeNames::Int16)
   {
-    if(!writeOnScaleFile(p_Impl->m_FeatureIds16Ptr, *phaseNames, m_OutputPath, m_OutputFilePrefix, m_NumKeypoints, this))
+    if(!writeOnScaleFile(p_Impl->m_FeatureIds16Ptr, *phaseNames, m_OutputPath, m_OutputFilePrefix, m_NumKeypoints, m_NumThreads, this))
     {
       return;
     }
   }
   else if(p_Impl->m_Type == SIMPL::TypeNames::Int32)
   {
-    if(!writeOnScaleFile(p_Impl->m_FeatureIds32Ptr, *phaseNames, m_OutputPath, m_OutputFilePrefix, m_NumKeypoints, this))
+    if(!writeOnScaleFile(p_Impl->m_FeatureIds32Ptr, *phaseNames, m_OutputPath, m_OutputFilePrefix, m_NumKeypoints, m_NumThreads, this))
     {
       return;
     }
   }
   else if(p_Impl->m_Type == SIMPL::TypeNames::Int64)
   {
-    if(!writeOnScaleFile(p_Impl->m_FeatureIds64Ptr, *phaseNames, m_OutputPath, m_OutputFilePrefix, m_NumKeypoints, this))
+    if(!writeOnScaleFile(p_Impl->m_FeatureIds64Ptr, *phaseNames, m_OutputPath, m_OutputFilePrefix, m_NumKeypoints, m_NumThreads, this))
     {
       return;
     }
   }
   else if(p_Impl->m_Type == SIMPL::TypeNames::UInt8)
   {
-    if(!writeOnScaleFile(p_Impl->m_FeatureIdsU8Ptr, *phaseNames, m_OutputPath, m_OutputFilePrefix, m_NumKeypoints, this))
+    if(!writeOnScaleFile(p_Impl->m_FeatureIdsU8Ptr, *phaseNames, m_OutputPath, m_OutputFilePrefix, m_NumKeypoints, m_NumThreads, this))
     {
       return;
     }
   }
   else if(p_Impl->m_Type == SIMPL::TypeNames::UInt16)
   {
-    if(!writeOnScaleFile(p_Impl->m_FeatureIdsU16Ptr, *phaseNames, m_OutputPath, m_OutputFilePrefix, m_NumKeypoints, this))
+    if(!writeOnScaleFile(p_Impl->m_FeatureIdsU16Ptr, *phaseNames, m_OutputPath, m_OutputFilePrefix, m_NumKeypoints, m_NumThreads, this))
     {
       return;
     }
   }
   else if(p_Impl->m_Type == SIMPL::TypeNames::UInt32)
   {
-    if(!writeOnScaleFile(p_Impl->m_FeatureIdsU32Ptr, *phaseNames, m_OutputPath, m_OutputFilePrefix, m_NumKeypoints, this))
+    if(!writeOnScaleFile(p_Impl->m_FeatureIdsU32Ptr, *phaseNames, m_OutputPath, m_OutputFilePrefix, m_NumKeypoints, m_NumThreads, this))
     {
       return;
     }
   }
   else if(p_Impl->m_Type == SIMPL::TypeNames::UInt64)
   {
-    if(!writeOnScaleFile(p_Impl->m_FeatureIdsU64Ptr, *phaseNames, m_OutputPath, m_OutputFilePrefix, m_NumKeypoints, this))
+    if(!writeOnScaleFile(p_Impl->m_FeatureIdsU64Ptr, *phaseNames, m_OutputPath, m_OutputFilePrefix, m_NumKeypoints, m_NumThreads, this))
     {
       return;
     }
@@ -755,6 +690,18 @@ IntVec3Type ExportOnScaleTableFile::getNumKeypoints() const
   return m_NumKeypoints;
 }
 
+// -----------------------------------------------------------------------------
+void ExportOnScaleTableFile::setNumThreads(int value)
+{
+  m_NumThreads = value;
+}
+
+// -----------------------------------------------------------------------------
+int ExportOnScaleTableFile::getNumThreads() const
+{
+  return m_NumThreads;
+}
+
 // -----------------------------------------------------------------------------
 void ExportOnScaleTableFile::setPhaseNamesArrayPath(const DataArrayPath& value)
 {
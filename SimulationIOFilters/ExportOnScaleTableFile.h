@@ -58,6 +58,7 @@ class SimulationIO_EXPORT ExportOnScaleTableFile : public AbstractFilter
   PYB11_PROPERTY(QString OutputFilePrefix READ getOutputFilePrefix WRITE setOutputFilePrefix)
   PYB11_PROPERTY(DataArrayPath PzflexFeatureIdsArrayPath READ getPzflexFeatureIdsArrayPath WRITE setPzflexFeatureIdsArrayPath)
   PYB11_PROPERTY(IntVec3Type NumKeypoints READ getNumKeypoints WRITE setNumKeypoints)
+  PYB11_PROPERTY(int NumThreads READ getNumThreads WRITE setNumThreads)
   PYB11_PROPERTY(DataArrayPath PhaseNamesArrayPath READ getPhaseNamesArrayPath WRITE setPhaseNamesArrayPath)
   PYB11_END_BINDINGS()
   // End Python bindings declarations
@@ -136,6 +137,19 @@ public:
   void setNumKeypoints(const IntVec3Type& value);
   Q_PROPERTY(IntVec3Type NumKeypoints READ getNumKeypoints WRITE setNumKeypoints)
 
+  /**
+   * @brief Getter property for NumThreads
+   * @return
+   */
+  int getNumThreads() const;
+
+  /**
+   * @brief Setter property for NumThreads
+   * @param value
+   */
+  void setNumThreads(int value);
+  Q_PROPERTY(int NumThreads READ getNumThreads WRITE setNumThreads)
+
   /**
    * @brief Getter property for PhaseNamesArrayPath
    * @return
@@ -232,6 +246,7 @@ private:
   QString m_OutputFilePrefix;
   DataArrayPath m_PzflexFeatureIdsArrayPath = DataArrayPath(SIMPL::Defaults::ImageDataContainerName, SIMPL::Defaults::CellAttributeMatrixName, SIMPL::CellData::FeatureIds);
   IntVec3Type m_NumKeypoints = {2, 2, 2};
+  int m_NumThreads = 0;
   DataArrayPath m_PhaseNamesArrayPath = DataArrayPath(SIMPL::Defaults::ImageDataContainerName, SIMPL::Defaults::EnsembleAttributeMatrixName, SIMPL::EnsembleData::PhaseName);
 
 public:
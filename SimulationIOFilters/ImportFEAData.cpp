@@ -4,6 +4,8 @@
 
 #include "ImportFEAData.h"
 
+#include <algorithm>
+
 #include <QtCore/QDir>
 #include <QtCore/QFile>
 #include <QtCore/QFileInfo>
@@ -44,7 +46,15 @@
 #include "SimulationIO/SimulationIOConstants.h"
 #include "SimulationIO/SimulationIOVersion.h"
 
+#include "SimulationIO/SimulationIOFilters/Utility/AbaqusBulkDataReader.h"
+#include "SimulationIO/SimulationIOFilters/Utility/AbaqusDatReader.h"
+#include "SimulationIO/SimulationIOFilters/Utility/AbaqusFilReader.h"
+#include "SimulationIO/SimulationIOFilters/Utility/AbaqusResultCache.h"
+#include "SimulationIO/SimulationIOFilters/Utility/MappedTextReader.hpp"
+
 #define READ_DEF_PT_TRACKING_TIME_INDEX "Time Index"
+#define READ_ABQ_FRAME_NUMBER "Frame Number"
+#define READ_ABQ_FRAME_VALUE "Frame Value"
 
 // -----------------------------------------------------------------------------
 //
@@ -110,11 +120,12 @@ void ImportFEAData::initialize()
     m_InStream.close();
   }
   m_DataTypes.clear();
-  m_NamePointerMap.clear();
+  m_ColumnPlan.clear();
   m_NumBlocks = 0;
   m_NumPoints = 0;
   m_NumTimeSteps = 0;
   m_LinesPerBlock = 0;
+  m_TimeStepIndex = DeformPointTrackIndex::Index();
   m_HeaderIsComplete = false;
   m_selectedTimeStepValue = 0;
   m_selectedTimeStep = false;
@@ -140,7 +151,8 @@ void ImportFEAData::setupFilterParameters()
     choices.push_back("DEFORM");
     choices.push_back("DEFORM_POINT_TRACK");
     parameter->setChoices(choices);
-    std::vector<QString> linkedProps = {"odbName", "odbFilePath", "ABQPythonCommand", "InstanceName", "Step", "FrameNumber",
+    std::vector<QString> linkedProps = {"odbName", "odbFilePath", "ABQPythonCommand", "InstanceName", "Step", "FrameNumber", "ABQExtractionMode", "ABQImportFrameRange", "ABQLastFrameNumber", "ABQFrameStride",
+                                        "ABQUseResultCache", "ABQCacheDirectory", "ABQCacheSizeLimit", "ABQFilStepNumber", "ABQFilIncrement",
                                         //	       "OutputVariable",
                                         //   "ElementSet",
                                         "DEFORMInputFile", "BSAMInputFile", "DEFORMPointTrackInputFile", "ImportSingleTimeStep", "SingleTimeStepValue", "TimeSeriesBundleName"};
@@ -157,6 +169,38 @@ void ImportFEAData::setupFilterParameters()
     parameters.push_back(SIMPL_NEW_STRING_FP("Step", Step, FilterParameter::Category::Parameter, ImportFEAData, {0}));
     parameters.push_back(SIMPL_NEW_INTEGER_FP("Frame Number", FrameNumber, FilterParameter::Category::Parameter, ImportFEAData, {0}));
   }
+  {
+    ChoiceFilterParameter::Pointer parameter = ChoiceFilterParameter::New();
+    parameter->setHumanLabel("Extraction Mode");
+    parameter->setPropertyName("ABQExtractionMode");
+    parameter->setSetterCallback(SIMPL_BIND_SETTER(ImportFEAData, this, ABQExtractionMode));
+    parameter->setGetterCallback(SIMPL_BIND_GETTER(ImportFEAData, this, ABQExtractionMode));
+    std::vector<QString> choices;
+    choices.push_back("Text (odbtotxt.dat)");
+    choices.push_back("Binary Bulk Data (odbtobin.json)");
+    choices.push_back("Text Stream (standard output)");
+    choices.push_back("Results File (.fil)");
+    parameter->setChoices(choices);
+    parameter->setGroupIndices({0});
+    parameter->setCategory(FilterParameter::Category::Parameter);
+    parameters.push_back(parameter);
+  }
+  {
+    parameters.push_back(SIMPL_NEW_INTEGER_FP("Results File Step", ABQFilStepNumber, FilterParameter::Category::Parameter, ImportFEAData, {0}));
+    parameters.push_back(SIMPL_NEW_INTEGER_FP("Results File Increment (0 = Last)", ABQFilIncrement, FilterParameter::Category::Parameter, ImportFEAData, {0}));
+  }
+  {
+    std::vector<QString> linkedProps = {"ABQLastFrameNumber", "ABQFrameStride"};
+    parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Import Frame Range", ABQImportFrameRange, FilterParameter::Category::Parameter, ImportFEAData, linkedProps, {0}));
+    parameters.push_back(SIMPL_NEW_INTEGER_FP("Last Frame Number", ABQLastFrameNumber, FilterParameter::Category::Parameter, ImportFEAData, {0}));
+    parameters.push_back(SIMPL_NEW_INTEGER_FP("Frame Stride", ABQFrameStride, FilterParameter::Category::Parameter, ImportFEAData, {0}));
+  }
+  {
+    std::vector<QString> linkedProps = {"ABQCacheDirectory", "ABQCacheSizeLimit"};
+    parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Cache Extracted Results", ABQUseResultCache, FilterParameter::Category::Parameter, ImportFEAData, linkedProps, {0}));
+    parameters.push_back(SIMPL_NEW_OUTPUT_PATH_FP("Cache Directory", ABQCacheDirectory, FilterParameter::Category::Parameter, ImportFEAData, {0}));
+    parameters.push_back(SIMPL_NEW_INTEGER_FP("Cache Size Limit (MB)", ABQCacheSizeLimit, FilterParameter::Category::Parameter, ImportFEAData, {0}));
+  }
 
   {
     parameters.push_back(SIMPL_NEW_INPUT_FILE_FP("Input File", BSAMInputFile, FilterParameter::Category::Parameter, ImportFEAData, "", "*.DAT", {1}));
@@ -175,7 +219,10 @@ void ImportFEAData::setupFilterParameters()
     parameters.push_back(SIMPL_NEW_INTEGER_FP("Time Step", SingleTimeStepValue, FilterParameter::Category::Parameter, ImportFEAData, {3}));
 
     parameters.push_back(SeparatorFilterParameter::Create("", FilterParameter::Category::CreatedArray));
-    parameters.push_back(SIMPL_NEW_STRING_FP("Time Series Bundle Name", TimeSeriesBundleName, FilterParameter::Category::CreatedArray, ImportFEAData, {3}));
+    // Also names the bundle of an ABAQUS frame range
+    FilterParameter::Pointer bundleNameParameter = SIMPL_NEW_STRING_FP("Time Series Bundle Name", TimeSeriesBundleName, FilterParameter::Category::CreatedArray, ImportFEAData);
+    bundleNameParameter->setGroupIndices({0, 3});
+    parameters.push_back(bundleNameParameter);
   }
 
   parameters.push_back(SIMPL_NEW_STRING_FP("Data Container Name", DataContainerName, FilterParameter::Category::CreatedArray, ImportFEAData));
@@ -198,6 +245,15 @@ void ImportFEAData::readFilterParameters(AbstractFilterParametersReader* reader,
   setInstanceName(reader->readString("InstanceName", getInstanceName()));
   setStep(reader->readString("Step", getStep()));
   setFrameNumber(reader->readValue("FrameNumber", getFrameNumber()));
+  setABQExtractionMode(reader->readValue("ABQExtractionMode", getABQExtractionMode()));
+  setABQImportFrameRange(reader->readValue("ABQImportFrameRange", getABQImportFrameRange()));
+  setABQLastFrameNumber(reader->readValue("ABQLastFrameNumber", getABQLastFrameNumber()));
+  setABQFrameStride(reader->readValue("ABQFrameStride", getABQFrameStride()));
+  setABQUseResultCache(reader->readValue("ABQUseResultCache", getABQUseResultCache()));
+  setABQCacheDirectory(reader->readString("ABQCacheDirectory", getABQCacheDirectory()));
+  setABQCacheSizeLimit(reader->readValue("ABQCacheSizeLimit", getABQCacheSizeLimit()));
+  setABQFilStepNumber(reader->readValue("ABQFilStepNumber", getABQFilStepNumber()));
+  setABQFilIncrement(reader->readValue("ABQFilIncrement", getABQFilIncrement()));
   setDEFORMInputFile(reader->readString("InputFile", getDEFORMInputFile()));
   setBSAMInputFile(reader->readString("InputFile", getBSAMInputFile()));
   setDataContainerName(reader->readString("DataContainerName", getDataContainerName()));
@@ -228,14 +284,82 @@ void ImportFEAData::dataCheck()
   case 0:
   {
 
-    QStringList arguments = splitArgumentsString(m_ABQPythonCommand);
-    if(arguments.empty())
+    // The results file is read natively, without ABAQUS
+    if(m_ABQExtractionMode == 3)
+    {
+      if(!QFileInfo(abqFilFile()).isFile())
+      {
+        QString ss = QObject::tr("The ABAQUS results file '%1' does not exist").arg(abqFilFile());
+        setErrorCondition(-4015, ss);
+        return;
+      }
+      if(m_ABQFilStepNumber < 1 || m_ABQFilIncrement < 0)
+      {
+        QString ss = QObject::tr("The results file step must be at least 1 and the increment at least 0");
+        setErrorCondition(-4016, ss);
+        return;
+      }
+    }
+    else if(splitArgumentsString(m_ABQPythonCommand).empty())
     {
       QString ss = QObject::tr("Abaqus python command to run a script has not been specified.");
       setErrorCondition(-4001, ss);
       return;
     }
 
+    if(m_ABQUseResultCache && m_ABQCacheSizeLimit < 1)
+    {
+      QString ss = QObject::tr("The ABAQUS result cache size limit must be at least 1 MB");
+      setErrorCondition(-4014, ss);
+      return;
+    }
+
+    if(m_ABQImportFrameRange)
+    {
+      if(m_ABQExtractionMode != 1)
+      {
+        QString ss = QObject::tr("Importing a frame range requires the Binary Bulk Data extraction mode");
+        setErrorCondition(-4012, ss);
+        return;
+      }
+      if(m_ABQFrameStride < 1 || m_ABQLastFrameNumber < m_FrameNumber)
+      {
+        QString ss = QObject::tr("The frame range from %1 to %2 in steps of %3 does not contain any frames").arg(m_FrameNumber).arg(m_ABQLastFrameNumber).arg(m_ABQFrameStride);
+        setErrorCondition(-4011, ss);
+        return;
+      }
+
+      DataContainerBundle::Pointer dcb = DataContainerBundle::New(getTimeSeriesBundleName());
+      getDataContainerArray()->addDataContainerBundle(dcb);
+      QStringList metaArrayList;
+      metaArrayList << READ_ABQ_FRAME_NUMBER << READ_ABQ_FRAME_VALUE;
+      dcb->setMetaDataArrays(metaArrayList);
+
+      // One Data Container per frame; execute gives them all the same geometry
+      for(int frameNum : abqFrameNumbers())
+      {
+        DataContainer::Pointer m = getDataContainerArray()->createNonPrereqDataContainer(this, abqFrameDataContainerName(frameNum));
+        if(getErrorCode() < 0)
+        {
+          return;
+        }
+
+        std::vector<size_t> tDims(1, 0);
+        m->createNonPrereqAttributeMatrix(this, getVertexAttributeMatrixName(), tDims, AttributeMatrix::Type::Vertex);
+        m->createNonPrereqAttributeMatrix(this, getCellAttributeMatrixName(), tDims, AttributeMatrix::Type::Cell);
+        AttributeMatrix::Pointer metaData = m->createNonPrereqAttributeMatrix(this, m_BundleMetaDataAMName, std::vector<size_t>(1, 1), AttributeMatrix::Type::MetaData);
+        if(getErrorCode() < 0)
+        {
+          return;
+        }
+
+        std::vector<size_t> cDims(1, 1);
+        metaData->createNonPrereqArray<Int32ArrayType>(this, READ_ABQ_FRAME_NUMBER, frameNum, cDims);
+        metaData->createNonPrereqArray<FloatArrayType>(this, READ_ABQ_FRAME_VALUE, 0.0f, cDims);
+      }
+      break;
+    }
+
     // Create the output Data Container
     DataContainer::Pointer m = getDataContainerArray()->createNonPrereqDataContainer(this, getDataContainerName());
     if(getErrorCode() < 0)
@@ -425,13 +549,10 @@ void ImportFEAData::dataCheck()
         return;
       }
 
-      QMapIterator<QString, SimulationIO::DeformDataParser::Pointer> parserIter(m_NamePointerMap);
-      while(parserIter.hasNext())
+      for(const auto& column : m_ColumnPlan.columns())
       {
-        parserIter.next();
-        QString name = parserIter.key();
-        SimulationIO::DeformDataParser::Pointer parser = parserIter.value();
-        IDataArray::Pointer dataPtr = parser->initializeNewDataArray(m_NumPoints, name, !getInPreflight()); // Get a copy of the DataArray
+        const QString& name = column.name;
+        IDataArray::Pointer dataPtr = SimulationIO::DeformColumnPlan::createArray(column, m_NumPoints, !getInPreflight());
 
         if((getInPreflight()))
         {
@@ -483,6 +604,15 @@ void ImportFEAData::execute()
   {
   case 0: // ABAQUS
   {
+    if(m_ABQExtractionMode == 3)
+    {
+      DataContainer::Pointer m = getDataContainerArray()->getDataContainer(getDataContainerName());
+      AttributeMatrix::Pointer vertexAttrMat = m->getAttributeMatrix(getVertexAttributeMatrixName());
+      AttributeMatrix::Pointer cellAttrMat = m->getAttributeMatrix(getCellAttributeMatrixName());
+      AbaqusFilReader::read(this, abqFilFile(), m_ABQFilStepNumber, m_ABQFilIncrement, *m, *vertexAttrMat, *cellAttrMat);
+      break;
+    }
+
     // Check Output Path
     QDir dir;
     if(!dir.mkpath(m_odbFilePath))
@@ -492,10 +622,26 @@ void ImportFEAData::execute()
       return;
     }
 
+    QString odbNamewExt = m_odbName + ".odb";
+    std::vector<int> frameNumbers = abqFrameNumbers();
+
+    // Results extracted from the same odb before are read back from the cache instead of starting ABAQUS again
+    AbaqusResultCache cache(abqCacheDirectory(), static_cast<qint64>(m_ABQCacheSizeLimit) * 1024 * 1024);
+    QString cacheKey = m_ABQUseResultCache ? AbaqusResultCache::key(m_odbFilePath + QDir::separator() + odbNamewExt, m_ABQExtractionMode, m_InstanceName, m_Step, frameNumbers) : QString();
+    AbaqusBulkDataReader::Data cachedData;
+    if(!cacheKey.isEmpty() && cache.load(this, cacheKey, cachedData))
+    {
+      setABQFrames(cachedData, cache.entryPath(cacheKey));
+      notifyStatusMessage("Read the ABAQUS results from the cache");
+      break;
+    }
+
     // Create ABAQUS python script
     QString abqpyscr = m_odbFilePath + QDir::separator() + m_odbName + ".py";
-    QString odbNamewExt = m_odbName + ".odb";
-    int err = writeABQpyscr(abqpyscr, odbNamewExt, m_odbFilePath, m_InstanceName, m_Step, m_FrameNumber);
+    bool bulkData = m_ABQExtractionMode == 1;
+    bool textStream = m_ABQExtractionMode == 2;
+    int err = bulkData ? writeABQBulkDataPyscr(abqpyscr, odbNamewExt, m_odbFilePath, m_InstanceName, m_Step, frameNumbers.front(), frameNumbers.back(), m_ABQImportFrameRange ? m_ABQFrameStride : 1)
+                       : writeABQpyscr(abqpyscr, odbNamewExt, m_odbFilePath, m_InstanceName, m_Step, m_FrameNumber, textStream);
     if(err < 0)
     {
       QString ss = QObject::tr("Error writing ABAQUS python script '%1'").arg(abqpyscr);
@@ -503,16 +649,52 @@ void ImportFEAData::execute()
       return;
     }
 
-    // Running ABAQUS python script
-    QString abqpyscrwExt = m_odbName + ".py";
-    runABQpyscr(abqpyscrwExt);
+    // A manifest left over from an earlier run must not be mistaken for the output of a failed script
+    QString manifestFile = m_odbFilePath + QDir::separator() + AbaqusBulkDataReader::k_ManifestFileName;
+    if(bulkData)
+    {
+      QFile::remove(manifestFile);
+    }
+
+    if(textStream)
+    {
+      DataContainer::Pointer m = getDataContainerArray()->getDataContainer(getDataContainerName());
+      AttributeMatrix::Pointer vertexAttrMat = m->getAttributeMatrix(getVertexAttributeMatrixName());
+      AttributeMatrix::Pointer cellAttrMat = m->getAttributeMatrix(getCellAttributeMatrixName());
+      streamABQpyscr(m.get(), vertexAttrMat.get(), cellAttrMat.get());
+    }
+    else
+    {
+      // Running ABAQUS python script
+      QString abqpyscrwExt = m_odbName + ".py";
+      runABQpyscr(abqpyscrwExt);
 
-    DataContainer::Pointer m = getDataContainerArray()->getDataContainer(getDataContainerName());
-    AttributeMatrix::Pointer vertexAttrMat = m->getAttributeMatrix(getVertexAttributeMatrixName());
-    AttributeMatrix::Pointer cellAttrMat = m->getAttributeMatrix(getCellAttributeMatrixName());
+      if(m_ABQImportFrameRange)
+      {
+        readABQFrames(manifestFile);
+      }
+      else
+      {
+        DataContainer::Pointer m = getDataContainerArray()->getDataContainer(getDataContainerName());
+        AttributeMatrix::Pointer vertexAttrMat = m->getAttributeMatrix(getVertexAttributeMatrixName());
+        AttributeMatrix::Pointer cellAttrMat = m->getAttributeMatrix(getCellAttributeMatrixName());
+
+        if(bulkData)
+        {
+          AbaqusBulkDataReader::read(this, manifestFile, *m, *vertexAttrMat, *cellAttrMat);
+        }
+        else
+        {
+          QString outTxtFile = m_odbFilePath + QDir::separator() + "odbtotxt.dat";
+          scanABQFile(outTxtFile, m.get(), vertexAttrMat.get(), cellAttrMat.get());
+        }
+      }
+    }
 
-    QString outTxtFile = m_odbFilePath + QDir::separator() + "odbtotxt.dat";
-    scanABQFile(outTxtFile, m.get(), vertexAttrMat.get(), cellAttrMat.get());
+    if(!cacheKey.isEmpty() && getErrorCode() >= 0 && !getCancel())
+    {
+      cache.store(this, cacheKey, abqFramesData());
+    }
 
     break;
   }
@@ -568,7 +750,7 @@ void ImportFEAData::execute()
 //
 // -----------------------------------------------------------------------------
 
-int32_t ImportFEAData::writeABQpyscr(const QString& file, const QString& odbName, const QString& odbFilePath, const QString& instanceName, const QString& step, int frameNum)
+int32_t ImportFEAData::writeABQpyscr(const QString& file, const QString& odbName, const QString& odbFilePath, const QString& instanceName, const QString& step, int frameNum, bool toStandardOutput)
 {
   int32_t err = 0;
   FILE* f = nullptr;
@@ -600,8 +782,15 @@ int32_t ImportFEAData::writeABQpyscr(const QString& file, const QString& odbName
   fprintf(f, "odb = openOdb(path = odbfileName)\n");
   fprintf(f, "\n");
 
-  fprintf(f, "outTxtFile = 'odbtotxt.dat'\n");
-  fprintf(f, "fid = open(outTxtFile, \"a\")\n");
+  if(toStandardOutput)
+  {
+    fprintf(f, "fid = stdout\n");
+  }
+  else
+  {
+    fprintf(f, "outTxtFile = 'odbtotxt.dat'\n");
+    fprintf(f, "fid = open(outTxtFile, \"w\")\n");
+  }
   fprintf(f, "\n");
 
   fprintf(f, "E1 = odb.rootAssembly.instances[instanceName]\n");
@@ -670,696 +859,565 @@ int32_t ImportFEAData::writeABQpyscr(const QString& file, const QString& odbName
   fprintf(f, "                          fid.write(str(component)),\n");
   fprintf(f, "                          fid.write(' ')\n");
   fprintf(f, "                  fid.write('\\n')\n");
-  fprintf(f, "fid.close()");
+  if(toStandardOutput)
+  {
+    fprintf(f, "fid.flush()\n");
+  }
+  else
+  {
+    fprintf(f, "fid.close()\n");
+  }
   notifyStatusMessage("Finished writing ABAQUS python script");
   fclose(f);
 
   return err;
 }
 
+// -----------------------------------------------------------------------------
 //
-//
-//
+// -----------------------------------------------------------------------------
 
-void ImportFEAData::runABQpyscr(const QString& file)
+int32_t ImportFEAData::writeABQBulkDataPyscr(const QString& file, const QString& odbName, const QString& odbFilePath, const QString& instanceName, const QString& step, int firstFrame, int lastFrame,
+                                             int frameStride)
 {
-  // cmd to run: "abaqus python filename.py
+  FILE* f = nullptr;
+  f = fopen(file.toLatin1().data(), "wb");
+  if(nullptr == f)
+  {
+    return -1;
+  }
 
-  QStringList arguments = splitArgumentsString(m_ABQPythonCommand);
-  QString program = arguments[0];
+  fprintf(f, "from odbAccess import *\n");
+  fprintf(f, "from abaqusConstants import *\n");
+  fprintf(f, "\n");
+  fprintf(f, "import json\n");
+  fprintf(f, "import os\n");
+  fprintf(f, "import sys\n");
+  fprintf(f, "import numpy\n");
+  fprintf(f, "\n");
 
-  arguments.removeAt(0);
+  fprintf(f, "odbName = '%s'\n", odbName.toLatin1().data());
+  fprintf(f, "odbFilePath = '%s'\n", odbFilePath.toLatin1().data());
+  fprintf(f, "firstFrame = %d\n", firstFrame);
+  fprintf(f, "lastFrame = %d\n", lastFrame);
+  fprintf(f, "frameStride = %d\n", frameStride);
+  fprintf(f, "step = '%s'\n", step.toLatin1().data());
+  fprintf(f, "instanceName = '%s'\n", instanceName.toLatin1().data());
+  fprintf(f, "manifestFile = '%s'\n", AbaqusBulkDataReader::k_ManifestFileName.toLatin1().data());
+  fprintf(f, "\n");
 
-  m_ProcessPtr = QSharedPointer<QProcess>(new QProcess(nullptr));
-  qRegisterMetaType<QProcess::ExitStatus>("QProcess::ExitStatus");
-  qRegisterMetaType<QProcess::ProcessError>("QProcess::ProcessError");
-  connect(m_ProcessPtr.data(), SIGNAL(finished(int, QProcess::ExitStatus)), this, SLOT(processHasFinished(int, QProcess::ExitStatus)), Qt::QueuedConnection);
-  connect(m_ProcessPtr.data(), SIGNAL(error(QProcess::ProcessError)), this, SLOT(processHasErroredOut(QProcess::ProcessError)), Qt::QueuedConnection);
-  connect(m_ProcessPtr.data(), SIGNAL(readyReadStandardError()), this, SLOT(sendErrorOutput()), Qt::QueuedConnection);
-  connect(m_ProcessPtr.data(), SIGNAL(readyReadStandardOutput()), this, SLOT(sendStandardOutput()), Qt::QueuedConnection);
+  fprintf(f, "odbfileName = os.path.join(odbFilePath,odbName)\n");
+  fprintf(f, "odb = openOdb(path = odbfileName, readOnly = True)\n");
+  fprintf(f, "\n");
 
-  m_ProcessPtr->setWorkingDirectory(m_odbFilePath);
-  m_ProcessPtr->start(program, arguments);
-  m_ProcessPtr->waitForStarted(2000);
-  m_ProcessPtr->waitForFinished(-1);
+  // Every array is written with numpy tofile instead of converting each value with str()
+  fprintf(f, "def dump(values, fileName, dtype):\n");
+  fprintf(f, "    numpy.ascontiguousarray(values, dtype = dtype).tofile(fileName)\n");
+  fprintf(f, "    return fileName\n");
+  fprintf(f, "\n");
+  fprintf(f, "def concatenate(arrays, dtype):\n");
+  fprintf(f, "    return numpy.concatenate([numpy.asarray(a, dtype = dtype).reshape(-1) for a in arrays])\n");
+  fprintf(f, "\n");
+  fprintf(f, "E1 = odb.rootAssembly.instances[instanceName]\n");
+  fprintf(f, "manifest = {'version': 1, 'byteOrder': sys.byteorder}\n");
+  fprintf(f, "\n");
+  fprintf(f, "manifest['elementType'] = str(E1.elements[0].type)\n");
+  fprintf(f, "manifest['numElements'] = len(E1.elements)\n");
+  fprintf(f, "manifest['nodesPerElement'] = len(E1.elements[0].connectivity)\n");
+  fprintf(f, "manifest['elementLabels'] = dump([element.label for element in E1.elements], 'odbtobin_elementLabels.bin', numpy.int32)\n");
+  fprintf(f, "manifest['connectivity'] = dump([element.connectivity for element in E1.elements], 'odbtobin_connectivity.bin', numpy.int32)\n");
+  fprintf(f, "\n");
+  fprintf(f, "manifest['numNodes'] = len(E1.nodes)\n");
+  fprintf(f, "manifest['numCoords'] = len(E1.nodes[0].coordinates)\n");
+  fprintf(f, "manifest['nodeLabels'] = dump([node.label for node in E1.nodes], 'odbtobin_nodeLabels.bin', numpy.int32)\n");
+  fprintf(f, "manifest['coordinates'] = dump([node.coordinates for node in E1.nodes], 'odbtobin_coordinates.bin', numpy.float32)\n");
+  fprintf(f, "\n");
+  fprintf(f, "frames = []\n");
+  fprintf(f, "for frameNum in range(firstFrame, lastFrame + 1, frameStride):\n");
+  fprintf(f, "    odbFrame = odb.steps[step].frames[frameNum]\n");
+  fprintf(f, "    fields = []\n");
+  fprintf(f, "    for index, f in enumerate(odbFrame.fieldOutputs.values()):\n");
+  fprintf(f, "        blocks = f.getSubset(region=E1).bulkDataBlocks\n");
+  fprintf(f, "        if len(blocks) == 0:\n");
+  fprintf(f, "            continue\n");
+  fprintf(f, "        pos = blocks[0].position\n");
+  fprintf(f, "        field = {'name': f.name, 'type': str(f.type), 'position': str(pos)}\n");
+  fprintf(f, "        fields.append(field)\n");
+  fprintf(f, "        if pos != NODAL and pos != INTEGRATION_POINT:\n");
+  fprintf(f, "            continue\n");
+  fprintf(f, "        data = numpy.concatenate([numpy.asarray(block.data, dtype = numpy.float32).reshape(len(block.data), -1) for block in blocks])\n");
+  fprintf(f, "        prefix = 'odbtobin_frame%%d_field%%d_' %% (frameNum, index)\n");
+  fprintf(f, "        field['numValues'] = int(data.shape[0])\n");
+  fprintf(f, "        field['numComponents'] = int(data.shape[1])\n");
+  fprintf(f, "        field['data'] = dump(data, prefix + 'data.bin', numpy.float32)\n");
+  fprintf(f, "        if pos == NODAL:\n");
+  fprintf(f, "            field['labels'] = dump(concatenate([block.nodeLabels for block in blocks], numpy.int32), prefix + 'labels.bin', numpy.int32)\n");
+  fprintf(f, "        else:\n");
+  fprintf(f, "            field['labels'] = dump(concatenate([block.elementLabels for block in blocks], numpy.int32), prefix + 'labels.bin', numpy.int32)\n");
+  fprintf(f, "            field['integrationPoints'] = dump(concatenate([block.integrationPoints for block in blocks], numpy.int32), prefix + 'integrationPoints.bin', numpy.int32)\n");
+  fprintf(f, "    frames.append({'frame': frameNum, 'frameValue': float(odbFrame.frameValue), 'fields': fields})\n");
+  fprintf(f, "manifest['frames'] = frames\n");
+  fprintf(f, "\n");
+  fprintf(f, "fid = open(manifestFile, 'w')\n");
+  fprintf(f, "json.dump(manifest, fid, indent = 1)\n");
+  fprintf(f, "fid.close()\n");
+  fprintf(f, "odb.close()\n");
+  notifyStatusMessage("Finished writing ABAQUS python script");
+  fclose(f);
 
-  notifyStatusMessage("Finished running ABAQUS python script");
+  return 0;
 }
 
+// -----------------------------------------------------------------------------
 //
+// -----------------------------------------------------------------------------
+std::vector<int> ImportFEAData::abqFrameNumbers() const
+{
+  std::vector<int> frameNumbers;
+  if(!m_ABQImportFrameRange || m_ABQFrameStride < 1)
+  {
+    frameNumbers.push_back(m_FrameNumber);
+    return frameNumbers;
+  }
+  for(int frameNum = m_FrameNumber; frameNum <= m_ABQLastFrameNumber; frameNum += m_ABQFrameStride)
+  {
+    frameNumbers.push_back(frameNum);
+  }
+  return frameNumbers;
+}
+
+// -----------------------------------------------------------------------------
 //
+// -----------------------------------------------------------------------------
+QString ImportFEAData::abqFrameDataContainerName(int frameNum) const
+{
+  return getDataContainerName() + "_" + QString::number(frameNum);
+}
+
+// -----------------------------------------------------------------------------
 //
+// -----------------------------------------------------------------------------
+void ImportFEAData::readABQFrames(const QString& manifestFile)
+{
+  AbaqusBulkDataReader::Data data;
+  if(!AbaqusBulkDataReader::read(this, manifestFile, data))
+  {
+    return;
+  }
+  setABQFrames(data, manifestFile);
+}
 
-QStringList ImportFEAData::splitArgumentsString(QString arguments)
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ImportFEAData::setABQFrames(const AbaqusBulkDataReader::Data& data, const QString& source)
 {
-  QStringList argumentList;
-  for(int i = 0; i < m_ABQPythonCommand.size(); i++)
+  if(!m_ABQImportFrameRange)
   {
-    if(m_ABQPythonCommand[i] == '\"')
+    if(data.frames.empty())
     {
-      i++;
-      int start = i;
-      int index = m_ABQPythonCommand.indexOf("\"", start);
-      if(index == -1)
+      QString ss = QObject::tr("Frame %1 of step '%2' is missing from '%3'").arg(m_FrameNumber).arg(m_Step, source);
+      setErrorCondition(-4013, ss);
+      return;
+    }
+
+    DataContainer::Pointer m = getDataContainerArray()->getDataContainer(getDataContainerName());
+    m->setGeometry(data.geometry);
+
+    AttributeMatrix::Pointer vertexAttrMat = m->getAttributeMatrix(getVertexAttributeMatrixName());
+    vertexAttrMat->resizeAttributeArrays(std::vector<size_t>(1, data.numVerts));
+    for(const FloatArrayType::Pointer& array : data.frames.front().vertexArrays)
+    {
+      vertexAttrMat->insertOrAssign(array);
+    }
+
+    AttributeMatrix::Pointer cellAttrMat = m->getAttributeMatrix(getCellAttributeMatrixName());
+    cellAttrMat->resizeAttributeArrays(std::vector<size_t>(1, data.numCells));
+    for(const FloatArrayType::Pointer& array : data.frames.front().cellArrays)
+    {
+      cellAttrMat->insertOrAssign(array);
+    }
+    return;
+  }
+
+  IDataContainerBundle::Pointer bundle = getDataContainerArray()->getDataContainerBundle(getTimeSeriesBundleName());
+  for(int frameNum : abqFrameNumbers())
+  {
+    auto isFrame = [frameNum](const AbaqusBulkDataReader::Frame& frame) { return frame.frameNumber == frameNum; };
+    auto frame = std::find_if(data.frames.cbegin(), data.frames.cend(), isFrame);
+    if(frame == data.frames.cend())
+    {
+      QString ss = QObject::tr("Frame %1 of step '%2' is missing from '%3'").arg(frameNum).arg(m_Step, source);
+      setErrorCondition(-4013, ss);
+      return;
+    }
+
+    DataContainer::Pointer m = getDataContainerArray()->getDataContainer(abqFrameDataContainerName(frameNum));
+    m->setGeometry(data.geometry);
+
+    AttributeMatrix::Pointer vertexAttrMat = m->getAttributeMatrix(getVertexAttributeMatrixName());
+    vertexAttrMat->resizeAttributeArrays(std::vector<size_t>(1, data.numVerts));
+    for(const FloatArrayType::Pointer& array : frame->vertexArrays)
+    {
+      vertexAttrMat->insertOrAssign(array);
+    }
+
+    AttributeMatrix::Pointer cellAttrMat = m->getAttributeMatrix(getCellAttributeMatrixName());
+    cellAttrMat->resizeAttributeArrays(std::vector<size_t>(1, data.numCells));
+    for(const FloatArrayType::Pointer& array : frame->cellArrays)
+    {
+      cellAttrMat->insertOrAssign(array);
+    }
+
+    AttributeMatrix::Pointer metaData = m->getAttributeMatrix(m_BundleMetaDataAMName);
+    metaData->getAttributeArrayAs<FloatArrayType>(READ_ABQ_FRAME_VALUE)->setValue(0, frame->frameValue);
+
+    if(nullptr != bundle.get())
+    {
+      bundle->addOrReplaceDataContainer(m);
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+AbaqusBulkDataReader::Data ImportFEAData::abqFramesData() const
+{
+  AbaqusBulkDataReader::Data data;
+  std::vector<int> frameNumbers = abqFrameNumbers();
+  for(int frameNum : frameNumbers)
+  {
+    DataContainer::Pointer m = getDataContainerArray()->getDataContainer(m_ABQImportFrameRange ? abqFrameDataContainerName(frameNum) : getDataContainerName());
+    AttributeMatrix::Pointer vertexAttrMat = m->getAttributeMatrix(getVertexAttributeMatrixName());
+    AttributeMatrix::Pointer cellAttrMat = m->getAttributeMatrix(getCellAttributeMatrixName());
+    data.geometry = m->getGeometry();
+    data.numVerts = vertexAttrMat->getNumberOfTuples();
+    data.numCells = cellAttrMat->getNumberOfTuples();
+
+    AbaqusBulkDataReader::Frame frame;
+    frame.frameNumber = frameNum;
+    if(m_ABQImportFrameRange)
+    {
+      frame.frameValue = m->getAttributeMatrix(m_BundleMetaDataAMName)->getAttributeArrayAs<FloatArrayType>(READ_ABQ_FRAME_VALUE)->getValue(0);
+    }
+    for(const QString& name : vertexAttrMat->getAttributeArrayNames())
+    {
+      FloatArrayType::Pointer array = vertexAttrMat->getAttributeArrayAs<FloatArrayType>(name);
+      if(nullptr != array)
       {
-        index = m_ABQPythonCommand.size();
+        frame.vertexArrays.push_back(array);
       }
-      int end = index - 1;
-      argumentList.push_back(m_ABQPythonCommand.mid(start, end - start + 1));
-      i = index;
     }
-    else
+    for(const QString& name : cellAttrMat->getAttributeArrayNames())
     {
-      int start = i;
-      int index = m_ABQPythonCommand.indexOf(" ", start + 1);
-      if(index == -1)
+      FloatArrayType::Pointer array = cellAttrMat->getAttributeArrayAs<FloatArrayType>(name);
+      if(nullptr != array)
       {
-        index = m_ABQPythonCommand.size();
+        frame.cellArrays.push_back(array);
       }
-      int end = index - 1;
-      argumentList.push_back(m_ABQPythonCommand.mid(start, end - start + 1));
-      i = index;
     }
+    data.frames.push_back(frame);
   }
-
-  return argumentList;
+  return data;
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-
-void ImportFEAData::processHasFinished(int exitCode, QProcess::ExitStatus exitStatus)
+QString ImportFEAData::abqCacheDirectory() const
 {
-  if(getCancel())
-  {
-  }
-  else if(exitStatus == QProcess::CrashExit)
-  {
-    QString ss = QObject::tr("The process crashed during its exit.");
-    setErrorCondition(-4003, ss);
-  }
-  else if(exitCode < 0)
-  {
-    QString ss = QObject::tr("The process finished with exit code %1.").arg(QString::number(exitCode));
-    setErrorCondition(-4004, ss);
-  }
-  else if(getErrorCode() >= 0)
+  if(m_ABQCacheDirectory.isEmpty())
   {
+    return m_odbFilePath + QDir::separator() + "abqcache";
   }
-
-  m_Pause = false;
-  m_WaitCondition.wakeAll();
+  return m_ABQCacheDirectory;
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
+QString ImportFEAData::abqFilFile() const
+{
+  return m_odbFilePath + QDir::separator() + m_odbName + ".fil";
+}
 
-void ImportFEAData::processHasErroredOut(QProcess::ProcessError error)
+//
+//
+//
+
+void ImportFEAData::runABQpyscr(const QString& file)
 {
-  if(getCancel())
-  {
-    QString ss = QObject::tr("The process was killed by the user.");
-    setWarningCondition(-4004, ss);
-  }
-  else if(error == QProcess::FailedToStart)
-  {
-    QProcessEnvironment env = QProcessEnvironment::systemEnvironment();
-    QString pathEnv = env.value("PATH");
-
-    QString ss = QObject::tr("The process failed to start. Either the invoked program is missing, or you may have insufficient permissions to invoke the program \
-or the path containing the executble is not in the system's environment path. PATH=%1.\n Try using the absolute path to the executable.")
-                     .arg(pathEnv);
-    setErrorCondition(-4005, ss);
-  }
-  else if(error == QProcess::Crashed)
-  {
-    QString ss = QObject::tr("The process crashed some time after starting successfully.");
-    setErrorCondition(-4006, ss);
-  }
-  else if(error == QProcess::Timedout)
-  {
-    QString ss = QObject::tr("The process timed out.");
-    setErrorCondition(-4007, ss);
-  }
-  else if(error == QProcess::WriteError)
-  {
-    QString ss = QObject::tr("An error occurred when attempting to write to the process.");
-    setErrorCondition(-4008, ss);
-  }
-  else if(error == QProcess::ReadError)
-  {
-    QString ss = QObject::tr("An error occurred when attempting to read from the process.");
-    setErrorCondition(-4009, ss);
-  }
-  else
-  {
-    QString ss = QObject::tr("An unknown error occurred.");
-    setErrorCondition(-4010, ss);
-  }
+  // cmd to run: "abaqus python filename.py
+  startABQProcess(true);
+  m_ProcessPtr->waitForFinished(-1);
 
-  m_Pause = false;
-  m_WaitCondition.wakeAll();
+  notifyStatusMessage("Finished running ABAQUS python script");
 }
 
-// -----------------------------------------------------------------------------
 //
-// -----------------------------------------------------------------------------
-
-void ImportFEAData::sendErrorOutput()
-{
-  if(m_ProcessPtr.data() != nullptr)
-  {
-    QString error = m_ProcessPtr->readAllStandardError();
-    if(error[error.size() - 1] == '\n')
-    {
-      error.chop(1);
-    }
-    notifyStatusMessage(error);
-    m_WaitCondition.wakeAll();
-  }
-}
-
-// -----------------------------------------------------------------------------
 //
-// -----------------------------------------------------------------------------
-
-void ImportFEAData::sendStandardOutput()
-{
-  if(m_ProcessPtr.data() != nullptr)
-  {
-    notifyStatusMessage(m_ProcessPtr->readAllStandardOutput());
-    m_WaitCondition.wakeAll();
-  }
-}
-
-// -----------------------------------------------------------------------------
 //
-// -----------------------------------------------------------------------------
 
-void ImportFEAData::scanABQFile(const QString& file, DataContainer* dataContainer, AttributeMatrix* vertexAttrMat, AttributeMatrix* cellAttrMat)
+void ImportFEAData::streamABQpyscr(DataContainer* dataContainer, AttributeMatrix* vertexAttrMat, AttributeMatrix* cellAttrMat)
 {
-  bool allocate = true;
-  size_t numVerts = 0;
-  QString status;
-
-  QFile inStream(file);
+  AbaqusDatReader::StreamParser parser(this, *dataContainer, *vertexAttrMat, *cellAttrMat);
 
-  if(!inStream.open(QIODevice::ReadOnly | QIODevice::Text))
+  // The standard output carries the data, so it is read here instead of being forwarded as status messages
+  startABQProcess(false);
+  if(m_ProcessPtr->state() == QProcess::NotRunning)
   {
-    QString ss = QObject::tr("Input file could not be opened: %1").arg(file);
-    setErrorCondition(-100, ss);
+    // The queued error signal is not delivered while execute() blocks
+    QString ss = QObject::tr("The ABAQUS python command failed to start: %1").arg(m_ProcessPtr->errorString());
+    setErrorCondition(-4005, ss);
     return;
   }
 
-  QByteArray buf;
-  QList<QByteArray> tokens; /* vector to store the split data */
-
-  bool ok = false;
-  QString word("");
-
-  qint64 dataOffset = inStream.pos();
-
-  // Cell Connectivity section
-  // Read until you get to the element block
-
-  while(word.compare("ELEMENTS") != 0)
-  {
-    buf = inStream.readLine();
-    buf = buf.trimmed();
-    buf = buf.simplified();
-    tokens = buf.split(' ');
-    word = tokens.at(0);
-  }
-
-  // Set the number of cells and then create cells array and resize cell attr mat.
-  size_t numCells = tokens.at(1).toULongLong(&ok);
-  std::vector<size_t> tDims(1, numCells);
-  cellAttrMat->resizeAttributeArrays(tDims);
-  QString eleType = tokens.at(2);
-  QString eleDim = "3D";
-  int32_t numIntPoints = 1;
-
-  //
-  // triangles
-  //
-  if(eleType == "CPE3" || eleType == "CPS3")
+  const size_t reportInterval = 64 * 1024 * 1024;
+  size_t bytesRead = 0;
+  size_t nextReport = reportInterval;
+  while(true)
   {
-    eleDim = "2D";
-    inStream.seek(dataOffset);
-    // Read until you get to the vertex block
-    while(word.compare("NODES") != 0)
+    bool running = m_ProcessPtr->state() != QProcess::NotRunning;
+    if(running)
     {
-      buf = inStream.readLine();
-      buf = buf.trimmed();
-      buf = buf.simplified();
-      tokens = buf.split(' ');
-      word = tokens.at(0);
+      m_ProcessPtr->waitForReadyRead(100);
     }
 
-    // Set the number of vertices and then create vertices array and resize vertex attr mat.
-    numVerts = tokens.at(1).toULongLong(&ok);
-    tDims[0] = numVerts;
-    vertexAttrMat->resizeAttributeArrays(tDims);
-
-    SharedVertexList::Pointer vertexPtr = TriangleGeom::CreateSharedVertexList(static_cast<int64_t>(numVerts), allocate);
-    float* vertex = vertexPtr->getPointer(0);
-
-    // Read or Skip past all the vertex data
-    for(size_t i = 0; i < numVerts; i++)
+    QByteArray chunk = m_ProcessPtr->readAllStandardOutput();
+    if(!chunk.isEmpty() && !parser.append(chunk.constData(), static_cast<size_t>(chunk.size())))
     {
-      buf = inStream.readLine();
-      if(allocate)
-      {
-        buf = buf.trimmed();
-        buf = buf.simplified();
-        tokens = buf.split(' ');
-        vertex[3 * i] = tokens[1].toFloat(&ok);
-        vertex[3 * i + 1] = tokens[2].toFloat(&ok);
-        vertex[3 * i + 2] = 0.0;
-      }
+      m_ProcessPtr->kill();
+      m_ProcessPtr->waitForFinished(-1);
+      return;
     }
-
-    inStream.seek(dataOffset);
-
-    while(word.compare("ELEMENTS") != 0)
+    if(getCancel())
     {
-      buf = inStream.readLine();
-      buf = buf.trimmed();
-      buf = buf.simplified();
-      tokens = buf.split(' ');
-      word = tokens.at(0);
+      m_ProcessPtr->kill();
+      m_ProcessPtr->waitForFinished(-1);
+      return;
     }
-
-    TriangleGeom::Pointer triGeomPtr = TriangleGeom::CreateGeometry(static_cast<int64_t>(numCells), vertexPtr, SIMPL::Geometry::TriangleGeometry, allocate);
-    triGeomPtr->setSpatialDimensionality(2);
-    dataContainer->setGeometry(triGeomPtr);
-    MeshIndexType* triangles = triGeomPtr->getTriPointer(0);
-
-    for(size_t i = 0; i < numCells; i++)
+    if(!running && chunk.isEmpty())
     {
-      buf = inStream.readLine();
-      if(allocate)
-      {
-        buf = buf.trimmed();
-        buf = buf.simplified();
-        tokens = buf.split(' ');
-        // Subtract one from the node number because ABAQUS starts at node 1 and we start at node 0
-        triangles[3 * i] = tokens[1].toInt(&ok) - 1;
-        triangles[3 * i + 1] = tokens[2].toInt(&ok) - 1;
-        triangles[3 * i + 2] = tokens[3].toInt(&ok) - 1;
-      }
+      break;
     }
-    // End reading of the connectivity
-  }
 
-  //
-  // tetrahedral
-  //
-  if(eleType == "C3D4")
-  {
-    eleDim = "3D";
-    inStream.seek(dataOffset);
-    // Read until you get to the vertex block
-    while(word.compare("NODES") != 0)
+    bytesRead += static_cast<size_t>(chunk.size());
+    if(bytesRead >= nextReport)
     {
-      buf = inStream.readLine();
-      buf = buf.trimmed();
-      buf = buf.simplified();
-      tokens = buf.split(' ');
-      word = tokens.at(0);
+      notifyStatusMessage(QObject::tr("Parsed %1 MB of ABAQUS output").arg(bytesRead / (1024 * 1024)));
+      nextReport = bytesRead + reportInterval;
     }
+  }
 
-    // Set the number of vertices and then create vertices array and resize vertex attr mat.
-    numVerts = tokens.at(1).toULongLong(&ok);
-    tDims[0] = numVerts;
-    vertexAttrMat->resizeAttributeArrays(tDims);
-
-    SharedVertexList::Pointer vertexPtr = TetrahedralGeom::CreateSharedVertexList(static_cast<int64_t>(numVerts), allocate);
-    float* vertex = vertexPtr->getPointer(0);
+  // The output of a process that crashed or failed may be cut short anywhere
+  m_ProcessPtr->waitForFinished(-1);
+  if(getErrorCode() < 0)
+  {
+    return;
+  }
+  if(m_ProcessPtr->exitStatus() == QProcess::CrashExit)
+  {
+    QString ss = QObject::tr("The ABAQUS python script crashed: %1").arg(m_ProcessPtr->errorString());
+    setErrorCondition(-4003, ss);
+    return;
+  }
+  if(m_ProcessPtr->exitCode() != 0)
+  {
+    QString ss = QObject::tr("The ABAQUS python script finished with exit code %1").arg(m_ProcessPtr->exitCode());
+    setErrorCondition(-4004, ss);
+    return;
+  }
 
-    // Read or Skip past all the vertex data
-    for(size_t i = 0; i < numVerts; i++)
-    {
-      buf = inStream.readLine();
-      if(allocate)
-      {
-        buf = buf.trimmed();
-        buf = buf.simplified();
-        tokens = buf.split(' ');
-        vertex[3 * i] = tokens[1].toFloat(&ok);
-        vertex[3 * i + 1] = tokens[2].toFloat(&ok);
-        vertex[3 * i + 2] = tokens[3].toFloat(&ok);
-      }
-    }
+  parser.finish();
 
-    inStream.seek(dataOffset);
+  notifyStatusMessage("Finished running ABAQUS python script");
+}
 
-    while(word.compare("ELEMENTS") != 0)
-    {
-      buf = inStream.readLine();
-      buf = buf.trimmed();
-      buf = buf.simplified();
-      tokens = buf.split(' ');
-      word = tokens.at(0);
-    }
+//
+//
+//
 
-    TetrahedralGeom::Pointer tetGeomPtr = TetrahedralGeom::CreateGeometry(static_cast<int64_t>(numCells), vertexPtr, SIMPL::Geometry::TetrahedralGeometry, allocate);
-    tetGeomPtr->setSpatialDimensionality(3);
-    dataContainer->setGeometry(tetGeomPtr);
-    MeshIndexType* tets = tetGeomPtr->getTetPointer(0);
+void ImportFEAData::startABQProcess(bool forwardStandardOutput)
+{
+  QStringList arguments = splitArgumentsString(m_ABQPythonCommand);
+  QString program = arguments[0];
 
-    for(size_t i = 0; i < numCells; i++)
-    {
-      buf = inStream.readLine();
-      if(allocate)
-      {
-        buf = buf.trimmed();
-        buf = buf.simplified();
-        tokens = buf.split(' ');
-        // Subtract one from the node number because ABAQUS starts at node 1 and we start at node 0
-        tets[4 * i] = tokens[1].toInt(&ok) - 1;
-        tets[4 * i + 1] = tokens[2].toInt(&ok) - 1;
-        tets[4 * i + 2] = tokens[3].toInt(&ok) - 1;
-        tets[4 * i + 3] = tokens[4].toInt(&ok) - 1;
-      }
-    }
-    // End reading of the connectivity
-  }
+  arguments.removeAt(0);
 
-  // quadrilaterals
-  if(eleType == "CPE4R" || eleType == "CPS4R" || eleType == "CPE4" || eleType == "CPS4")
+  m_ProcessPtr = QSharedPointer<QProcess>(new QProcess(nullptr));
+  qRegisterMetaType<QProcess::ExitStatus>("QProcess::ExitStatus");
+  qRegisterMetaType<QProcess::ProcessError>("QProcess::ProcessError");
+  connect(m_ProcessPtr.data(), SIGNAL(finished(int, QProcess::ExitStatus)), this, SLOT(processHasFinished(int, QProcess::ExitStatus)), Qt::QueuedConnection);
+  connect(m_ProcessPtr.data(), SIGNAL(error(QProcess::ProcessError)), this, SLOT(processHasErroredOut(QProcess::ProcessError)), Qt::QueuedConnection);
+  connect(m_ProcessPtr.data(), SIGNAL(readyReadStandardError()), this, SLOT(sendErrorOutput()), Qt::QueuedConnection);
+  if(forwardStandardOutput)
   {
-    if(eleType == "CPE4" || eleType == "CPS4")
-    {
-      numIntPoints = 4;
-    }
-
-    eleDim = "2D";
-    inStream.seek(dataOffset);
-    // Read until you get to the vertex block
-    while(word.compare("NODES") != 0)
-    {
-      buf = inStream.readLine();
-      buf = buf.trimmed();
-      buf = buf.simplified();
-      tokens = buf.split(' ');
-      word = tokens.at(0);
-    }
+    connect(m_ProcessPtr.data(), SIGNAL(readyReadStandardOutput()), this, SLOT(sendStandardOutput()), Qt::QueuedConnection);
+  }
 
-    // Set the number of vertices and then create vertices array and resize vertex attr mat.
-    numVerts = tokens.at(1).toULongLong(&ok);
-    tDims[0] = numVerts;
-    vertexAttrMat->resizeAttributeArrays(tDims);
+  m_ProcessPtr->setWorkingDirectory(m_odbFilePath);
+  m_ProcessPtr->start(program, arguments);
+  m_ProcessPtr->waitForStarted(2000);
+}
 
-    SharedVertexList::Pointer vertexPtr = QuadGeom::CreateSharedVertexList(static_cast<int64_t>(numVerts), allocate);
-    float* vertex = vertexPtr->getPointer(0);
+//
+//
+//
 
-    // Read or Skip past all the vertex data
-    for(size_t i = 0; i < numVerts; i++)
+QStringList ImportFEAData::splitArgumentsString(QString arguments)
+{
+  QStringList argumentList;
+  for(int i = 0; i < m_ABQPythonCommand.size(); i++)
+  {
+    if(m_ABQPythonCommand[i] == '\"')
     {
-      buf = inStream.readLine();
-      if(allocate)
+      i++;
+      int start = i;
+      int index = m_ABQPythonCommand.indexOf("\"", start);
+      if(index == -1)
       {
-        buf = buf.trimmed();
-        buf = buf.simplified();
-        tokens = buf.split(' ');
-        vertex[3 * i] = tokens[1].toFloat(&ok);
-        vertex[3 * i + 1] = tokens[2].toFloat(&ok);
-        vertex[3 * i + 2] = 0.0;
+        index = m_ABQPythonCommand.size();
       }
+      int end = index - 1;
+      argumentList.push_back(m_ABQPythonCommand.mid(start, end - start + 1));
+      i = index;
     }
-
-    inStream.seek(dataOffset);
-
-    while(word.compare("ELEMENTS") != 0)
-    {
-      buf = inStream.readLine();
-      buf = buf.trimmed();
-      buf = buf.simplified();
-      tokens = buf.split(' ');
-      word = tokens.at(0);
-    }
-
-    QuadGeom::Pointer quadGeomPtr = QuadGeom::CreateGeometry(static_cast<int64_t>(numCells), vertexPtr, SIMPL::Geometry::QuadGeometry, allocate);
-    quadGeomPtr->setSpatialDimensionality(2);
-    dataContainer->setGeometry(quadGeomPtr);
-    MeshIndexType* quads = quadGeomPtr->getQuadPointer(0);
-
-    for(size_t i = 0; i < numCells; i++)
+    else
     {
-      buf = inStream.readLine();
-      if(allocate)
+      int start = i;
+      int index = m_ABQPythonCommand.indexOf(" ", start + 1);
+      if(index == -1)
       {
-        buf = buf.trimmed();
-        buf = buf.simplified();
-        tokens = buf.split(' ');
-        // Subtract one from the node number because ABAQUS starts at node 1 and we start at node 0
-        quads[4 * i] = tokens[1].toInt(&ok) - 1;
-        quads[4 * i + 1] = tokens[2].toInt(&ok) - 1;
-        quads[4 * i + 2] = tokens[3].toInt(&ok) - 1;
-        quads[4 * i + 3] = tokens[4].toInt(&ok) - 1;
+        index = m_ABQPythonCommand.size();
       }
+      int end = index - 1;
+      argumentList.push_back(m_ABQPythonCommand.mid(start, end - start + 1));
+      i = index;
     }
-    // End reading of the connectivity
   }
 
-  if(eleType == "C3D8R" || eleType == "C3D8")
-  {
-    if(eleType == "C3D8")
-    {
-      numIntPoints = 8;
-    }
-
-    eleDim = "3D";
-    inStream.seek(dataOffset);
-    // Read until you get to the vertex block
-    while(word.compare("NODES") != 0)
-    {
-      buf = inStream.readLine();
-      buf = buf.trimmed();
-      buf = buf.simplified();
-      tokens = buf.split(' ');
-      word = tokens.at(0);
-    }
-
-    // Set the number of vertices and then create vertices array and resize vertex attr mat.
-    numVerts = tokens.at(1).toULongLong(&ok);
-    tDims[0] = numVerts;
-    vertexAttrMat->resizeAttributeArrays(tDims);
-
-    SharedVertexList::Pointer vertexPtr = HexahedralGeom::CreateSharedVertexList(static_cast<int64_t>(numVerts), allocate);
-    float* vertex = vertexPtr->getPointer(0);
+  return argumentList;
+}
 
-    // Read or Skip past all the vertex data
-    for(size_t i = 0; i < numVerts; i++)
-    {
-      buf = inStream.readLine();
-      if(allocate)
-      {
-        buf = buf.trimmed();
-        buf = buf.simplified();
-        tokens = buf.split(' ');
-        vertex[3 * i] = tokens[1].toFloat(&ok);
-        vertex[3 * i + 1] = tokens[2].toFloat(&ok);
-        vertex[3 * i + 2] = tokens[3].toFloat(&ok);
-      }
-    }
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
 
-    inStream.seek(dataOffset);
+void ImportFEAData::processHasFinished(int exitCode, QProcess::ExitStatus exitStatus)
+{
+  if(getCancel())
+  {
+  }
+  else if(exitStatus == QProcess::CrashExit)
+  {
+    QString ss = QObject::tr("The process crashed during its exit.");
+    setErrorCondition(-4003, ss);
+  }
+  else if(exitCode < 0)
+  {
+    QString ss = QObject::tr("The process finished with exit code %1.").arg(QString::number(exitCode));
+    setErrorCondition(-4004, ss);
+  }
+  else if(getErrorCode() >= 0)
+  {
+  }
 
-    while(word.compare("ELEMENTS") != 0)
-    {
-      buf = inStream.readLine();
-      buf = buf.trimmed();
-      buf = buf.simplified();
-      tokens = buf.split(' ');
-      word = tokens.at(0);
-    }
+  m_Pause = false;
+  m_WaitCondition.wakeAll();
+}
 
-    HexahedralGeom::Pointer hexGeomPtr = HexahedralGeom::CreateGeometry(static_cast<int64_t>(numCells), vertexPtr, SIMPL::Geometry::HexahedralGeometry, allocate);
-    hexGeomPtr->setSpatialDimensionality(3);
-    dataContainer->setGeometry(hexGeomPtr);
-    MeshIndexType* hexs = hexGeomPtr->getHexPointer(0);
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
 
-    for(size_t i = 0; i < numCells; i++)
-    {
-      buf = inStream.readLine();
-      if(allocate)
-      {
-        buf = buf.trimmed();
-        buf = buf.simplified();
-        tokens = buf.split(' ');
-        // Subtract one from the node number because ABAQUS starts at node 1 and we start at node 0
-        hexs[8 * i] = tokens[1].toInt(&ok) - 1;
-        hexs[8 * i + 1] = tokens[2].toInt(&ok) - 1;
-        hexs[8 * i + 2] = tokens[3].toInt(&ok) - 1;
-        hexs[8 * i + 3] = tokens[4].toInt(&ok) - 1;
-        hexs[8 * i + 4] = tokens[5].toInt(&ok) - 1;
-        hexs[8 * i + 5] = tokens[6].toInt(&ok) - 1;
-        hexs[8 * i + 6] = tokens[7].toInt(&ok) - 1;
-        hexs[8 * i + 7] = tokens[8].toInt(&ok) - 1;
-      }
-    }
-    // End reading of the connectivity
+void ImportFEAData::processHasErroredOut(QProcess::ProcessError error)
+{
+  if(getCancel())
+  {
+    QString ss = QObject::tr("The process was killed by the user.");
+    setWarningCondition(-4004, ss);
   }
+  else if(error == QProcess::FailedToStart)
+  {
+    QProcessEnvironment env = QProcessEnvironment::systemEnvironment();
+    QString pathEnv = env.value("PATH");
 
-  for(size_t i = 0; i < numVerts + 1; i++)
+    QString ss = QObject::tr("The process failed to start. Either the invoked program is missing, or you may have insufficient permissions to invoke the program \
+or the path containing the executble is not in the system's environment path. PATH=%1.\n Try using the absolute path to the executable.")
+                     .arg(pathEnv);
+    setErrorCondition(-4005, ss);
+  }
+  else if(error == QProcess::Crashed)
   {
-    buf = inStream.readLine();
+    QString ss = QObject::tr("The process crashed some time after starting successfully.");
+    setErrorCondition(-4006, ss);
   }
-
-  //
-  // Start reading any additional vertex or cell data arrays
-  //
-  QTextStream ss(&status);
-  status = "";
-  ss << "Scanning for Vertex & Cell data....";
-  notifyStatusMessage(status);
-  while(!inStream.atEnd())
+  else if(error == QProcess::Timedout)
   {
-    buf.clear();
-    while(buf.size() == 0 && !inStream.atEnd())
-    {
-      buf = inStream.readLine();
-      buf = buf.trimmed();
-      buf = buf.simplified();
-      tokens = buf.split(' ');
-    }
-    if(inStream.atEnd())
-    {
-      return;
-    }
+    QString ss = QObject::tr("The process timed out.");
+    setErrorCondition(-4007, ss);
+  }
+  else if(error == QProcess::WriteError)
+  {
+    QString ss = QObject::tr("An error occurred when attempting to write to the process.");
+    setErrorCondition(-4008, ss);
+  }
+  else if(error == QProcess::ReadError)
+  {
+    QString ss = QObject::tr("An error occurred when attempting to read from the process.");
+    setErrorCondition(-4009, ss);
+  }
+  else
+  {
+    QString ss = QObject::tr("An unknown error occurred.");
+    setErrorCondition(-4010, ss);
+  }
 
-    QString dataArrayPos = tokens.at(0);
-    QString dataArrayType = tokens.at(1);
-    QString dataArrayName = tokens.at(2);
-    size_t count = 0;
-    int32_t numComp = 0;
-    if(dataArrayPos == "NODAL")
-    {
-      count = numVerts;
-    }
-    else if(dataArrayPos == "INTEGRATION_POINT")
-    {
-      count = numCells;
-    }
-    //
-    if(dataArrayType == "SCALAR")
-    {
-      numComp = 1;
-    }
-    else if(eleDim == "2D" && dataArrayType == "VECTOR")
-    {
-      numComp = 2;
-    }
-    else if(eleDim == "3D" && dataArrayType == "VECTOR")
-    {
-      numComp = 3;
-    }
-    else if(dataArrayType == "TENSOR_3D_FULL")
-    {
-      numComp = 6;
-    }
-    else if(dataArrayType == "TENSOR_3D_SURFACE")
-    {
-      numComp = 3;
-    }
-    else if(dataArrayType == "TENSOR_3D_PLANAR")
-    {
-      numComp = 4;
-    }
-    else if(dataArrayType == "TENSOR_2D_SURFACE")
-    {
-      numComp = 3;
-    }
-    else if(dataArrayType == "TENSOR_2D_PLANAR")
-    {
-      numComp = 4;
-    }
+  m_Pause = false;
+  m_WaitCondition.wakeAll();
+}
 
-    //
-    // Read a Data set
-    //
-    FloatArrayType::Pointer data = FloatArrayType::NullPointer();
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
 
-    if(dataArrayPos == "NODAL")
+void ImportFEAData::sendErrorOutput()
+{
+  if(m_ProcessPtr.data() != nullptr)
+  {
+    QString error = m_ProcessPtr->readAllStandardError();
+    if(error[error.size() - 1] == '\n')
     {
-      for(size_t i = 0; i < count; i++)
-      {
-        buf = inStream.readLine();
-        buf = buf.trimmed();
-        buf = buf.simplified();
-        tokens = buf.split(' ');
-
-        if(i == 0)
-        {
-          std::vector<size_t> cDims(1, static_cast<size_t>(numComp));
-          data = FloatArrayType::CreateArray(count, cDims, dataArrayName, allocate);
-          if(count == numVerts)
-          {
-            vertexAttrMat->insertOrAssign(data);
-            status = "";
-            ss << "Reading Vertex Data: " << data->getName();
-            notifyStatusMessage(status);
-          }
-          else if(count == numCells)
-          {
-            cellAttrMat->insertOrAssign(data);
-            status = "";
-            ss << "Reading Cell Data: " << data->getName();
-            notifyStatusMessage(status);
-          }
-        }
-        for(int32_t c = 0; c < numComp; c++)
-        {
-          float value = tokens[c + 1].toFloat(&ok);
-          data->setComponent(i, c, value);
-        }
-      }
+      error.chop(1);
     }
-    else if(dataArrayPos == "INTEGRATION_POINT")
-    {
-      for(size_t i = 0; i < count; i++)
-      {
-        for(int32_t k = 0; k < numIntPoints; k++)
-        {
-          buf = inStream.readLine();
-          buf = buf.trimmed();
-          buf = buf.simplified();
-          tokens = buf.split(' ');
+    notifyStatusMessage(error);
+    m_WaitCondition.wakeAll();
+  }
+}
 
-          if(i == 0 && k == 0)
-          {
-            std::vector<size_t> cDims(1, static_cast<size_t>(numComp * numIntPoints));
-            data = FloatArrayType::CreateArray(count, cDims, dataArrayName, allocate);
-            if(count == numVerts)
-            {
-              vertexAttrMat->insertOrAssign(data);
-              status = "";
-              ss << "Reading Vertex Data: " << data->getName();
-              notifyStatusMessage(status);
-            }
-            else if(count == numCells)
-            {
-              cellAttrMat->insertOrAssign(data);
-              status = "";
-              ss << "Reading Cell Data: " << data->getName();
-              notifyStatusMessage(status);
-            }
-          }
-          for(int32_t c = 0; c < numComp; c++)
-          {
-            float value = tokens[c + 1].toFloat(&ok);
-            data->setComponent(i, k * numComp + c, value);
-          }
-        }
-      }
-    }
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+
+void ImportFEAData::sendStandardOutput()
+{
+  if(m_ProcessPtr.data() != nullptr)
+  {
+    notifyStatusMessage(m_ProcessPtr->readAllStandardOutput());
+    m_WaitCondition.wakeAll();
   }
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+
+void ImportFEAData::scanABQFile(const QString& file, DataContainer* dataContainer, AttributeMatrix* vertexAttrMat, AttributeMatrix* cellAttrMat)
+{
+  AbaqusDatReader::read(this, file, *dataContainer, *vertexAttrMat, *cellAttrMat);
+}
+
 //
 //
 //
@@ -1772,130 +1830,63 @@ void ImportFEAData::readHeader(QFile& reader)
   }
   m_LinesPerBlock = m_LinesPerBlock + 1; // This compensates for the extra Line Break at the start of each block
 
-  qint32 currentLineNum = lineNum;
-  // Store the current byte position in the file so that we can come back to it if needed.
+  // Store the current byte position in the file so that the time steps can be located relative to it
   qint64 dataOffset = reader.pos();
 
-  // Now scan to the end so we can figure out how many lines, blocks, and nodes we have.
-  qint32 p = 0;
-  QVector<QByteArray> lastBlock(m_LinesPerBlock);
-  while(!reader.atEnd())
-  {
-    lastBlock[p] = reader.readLine();
-    lineNum++;
-    p++;
-    if(p == m_LinesPerBlock)
-    {
-      p = 0;
-    }
-  }
-
-  // Now we are at the end of the file and reset back to the data section
-  reader.seek(dataOffset);
-
-  // Now that we have all the tokens, lets parse through them and create our Map of Names<==>Parsers
-  QListIterator<QByteArray> blockIter(blockTokens);
-  int index = 0;
-  while(blockIter.hasNext())
+  // Now that we have all the tokens, compile them into the column plan used to parse every record
+  m_ColumnPlan.clear();
+  m_DataArrayList.clear();
+  int32_t index = 0;
+  for(const auto& current : blockTokens)
   {
-    const QByteArray& current = blockIter.next();
     QString name = QString::fromLatin1(current).trimmed();
-    QString value = m_DataTypes[name];
+    QString value = m_DataTypes.value(name);
 
-    if(value.compare(SIMPL::TypeNames::Float) == 0)
-    {
-      FloatArrayType::Pointer data = FloatArrayType::CreateArray(0, name, false);
-      SimulationIO::FloatParser::Pointer dparser = SimulationIO::FloatParser::New(data, name, index);
-      m_NamePointerMap.insert(name, dparser);
-    }
-    else if(value.compare(SIMPL::TypeNames::Int32) == 0)
+    if(value.compare(SIMPL::TypeNames::Int32) == 0)
     {
-      Int32ArrayType::Pointer data = Int32ArrayType::CreateArray(0, name, false);
-      SimulationIO::Int32Parser::Pointer dparser = SimulationIO::Int32Parser::New(data, name, index);
-      m_NamePointerMap.insert(name, dparser);
+      m_ColumnPlan.addColumn(index, SimulationIO::DeformColumnPlan::Conversion::Int32, name);
     }
     else
     {
-      FloatArrayType::Pointer data = FloatArrayType::CreateArray(0, name, false);
-      SimulationIO::FloatParser::Pointer dparser = SimulationIO::FloatParser::New(data, name, index);
-      m_NamePointerMap.insert(name, dparser);
-      QString ss = QObject::tr("Data Block Column Name '%1' was unknown. We will parse the data as Floating point Data (32 Bit)").arg(name);
-      setWarningCondition(-1, ss);
+      m_ColumnPlan.addColumn(index, SimulationIO::DeformColumnPlan::Conversion::Float, name);
+      if(value.compare(SIMPL::TypeNames::Float) != 0)
+      {
+        QString ss = QObject::tr("Data Block Column Name '%1' was unknown. We will parse the data as Floating point Data (32 Bit)").arg(name);
+        setWarningCondition(-1, ss);
+      }
     }
+    m_DataArrayList << name;
     index++;
   }
 
-  // Look for the Parser for the 'Point #' variable so we can use it to correctly parse the value from the last block
-  SimulationIO::DeformDataParser::Pointer parser = m_NamePointerMap[SimulationIOConstants::DEFORMData::PointNum];
-  if(nullptr == parser.get())
+  // Look for the 'Point #' column so the number of points can be read from the last block
+  int32_t pointNumColumn = m_ColumnPlan.findColumn(SimulationIOConstants::DEFORMData::PointNum);
+  if(pointNumColumn < 0)
   {
-    Q_ASSERT_X(nullptr != parser.get(), "Point # data column was not found in the Deform Data File", "");
+    QString ss = QObject::tr("The '%1' data column was not found in the Point Tracking file").arg(SimulationIOConstants::DEFORMData::PointNum);
+    setErrorCondition(-391, ss);
+    return;
   }
 
-  QVector<QByteArray> tokens = splitDataBlock(lastBlock);
-  bool ok = false;
-  m_NumPoints = tokens[parser->getColumnIndex()].toInt(&ok);
-  m_NumBlocks = (lineNum - currentLineNum) / m_LinesPerBlock;
-  m_NumTimeSteps = m_NumBlocks / m_NumPoints;
+  // Rather than reading the whole file, load (or build once and cache) the byte offset of every time step
+  m_TimeStepIndex = DeformPointTrackIndex::Index();
+  m_TimeStepIndex.dataOffset = dataOffset;
+  m_TimeStepIndex.linesPerBlock = m_LinesPerBlock;
+  m_TimeStepIndex.pointNumColumn = pointNumColumn;
+  if(!DeformPointTrackIndex::loadOrBuild(getDEFORMPointTrackInputFile(), m_TimeStepIndex))
+  {
+    QString ss = QObject::tr("The data section of the Point Tracking file '%1' does not contain a complete data block").arg(getDEFORMPointTrackInputFile());
+    setErrorCondition(-392, ss);
+    return;
+  }
+
+  m_NumPoints = m_TimeStepIndex.numPoints;
+  m_NumBlocks = static_cast<qint32>(m_TimeStepIndex.numBlocks);
+  m_NumTimeSteps = static_cast<qint32>(m_TimeStepIndex.timeStepOffsets.size());
 
   qDebug() << "numPoints: " << m_NumPoints;
   qDebug() << "numBlocks: " << m_NumBlocks;
   qDebug() << "numTimeSteps: " << m_NumTimeSteps;
-
-  m_DataArrayList.clear();
-
-  // Now just redo the Parser with the correct number of points to allocate
-  blockIter.toFront();
-  index = 0;
-  while(blockIter.hasNext())
-  {
-    const QByteArray& current = blockIter.next();
-    QString name = QString::fromLatin1(current).trimmed();
-    QString value = m_DataTypes[name];
-
-    if(value.compare(SIMPL::TypeNames::Float) == 0)
-    {
-      FloatArrayType::Pointer data = FloatArrayType::CreateArray(m_NumPoints, name, false);
-      SimulationIO::FloatParser::Pointer dparser = SimulationIO::FloatParser::New(data, name, index);
-      m_NamePointerMap.insert(name, dparser);
-    }
-    else if(value.compare(SIMPL::TypeNames::Int32) == 0)
-    {
-      Int32ArrayType::Pointer data = Int32ArrayType::CreateArray(m_NumPoints, name, false);
-      SimulationIO::Int32Parser::Pointer dparser = SimulationIO::Int32Parser::New(data, name, index);
-      m_NamePointerMap.insert(name, dparser);
-    }
-    else
-    {
-      FloatArrayType::Pointer data = FloatArrayType::CreateArray(m_NumPoints, name, false);
-      SimulationIO::FloatParser::Pointer dparser = SimulationIO::FloatParser::New(data, name, index);
-      m_NamePointerMap.insert(name, dparser);
-      QString ss = QObject::tr("Data Block Column Name '%1' was unknown. We will parse the data as Floating point Data (32 Bit)").arg(name);
-      setWarningCondition(-1, ss);
-    }
-    m_DataArrayList << name;
-    index++;
-  }
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-QVector<QByteArray> ImportFEAData::splitDataBlock(QVector<QByteArray>& dataBlock)
-{
-  QVector<QByteArray> tokens;
-  for(const auto& block : dataBlock)
-  {
-    QList<QByteArray> lineTokens = block.trimmed().split(' ');
-    for(const auto& token : lineTokens)
-    {
-      if(!token.isEmpty())
-      {
-        tokens.push_back(token);
-      }
-    }
-  }
-  return tokens;
 }
 
 // -----------------------------------------------------------------------------
@@ -1909,10 +1900,6 @@ void ImportFEAData::readTimeStep(QFile& reader, qint32 t)
   {
     QString ss = QObject::tr("Skipping time step %1 of %2").arg(t).arg(m_NumTimeSteps - 1);
     notifyStatusMessage(ss);
-    for(size_t nodeIdx = 0; nodeIdx < m_NumPoints * m_LinesPerBlock; ++nodeIdx)
-    {
-      QByteArray line = reader.readLine();
-    }
     return;
   }
 
@@ -1922,59 +1909,44 @@ void ImportFEAData::readTimeStep(QFile& reader, qint32 t)
   VertexGeom::Pointer vertices = v->getGeometryAs<VertexGeom>();
 
   AttributeMatrix::Pointer attrMat = v->getAttributeMatrix(SIMPL::Defaults::VertexAttributeMatrixName);
-
-  // Vertex Coords for each Vertex
-  FloatArrayType::Pointer xCoordsPtr = FloatArrayType::NullPointer();
-  FloatArrayType::Pointer yCoordsPtr = FloatArrayType::NullPointer();
-
-  // We want this array because we are going to delete it as it has redundant information
-  IDataArray::Pointer pointNumPtr = IDataArray::NullPointer();
-
-  // Meta Data Information arrays
-  Int32ArrayType::Pointer timeStepPtr = Int32ArrayType::NullPointer();
-  FloatArrayType::Pointer timeValuePtr = FloatArrayType::NullPointer();
-
-  QMapIterator<QString, SimulationIO::DeformDataParser::Pointer> parserIter(m_NamePointerMap);
-  while(parserIter.hasNext())
+  if(!m_ColumnPlan.bind(*attrMat, m_NumPoints))
   {
-    parserIter.next();
-    QString name = parserIter.key();
-    SimulationIO::DeformDataParser::Pointer parser = parserIter.value();
-    IDataArray::Pointer data = attrMat->getAttributeArray(name);
-    if(!data->isAllocated())
-    {
-      qDebug() << name << " is NOT allocated";
-    }
-    parser->setDataArray(data);
+    QString ss = QObject::tr("The data arrays of time step %1 could not be found").arg(t);
+    setErrorCondition(-394, ss);
+    return;
+  }
 
-    if(data->getName().compare(getSelectedTimeArrayName()) == 0)
-    {
-      timeValuePtr = std::dynamic_pointer_cast<FloatArrayType>(data);
-    }
-    else if(data->getName().compare(getSelectedTimeStepArrayName()) == 0)
-    {
-      timeStepPtr = std::dynamic_pointer_cast<Int32ArrayType>(data);
-    }
-    else if(data->getName().compare(getSelectedPointNumArrayName()) == 0)
-    {
-      pointNumPtr = std::dynamic_pointer_cast<Int32ArrayType>(data);
-    }
-    else if(data->getName().compare(getSelectedXCoordArrayName()) == 0)
-    {
-      xCoordsPtr = std::dynamic_pointer_cast<FloatArrayType>(data);
-    }
-    else if(data->getName().compare(getSelectedYCoordArrayName()) == 0)
-    {
-      yCoordsPtr = std::dynamic_pointer_cast<FloatArrayType>(data);
-    }
+  // Jump straight to the first block of this time step and read the whole step in one go
+  qint64 stepBegin = m_TimeStepIndex.timeStepOffsets[t];
+  qint64 stepEnd = (static_cast<size_t>(t) + 1 < m_TimeStepIndex.timeStepOffsets.size()) ? m_TimeStepIndex.timeStepOffsets[t + 1] : reader.size();
+  if(!reader.seek(stepBegin))
+  {
+    QString ss = QObject::tr("Could not seek to time step %1 in the Point Tracking file").arg(t);
+    setErrorCondition(-393, ss);
+    return;
   }
+  QByteArray buffer = reader.read(stepEnd - stepBegin);
 
+  MappedTextReader::LineReader lineReader(std::string_view(buffer.constData(), static_cast<size_t>(buffer.size())));
   for(int nodeIdx = 0; nodeIdx < m_NumPoints; ++nodeIdx)
   {
-    QVector<QByteArray> tokens = tokenizeNodeBlock(reader);
-    parseDataTokens(tokens, nodeIdx);
+    lineReader.readLine(); // Read the first blank line
+    if(!m_ColumnPlan.parseRecord(lineReader, m_LinesPerBlock - 1, nodeIdx))
+    {
+      QString ss = QObject::tr("Point %1 of time step %2 has fewer values than the header describes").arg(nodeIdx + 1).arg(t);
+      setErrorCondition(-395, ss);
+      return;
+    }
   }
 
+  // Vertex Coords for each Vertex
+  FloatArrayType::Pointer xCoordsPtr = attrMat->getAttributeArrayAs<FloatArrayType>(getSelectedXCoordArrayName());
+  FloatArrayType::Pointer yCoordsPtr = attrMat->getAttributeArrayAs<FloatArrayType>(getSelectedYCoordArrayName());
+
+  // Meta Data Information arrays
+  Int32ArrayType::Pointer timeStepPtr = attrMat->getAttributeArrayAs<Int32ArrayType>(getSelectedTimeStepArrayName());
+  FloatArrayType::Pointer timeValuePtr = attrMat->getAttributeArrayAs<FloatArrayType>(getSelectedTimeArrayName());
+
   // Assign Vertices for this time step
   vertices->resizeVertexList(m_NumPoints);
   float* vertex = vertices->getVertexPointer(0);
@@ -1990,8 +1962,8 @@ void ImportFEAData::readTimeStep(QFile& reader, qint32 t)
   attrMat->removeAttributeArray(xCoordsPtr->getName());
   attrMat->removeAttributeArray(yCoordsPtr->getName());
 
-  // Remove the Point # Array from the AttrMat
-  attrMat->removeAttributeArray(pointNumPtr->getName());
+  // Remove the Point # Array from the AttrMat as it has redundant information
+  attrMat->removeAttributeArray(getSelectedPointNumArrayName());
 
   // Generate the AttributeMatrix that will serve as the Meta-Data information for the DataContainerBundle
   AttributeMatrix::Pointer tsbAttrMat = v->getAttributeMatrix(m_BundleMetaDataAMName);
@@ -2024,43 +1996,6 @@ void ImportFEAData::readTimeStep(QFile& reader, qint32 t)
   }
 }
 
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-
-void ImportFEAData::parseDataTokens(QVector<QByteArray>& tokens, qint32 nodeIdx)
-{
-  QMapIterator<QString, SimulationIO::DeformDataParser::Pointer> parserIter(m_NamePointerMap);
-  while(parserIter.hasNext())
-  {
-    parserIter.next();
-    QString name = parserIter.key();
-    SimulationIO::DeformDataParser::Pointer parser = parserIter.value();
-    parser->parse(tokens.at(parser->getColumnIndex()), nodeIdx);
-  }
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-
-QVector<QByteArray> ImportFEAData::tokenizeNodeBlock(QFile& reader)
-{
-  QVector<QByteArray> values;
-
-  reader.readLine(); // Read the first blank line
-  for(int l = 0; l < m_LinesPerBlock - 1; ++l)
-  {
-    QList<QByteArray> tokens = reader.readLine().trimmed().simplified().split(' ');
-    QListIterator<QByteArray> iter(tokens);
-    while(iter.hasNext())
-    {
-      values.push_back(iter.next());
-    }
-  }
-  return values;
-}
-
 //
 //
 //
@@ -2247,6 +2182,114 @@ int ImportFEAData::getFrameNumber() const
   return m_FrameNumber;
 }
 
+// -----------------------------------------------------------------------------
+void ImportFEAData::setABQExtractionMode(int value)
+{
+  m_ABQExtractionMode = value;
+}
+
+// -----------------------------------------------------------------------------
+int ImportFEAData::getABQExtractionMode() const
+{
+  return m_ABQExtractionMode;
+}
+
+// -----------------------------------------------------------------------------
+void ImportFEAData::setABQImportFrameRange(bool value)
+{
+  m_ABQImportFrameRange = value;
+}
+
+// -----------------------------------------------------------------------------
+bool ImportFEAData::getABQImportFrameRange() const
+{
+  return m_ABQImportFrameRange;
+}
+
+// -----------------------------------------------------------------------------
+void ImportFEAData::setABQLastFrameNumber(int value)
+{
+  m_ABQLastFrameNumber = value;
+}
+
+// -----------------------------------------------------------------------------
+int ImportFEAData::getABQLastFrameNumber() const
+{
+  return m_ABQLastFrameNumber;
+}
+
+// -----------------------------------------------------------------------------
+void ImportFEAData::setABQFrameStride(int value)
+{
+  m_ABQFrameStride = value;
+}
+
+// -----------------------------------------------------------------------------
+int ImportFEAData::getABQFrameStride() const
+{
+  return m_ABQFrameStride;
+}
+
+// -----------------------------------------------------------------------------
+void ImportFEAData::setABQUseResultCache(bool value)
+{
+  m_ABQUseResultCache = value;
+}
+
+// -----------------------------------------------------------------------------
+bool ImportFEAData::getABQUseResultCache() const
+{
+  return m_ABQUseResultCache;
+}
+
+// -----------------------------------------------------------------------------
+void ImportFEAData::setABQCacheDirectory(const QString& value)
+{
+  m_ABQCacheDirectory = value;
+}
+
+// -----------------------------------------------------------------------------
+QString ImportFEAData::getABQCacheDirectory() const
+{
+  return m_ABQCacheDirectory;
+}
+
+// -----------------------------------------------------------------------------
+void ImportFEAData::setABQCacheSizeLimit(int value)
+{
+  m_ABQCacheSizeLimit = value;
+}
+
+// -----------------------------------------------------------------------------
+int ImportFEAData::getABQCacheSizeLimit() const
+{
+  return m_ABQCacheSizeLimit;
+}
+
+// -----------------------------------------------------------------------------
+void ImportFEAData::setABQFilStepNumber(int value)
+{
+  m_ABQFilStepNumber = value;
+}
+
+// -----------------------------------------------------------------------------
+int ImportFEAData::getABQFilStepNumber() const
+{
+  return m_ABQFilStepNumber;
+}
+
+// -----------------------------------------------------------------------------
+void ImportFEAData::setABQFilIncrement(int value)
+{
+  m_ABQFilIncrement = value;
+}
+
+// -----------------------------------------------------------------------------
+int ImportFEAData::getABQFilIncrement() const
+{
+  return m_ABQFilIncrement;
+}
+
 // -----------------------------------------------------------------------------
 void ImportFEAData::setDEFORMInputFile(const QString& value)
 {
@@ -5,6 +5,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include <QtCore/QFile>
 #include <QtCore/QMutex>
@@ -24,7 +25,9 @@ class QProcess;
 
 #include "SimulationIO/SimulationIOConstants.h"
 #include "SimulationIO/SimulationIODLLExport.h"
-#include "SimulationIO/SimulationIOFilters/Utility/DeformDataParser.hpp"
+#include "SimulationIO/SimulationIOFilters/Utility/AbaqusBulkDataReader.h"
+#include "SimulationIO/SimulationIOFilters/Utility/DeformColumnPlan.hpp"
+#include "SimulationIO/SimulationIOFilters/Utility/DeformPointTrackIndex.h"
 
 /**
  * @brief The ImportFEAData class. See [Filter documentation](@ref importfeadata) for details.
@@ -46,6 +49,15 @@ class SimulationIO_EXPORT ImportFEAData : public AbstractFilter
   PYB11_PROPERTY(QString InstanceName READ getInstanceName WRITE setInstanceName)
   PYB11_PROPERTY(QString Step READ getStep WRITE setStep)
   PYB11_PROPERTY(int FrameNumber READ getFrameNumber WRITE setFrameNumber)
+  PYB11_PROPERTY(int ABQExtractionMode READ getABQExtractionMode WRITE setABQExtractionMode)
+  PYB11_PROPERTY(bool ABQImportFrameRange READ getABQImportFrameRange WRITE setABQImportFrameRange)
+  PYB11_PROPERTY(int ABQLastFrameNumber READ getABQLastFrameNumber WRITE setABQLastFrameNumber)
+  PYB11_PROPERTY(int ABQFrameStride READ getABQFrameStride WRITE setABQFrameStride)
+  PYB11_PROPERTY(bool ABQUseResultCache READ getABQUseResultCache WRITE setABQUseResultCache)
+  PYB11_PROPERTY(QString ABQCacheDirectory READ getABQCacheDirectory WRITE setABQCacheDirectory)
+  PYB11_PROPERTY(int ABQCacheSizeLimit READ getABQCacheSizeLimit WRITE setABQCacheSizeLimit)
+  PYB11_PROPERTY(int ABQFilStepNumber READ getABQFilStepNumber WRITE setABQFilStepNumber)
+  PYB11_PROPERTY(int ABQFilIncrement READ getABQFilIncrement WRITE setABQFilIncrement)
   //  PYB11_PROPERTY(QString OutputVariable READ getOutputVariable WRITE setOutputVariable)
   //  PYB11_PROPERTY(QString ElementSet READ getElementSet WRITE setElementSet)
   PYB11_PROPERTY(QString BSAMInputFile READ getBSAMInputFile WRITE setBSAMInputFile)
@@ -164,6 +176,105 @@ public:
   int getFrameNumber() const;
   Q_PROPERTY(int FrameNumber READ getFrameNumber WRITE setFrameNumber)
 
+  /**
+   * @brief Setter property for ABQExtractionMode
+   */
+  void setABQExtractionMode(int value);
+  /**
+   * @brief Getter property for ABQExtractionMode
+   * @return Value of ABQExtractionMode
+   */
+  int getABQExtractionMode() const;
+  Q_PROPERTY(int ABQExtractionMode READ getABQExtractionMode WRITE setABQExtractionMode)
+
+  /**
+   * @brief Setter property for ABQImportFrameRange
+   */
+  void setABQImportFrameRange(bool value);
+  /**
+   * @brief Getter property for ABQImportFrameRange
+   * @return Value of ABQImportFrameRange
+   */
+  bool getABQImportFrameRange() const;
+  Q_PROPERTY(bool ABQImportFrameRange READ getABQImportFrameRange WRITE setABQImportFrameRange)
+
+  /**
+   * @brief Setter property for ABQLastFrameNumber
+   */
+  void setABQLastFrameNumber(int value);
+  /**
+   * @brief Getter property for ABQLastFrameNumber
+   * @return Value of ABQLastFrameNumber
+   */
+  int getABQLastFrameNumber() const;
+  Q_PROPERTY(int ABQLastFrameNumber READ getABQLastFrameNumber WRITE setABQLastFrameNumber)
+
+  /**
+   * @brief Setter property for ABQFrameStride
+   */
+  void setABQFrameStride(int value);
+  /**
+   * @brief Getter property for ABQFrameStride
+   * @return Value of ABQFrameStride
+   */
+  int getABQFrameStride() const;
+  Q_PROPERTY(int ABQFrameStride READ getABQFrameStride WRITE setABQFrameStride)
+
+  /**
+   * @brief Setter property for ABQUseResultCache
+   */
+  void setABQUseResultCache(bool value);
+  /**
+   * @brief Getter property for ABQUseResultCache
+   * @return Value of ABQUseResultCache
+   */
+  bool getABQUseResultCache() const;
+  Q_PROPERTY(bool ABQUseResultCache READ getABQUseResultCache WRITE setABQUseResultCache)
+
+  /**
+   * @brief Setter property for ABQCacheDirectory
+   */
+  void setABQCacheDirectory(const QString& value);
+  /**
+   * @brief Getter property for ABQCacheDirectory
+   * @return Value of ABQCacheDirectory
+   */
+  QString getABQCacheDirectory() const;
+  Q_PROPERTY(QString ABQCacheDirectory READ getABQCacheDirectory WRITE setABQCacheDirectory)
+
+  /**
+   * @brief Setter property for ABQCacheSizeLimit
+   */
+  void setABQCacheSizeLimit(int value);
+  /**
+   * @brief Getter property for ABQCacheSizeLimit
+   * @return Value of ABQCacheSizeLimit
+   */
+  int getABQCacheSizeLimit() const;
+  Q_PROPERTY(int ABQCacheSizeLimit READ getABQCacheSizeLimit WRITE setABQCacheSizeLimit)
+
+  /**
+   * @brief Setter property for ABQFilStepNumber
+   */
+  void setABQFilStepNumber(int value);
+  /**
+   * @brief Getter property for ABQFilStepNumber
+   * @return Value of ABQFilStepNumber
+   */
+  int getABQFilStepNumber() const;
+  Q_PROPERTY(int ABQFilStepNumber READ getABQFilStepNumber WRITE setABQFilStepNumber)
+
+  /**
+   * @brief Setter property for ABQFilIncrement
+   */
+  void setABQFilIncrement(int value);
+  /**
+   * @brief Getter property for ABQFilIncrement
+   * @return Value of ABQFilIncrement
+   */
+  int getABQFilIncrement() const;
+  Q_PROPERTY(int ABQFilIncrement READ getABQFilIncrement WRITE setABQFilIncrement)
+
   /**
    * @brief Setter property for DEFORMInputFile
    */
@@ -408,11 +519,7 @@ protected:
   void initialize();
 
   void readHeader(QFile& reader);
-  void parseDataBlock(QVector<QByteArray>& block);
-  QVector<QByteArray> splitDataBlock(QVector<QByteArray>& dataBlock);
   void readTimeStep(QFile& reader, qint32 t);
-  QVector<QByteArray> tokenizeNodeBlock(QFile& reader);
-  void parseDataTokens(QVector<QByteArray>& tokens, qint32 nodeIdx);
 
 protected Q_SLOTS:
   void processHasFinished(int exitCode, QProcess::ExitStatus exitStatus);
@@ -428,6 +535,15 @@ private:
   QString m_InstanceName = {"PART-1-1"};
   QString m_Step = {"Step-1"};
   int m_FrameNumber = {1};
+  int m_ABQExtractionMode = {0};
+  bool m_ABQImportFrameRange = {false};
+  int m_ABQLastFrameNumber = {1};
+  int m_ABQFrameStride = {1};
+  bool m_ABQUseResultCache = {false};
+  QString m_ABQCacheDirectory = {};
+  int m_ABQCacheSizeLimit = {10240};
+  int m_ABQFilStepNumber = {1};
+  int m_ABQFilIncrement = {0};
   QString m_DEFORMInputFile = {""};
   QString m_BSAMInputFile = {""};
   QString m_DEFORMPointTrackInputFile = {""};
@@ -452,14 +568,93 @@ private:
    * @param instanceName
    * @param step
    * @param frameNum
-   * @param outputVar
-   * @param elSet
+   * @param toStandardOutput Writes the data to the standard output of the script instead of odbtotxt.dat
+   * @return
+   */
+  int32_t writeABQpyscr(const QString& file, const QString& odbName, const QString& odbFilePath, const QString& instanceName, const QString& step, int frameNum, bool toStandardOutput);
+
+  /**
+   * @brief writeABQBulkDataPyscr Writes a python script that dumps the nodes, elements and field outputs of the
+   * instance as raw int32/float32 arrays using the bulkDataBlocks of the odb and numpy, together with the
+   * odbtobin.json manifest that describes them. The mesh is written once and the field outputs of every frame
+   * from firstFrame to lastFrame in steps of frameStride are written in the same session.
+   * @param file
+   * @param odbName
+   * @param odbFilePath
+   * @param instanceName
+   * @param step
+   * @param firstFrame
+   * @param lastFrame
+   * @param frameStride
+   * @return
+   */
+  int32_t writeABQBulkDataPyscr(const QString& file, const QString& odbName, const QString& odbFilePath, const QString& instanceName, const QString& step, int firstFrame, int lastFrame,
+                                int frameStride);
+
+  /**
+   * @brief abqFrameNumbers Returns the frames of the ABAQUS frame range, or just FrameNumber if no range is imported
+   * @return
+   */
+  std::vector<int> abqFrameNumbers() const;
+
+  /**
+   * @brief abqFrameDataContainerName Returns the name of the Data Container a frame of the frame range is imported into
+   * @param frameNum
    * @return
    */
-  int32_t writeABQpyscr(const QString& file, const QString& odbName, const QString& odbFilePath, const QString& instanceName, const QString& step, int frameNum);
+  QString abqFrameDataContainerName(int frameNum) const;
+
+  /**
+   * @brief readABQFrames Reads the frames listed in the odbtobin.json manifest into the Data Containers of the time
+   * series bundle. All the Data Containers share one geometry; only their field arrays differ.
+   * @param manifestFile
+   */
+  void readABQFrames(const QString& manifestFile);
+
+  /**
+   * @brief setABQFrames Moves the extracted mesh and field outputs into the Data Container, or into the Data
+   * Containers of the time series bundle when a frame range is imported
+   * @param data
+   * @param source The file the data was read from, for error messages
+   */
+  void setABQFrames(const AbaqusBulkDataReader::Data& data, const QString& source);
+
+  /**
+   * @brief abqFramesData Collects the mesh and field outputs the ABAQUS import left in the Data Containers, so
+   * they can be stored in the result cache
+   * @return
+   */
+  AbaqusBulkDataReader::Data abqFramesData() const;
+
+  /**
+   * @brief abqCacheDirectory Returns the result cache directory, which defaults to a folder in the odb File Path
+   * @return
+   */
+  QString abqCacheDirectory() const;
+
+  /**
+   * @brief abqFilFile Returns the path of the ABAQUS results file (.fil) next to the odb file
+   * @return
+   */
+  QString abqFilFile() const;
 
   void runABQpyscr(const QString& file);
 
+  /**
+   * @brief streamABQpyscr Runs the ABAQUS python script and parses its standard output while ABAQUS is still writing it,
+   * so no intermediate text file is written to disk. The process is killed on a parse error or when the filter is canceled.
+   * @param dataContainer
+   * @param vertexAttributeMatrix
+   * @param cellAttributeMatrix
+   */
+  void streamABQpyscr(DataContainer* dataContainer, AttributeMatrix* vertexAttributeMatrix, AttributeMatrix* cellAttributeMatrix);
+
+  /**
+   * @brief startABQProcess Starts the ABAQUS python command in the odb file path
+   * @param forwardStandardOutput Forwards the standard output of the process as status messages
+   */
+  void startABQProcess(bool forwardStandardOutput);
+
   void scanABQFile(const QString& file, DataContainer* dataContainer, AttributeMatrix* vertexAttributeMatrix, AttributeMatrix* cellAttributeMatrix);
 
   void scanDEFORMFile(DataContainer* dataContainer, AttributeMatrix* vertexAttributeMatrix, AttributeMatrix* cellAttributeMatrix);
@@ -478,11 +673,12 @@ private:
   QFile m_InStream;
   QMap<QString, QString> m_DataTypes;
 
-  QMap<QString, SimulationIO::DeformDataParser::Pointer> m_NamePointerMap;
+  SimulationIO::DeformColumnPlan m_ColumnPlan;
   qint32 m_NumBlocks = 0;
   qint32 m_NumPoints = 0;
   qint32 m_NumTimeSteps = 0;
   qint32 m_LinesPerBlock = 0;
+  DeformPointTrackIndex::Index m_TimeStepIndex;
   bool m_HeaderIsComplete = false;
   int m_selectedTimeStepValue = 0;
   bool m_selectedTimeStep = false;
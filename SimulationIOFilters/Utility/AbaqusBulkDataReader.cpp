@@ -0,0 +1,418 @@
+/* ============================================================================
+ * Copyright (c) 2019-2019 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include "AbaqusBulkDataReader.h"
+
+#include <algorithm>
+#include <cmath>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
+#include <QtCore/QSysInfo>
+
+#include "SimulationIO/SimulationIOFilters/Utility/AbaqusMesh.h"
+
+namespace
+{
+constexpr qint64 k_ReadChunkSize = 1 << 26;
+
+/**
+ * @brief Reads the raw int32 and float32 arrays numpy's tofile wrote next to the manifest, swapping their bytes if
+ * the script ran on a machine of the other byte order
+ */
+class ArrayFileReader
+{
+public:
+  ArrayFileReader(AbstractFilter* filter, const QString& manifestPath, bool swapBytes)
+  : m_Filter(filter)
+  , m_Dir(QFileInfo(manifestPath).absoluteDir())
+  , m_SwapBytes(swapBytes)
+  {
+  }
+
+  /**
+   * @brief Reads the count values of the file named by the key entry of object into values
+   * @param object
+   * @param key
+   * @param count
+   * @param values
+   * @return false if the file is missing, has the wrong size or could not be read
+   */
+  template <typename T>
+  bool read(const QJsonObject& object, const QString& key, size_t count, T* values) const
+  {
+    static_assert(sizeof(T) == 4, "The extraction script writes 4 byte values");
+
+    QString fileName = object.value(key).toString();
+    QString filePath = m_Dir.filePath(fileName);
+    QFile file(filePath);
+    qint64 numBytes = static_cast<qint64>(count * sizeof(T));
+    if(fileName.isEmpty() || !file.open(QIODevice::ReadOnly) || file.size() != numBytes)
+    {
+      m_Filter->setErrorCondition(-109, QObject::tr("The %1 file '%2' is missing or does not hold %3 values").arg(key, filePath).arg(count));
+      return false;
+    }
+
+    char* bytes = reinterpret_cast<char*>(values);
+    for(qint64 offset = 0; offset < numBytes;)
+    {
+      qint64 numRead = file.read(bytes + offset, std::min(k_ReadChunkSize, numBytes - offset));
+      if(numRead <= 0)
+      {
+        m_Filter->setErrorCondition(-109, QObject::tr("Error reading the %1 file '%2'").arg(key, filePath));
+        return false;
+      }
+      offset += numRead;
+    }
+
+    if(m_SwapBytes)
+    {
+      for(size_t i = 0; i < count; i++)
+      {
+        std::reverse(bytes + i * sizeof(T), bytes + (i + 1) * sizeof(T));
+      }
+    }
+    return true;
+  }
+
+private:
+  AbstractFilter* m_Filter = nullptr;
+  QDir m_Dir;
+  bool m_SwapBytes = false;
+};
+
+/**
+ * @brief The label lookups and sizes of the mesh that every frame's field outputs are placed into
+ */
+struct MeshIndex
+{
+  AbaqusMesh::LabelIndex nodes;
+  AbaqusMesh::LabelIndex elements;
+  size_t numVerts = 0;
+  size_t numCells = 0;
+  size_t numIntPoints = 1;
+};
+
+// -----------------------------------------------------------------------------
+bool readCount(const QJsonObject& object, const QString& key, size_t& count)
+{
+  double value = object.value(key).toDouble(-1.0);
+  if(value < 0.0 || value != std::floor(value))
+  {
+    return false;
+  }
+  count = static_cast<size_t>(value);
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+// Reads the NODAL and INTEGRATION_POINT field outputs of one frame
+// -----------------------------------------------------------------------------
+bool readFields(AbstractFilter* filter, const QString& manifestPath, const ArrayFileReader& files, const MeshIndex& mesh, const QJsonArray& fields, AbaqusBulkDataReader::Frame& frame)
+{
+  for(const QJsonValue& fieldValue : fields)
+  {
+    if(filter->getCancel())
+    {
+      return false;
+    }
+
+    QJsonObject field = fieldValue.toObject();
+    QString name = field.value("name").toString();
+    QString position = field.value("position").toString();
+
+    // Other output positions are listed by the script without any values
+    bool nodal = position == "NODAL";
+    if(!nodal && position != "INTEGRATION_POINT")
+    {
+      QString ss = QObject::tr("Skipping field output '%1' at unsupported position '%2'").arg(name, position);
+      filter->setWarningCondition(-106, ss);
+      continue;
+    }
+
+    size_t numValues = 0;
+    size_t numComp = 0;
+    if(name.isEmpty() || !readCount(field, "numValues", numValues) || !readCount(field, "numComponents", numComp) || numComp == 0)
+    {
+      QString ss = QObject::tr("Invalid field output entry in '%1'").arg(manifestPath);
+      filter->setErrorCondition(-108, ss);
+      return false;
+    }
+
+    filter->notifyStatusMessage(QObject::tr("Found %1 Data: %2").arg(nodal ? "Vertex" : "Cell", name));
+
+    // The values of all integration points of an element are stored as the components of one tuple
+    size_t numTuples = nodal ? mesh.numVerts : mesh.numCells;
+    size_t valuesPerTuple = nodal ? 1 : mesh.numIntPoints;
+    std::vector<size_t> cDims(1, numComp * valuesPerTuple);
+    FloatArrayType::Pointer data = FloatArrayType::CreateArray(numTuples, cDims, name, true);
+    float* values = data->getPointer(0);
+
+    std::vector<int32_t> labels(numValues);
+    std::vector<int32_t> intPoints;
+    if(!files.read(field, "labels", numValues, labels.data()))
+    {
+      return false;
+    }
+    if(!nodal)
+    {
+      intPoints.resize(numValues);
+      if(!files.read(field, "integrationPoints", numValues, intPoints.data()))
+      {
+        return false;
+      }
+    }
+
+    // The slot of each value is its tuple times the values per tuple plus its integration point
+    const AbaqusMesh::LabelIndex& index = nodal ? mesh.nodes : mesh.elements;
+    std::vector<size_t> slots(numValues);
+    bool inOrder = numValues == numTuples * valuesPerTuple;
+    for(size_t i = 0; i < numValues; i++)
+    {
+      int64_t tuple = index.find(labels[i]);
+      int64_t point = nodal ? 0 : static_cast<int64_t>(intPoints[i]) - 1;
+      if(tuple < 0 || point < 0 || point >= static_cast<int64_t>(valuesPerTuple))
+      {
+        QString ss = QObject::tr("Value %1 of field output '%2' belongs to %3 %4").arg(i).arg(name, nodal ? "unknown node" : "unknown element or integration point").arg(labels[i]);
+        filter->setErrorCondition(-110, ss);
+        return false;
+      }
+      slots[i] = static_cast<size_t>(tuple) * valuesPerTuple + static_cast<size_t>(point);
+      inOrder = inOrder && slots[i] == i;
+    }
+
+    // Values already in node or element order are read straight into the array
+    if(inOrder)
+    {
+      if(!files.read(field, "data", numValues * numComp, values))
+      {
+        return false;
+      }
+    }
+    else
+    {
+      std::vector<float> fieldValues(numValues * numComp);
+      if(!files.read(field, "data", fieldValues.size(), fieldValues.data()))
+      {
+        return false;
+      }
+      data->initializeWithZeros();
+      for(size_t i = 0; i < numValues; i++)
+      {
+        std::copy_n(fieldValues.data() + i * numComp, numComp, values + slots[i] * numComp);
+      }
+    }
+
+    (nodal ? frame.vertexArrays : frame.cellArrays).push_back(data);
+  }
+  return true;
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+bool AbaqusBulkDataReader::read(AbstractFilter* filter, const QString& manifestPath, Data& data)
+{
+  QFile manifestFile(manifestPath);
+  if(!manifestFile.open(QIODevice::ReadOnly))
+  {
+    QString ss = QObject::tr("Input file could not be opened: %1").arg(manifestPath);
+    filter->setErrorCondition(-100, ss);
+    return false;
+  }
+
+  QJsonParseError parseError;
+  QJsonDocument document = QJsonDocument::fromJson(manifestFile.readAll(), &parseError);
+  if(!document.isObject())
+  {
+    QString ss = QObject::tr("Invalid manifest '%1': %2").arg(manifestPath, parseError.errorString());
+    filter->setErrorCondition(-108, ss);
+    return false;
+  }
+  QJsonObject manifest = document.object();
+
+  MeshIndex mesh;
+  size_t nodesPerElement = 0;
+  size_t numCoords = 0;
+  if(!readCount(manifest, "numElements", mesh.numCells) || !readCount(manifest, "nodesPerElement", nodesPerElement) || !readCount(manifest, "numNodes", mesh.numVerts) ||
+     !readCount(manifest, "numCoords", numCoords) || numCoords == 0)
+  {
+    QString ss = QObject::tr("The manifest '%1' does not list the numbers of elements and nodes").arg(manifestPath);
+    filter->setErrorCondition(-108, ss);
+    return false;
+  }
+  size_t numVerts = mesh.numVerts;
+  size_t numCells = mesh.numCells;
+
+  QByteArray elementTypeName = manifest.value("elementType").toString().toLatin1();
+  AbaqusMesh::ElementType elementType;
+  if(!AbaqusMesh::findElementType(std::string_view(elementTypeName.constData(), static_cast<size_t>(elementTypeName.size())), elementType))
+  {
+    QString ss = QObject::tr("Unsupported ABAQUS element type '%1'").arg(QString::fromLatin1(elementTypeName));
+    filter->setErrorCondition(-102, ss);
+    return false;
+  }
+  if(nodesPerElement != elementType.numNodes)
+  {
+    QString ss = QObject::tr("The manifest '%1' lists %2 nodes per %3 element instead of %4").arg(manifestPath).arg(nodesPerElement).arg(QString::fromLatin1(elementTypeName)).arg(elementType.numNodes);
+    filter->setErrorCondition(-108, ss);
+    return false;
+  }
+  mesh.numIntPoints = elementType.numIntPoints;
+
+  // numpy writes the arrays in the byte order of the machine that ran the script
+  QString byteOrder = manifest.value("byteOrder").toString();
+  bool littleEndian = QSysInfo::ByteOrder == QSysInfo::LittleEndian;
+  bool swapBytes = (byteOrder == "little" && !littleEndian) || (byteOrder == "big" && littleEndian);
+  ArrayFileReader files(filter, manifestPath, swapBytes);
+
+  //
+  // Labels: ABAQUS refers to nodes and elements by label, the geometry by index
+  //
+  std::vector<int32_t> nodeLabels(numVerts);
+  std::vector<int32_t> elementLabels(numCells);
+  if(!files.read(manifest, "nodeLabels", numVerts, nodeLabels.data()) || !files.read(manifest, "elementLabels", numCells, elementLabels.data()))
+  {
+    return false;
+  }
+
+  if(!mesh.nodes.build(nodeLabels) || !mesh.elements.build(elementLabels))
+  {
+    QString ss = QObject::tr("The node and element labels listed in '%1' must be unique positive numbers").arg(manifestPath);
+    filter->setErrorCondition(-110, ss);
+    return false;
+  }
+
+  //
+  // Geometry, shared by every frame
+  //
+  AbaqusMesh::MeshGeometry geometry = AbaqusMesh::createGeometry(elementType, numVerts, numCells);
+
+  if(numCoords == 3)
+  {
+    if(!files.read(manifest, "coordinates", numVerts * 3, geometry.vertices))
+    {
+      return false;
+    }
+  }
+  else
+  {
+    std::vector<float> coordinates(numVerts * numCoords);
+    if(!files.read(manifest, "coordinates", coordinates.size(), coordinates.data()))
+    {
+      return false;
+    }
+    for(size_t i = 0; i < numVerts; i++)
+    {
+      for(size_t c = 0; c < 3; c++)
+      {
+        geometry.vertices[3 * i + c] = c < numCoords ? coordinates[i * numCoords + c] : 0.0f;
+      }
+    }
+  }
+
+  std::vector<int32_t> connectivity(numCells * nodesPerElement);
+  if(!files.read(manifest, "connectivity", connectivity.size(), connectivity.data()))
+  {
+    return false;
+  }
+  for(size_t i = 0; i < connectivity.size(); i++)
+  {
+    int64_t node = mesh.nodes.find(connectivity[i]);
+    if(node < 0)
+    {
+      QString ss = QObject::tr("Element %1 refers to node %2, which is not listed in '%3'").arg(elementLabels[i / nodesPerElement]).arg(connectivity[i]).arg(manifestPath);
+      filter->setErrorCondition(-110, ss);
+      return false;
+    }
+    geometry.connectivity[i] = static_cast<MeshIndexType>(node);
+  }
+  connectivity = std::vector<int32_t>();
+
+  //
+  // Field outputs of each frame. A manifest without a frame list holds the fields of a single frame.
+  //
+  QJsonArray frames = manifest.contains("frames") ? manifest.value("frames").toArray() : QJsonArray{manifest};
+  std::vector<Frame> frameData(static_cast<size_t>(frames.size()));
+  for(size_t i = 0; i < frameData.size(); i++)
+  {
+    QJsonObject frame = frames.at(static_cast<int>(i)).toObject();
+    frameData[i].frameNumber = frame.value("frame").toInt();
+    frameData[i].frameValue = static_cast<float>(frame.value("frameValue").toDouble());
+    filter->notifyStatusMessage(QObject::tr("Reading Vertex & Cell data of frame %1....").arg(frameData[i].frameNumber));
+    if(!readFields(filter, manifestPath, files, mesh, frame.value("fields").toArray(), frameData[i]))
+    {
+      return false;
+    }
+  }
+
+  data.geometry = geometry.geometry;
+  data.numVerts = numVerts;
+  data.numCells = numCells;
+  data.frames = std::move(frameData);
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+bool AbaqusBulkDataReader::read(AbstractFilter* filter, const QString& manifestPath, DataContainer& dataContainer, AttributeMatrix& vertexAttrMat, AttributeMatrix& cellAttrMat)
+{
+  Data data;
+  if(!read(filter, manifestPath, data))
+  {
+    return false;
+  }
+
+  dataContainer.setGeometry(data.geometry);
+  vertexAttrMat.resizeAttributeArrays(std::vector<size_t>(1, data.numVerts));
+  cellAttrMat.resizeAttributeArrays(std::vector<size_t>(1, data.numCells));
+  if(data.frames.empty())
+  {
+    return true;
+  }
+  for(const FloatArrayType::Pointer& array : data.frames.front().vertexArrays)
+  {
+    vertexAttrMat.insertOrAssign(array);
+  }
+  for(const FloatArrayType::Pointer& array : data.frames.front().cellArrays)
+  {
+    cellAttrMat.insertOrAssign(array);
+  }
+  return true;
+}
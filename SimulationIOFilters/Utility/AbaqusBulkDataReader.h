@@ -0,0 +1,101 @@
+/* ============================================================================
+ * Copyright (c) 2019-2019 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#pragma once
+
+#include <vector>
+
+#include <QtCore/QString>
+
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
+#include "SIMPLib/DataContainers/DataContainer.h"
+#include "SIMPLib/Filtering/AbstractFilter.h"
+#include "SIMPLib/Geometry/IGeometry.h"
+
+namespace AbaqusBulkDataReader
+{
+/**
+ * @brief The name of the manifest the ImportFEAData binary extraction script writes next to its array files
+ */
+const QString k_ManifestFileName("odbtobin.json");
+
+/**
+ * @brief The field outputs of one frame of the odb
+ */
+struct Frame
+{
+  int32_t frameNumber = 0;
+  float frameValue = 0.0f;
+  std::vector<FloatArrayType::Pointer> vertexArrays;
+  std::vector<FloatArrayType::Pointer> cellArrays;
+};
+
+/**
+ * @brief The mesh of the instance, read once and shared by every frame, and the field outputs of each frame
+ */
+struct Data
+{
+  IGeometry::Pointer geometry;
+  size_t numVerts = 0;
+  size_t numCells = 0;
+  std::vector<Frame> frames;
+};
+
+/**
+ * @brief Reads the raw arrays written by the ImportFEAData binary extraction script. The JSON manifest lists the
+ * element type, the node and element counts and, for every frame, the NODAL and INTEGRATION_POINT field outputs
+ * with their number of values and components together with the names of the raw int32/float32 files holding them.
+ * A manifest without a "frames" list holds the "fields" of a single frame. The coordinates, connectivity and field
+ * values are read straight into the geometry and float arrays; values are only scattered through the node and
+ * element labels when they are not already in node and element order. Errors are reported through filter.
+ * @param filter
+ * @param manifestPath
+ * @param data
+ * @return false if the data could not be read or the filter was canceled
+ */
+bool read(AbstractFilter* filter, const QString& manifestPath, Data& data);
+
+/**
+ * @brief Reads the mesh and the field outputs of the first frame listed in the manifest into the geometry of
+ * dataContainer and vertexAttrMat and cellAttrMat
+ * @param filter
+ * @param manifestPath
+ * @param dataContainer
+ * @param vertexAttrMat
+ * @param cellAttrMat
+ * @return false if the data could not be read or the filter was canceled
+ */
+bool read(AbstractFilter* filter, const QString& manifestPath, DataContainer& dataContainer, AttributeMatrix& vertexAttrMat, AttributeMatrix& cellAttrMat);
+} // namespace AbaqusBulkDataReader
@@ -0,0 +1,631 @@
+/* ============================================================================
+ * Copyright (c) 2019-2019 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include "AbaqusDatReader.h"
+
+#include <algorithm>
+#include <limits>
+#include <string_view>
+#include <vector>
+
+#include "SimulationIO/SimulationIOFilters/Utility/AbaqusMesh.h"
+#include "SimulationIO/SimulationIOFilters/Utility/MappedTextReader.hpp"
+#include "SimulationIO/SimulationIOFilters/Utility/SlabWriter.hpp"
+#include "SimulationIO/SimulationIOFilters/Utility/TaskPool.hpp"
+
+namespace
+{
+// -----------------------------------------------------------------------------
+// Parses the numValues values that follow the label at the start of a line
+// -----------------------------------------------------------------------------
+bool parseFloats(std::string_view line, size_t numValues, float* values)
+{
+  MappedTextReader::nextToken(line);
+  for(size_t i = 0; i < numValues; i++)
+  {
+    if(!MappedTextReader::parseFloat(MappedTextReader::nextToken(line), values[i]))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+// Parses the node labels of an element. ABAQUS numbers nodes from 1 to numVerts and the geometry from 0.
+// -----------------------------------------------------------------------------
+bool parseConnectivity(std::string_view line, size_t numNodes, size_t numVerts, MeshIndexType* nodes)
+{
+  MappedTextReader::nextToken(line);
+  for(size_t i = 0; i < numNodes; i++)
+  {
+    int64_t label = 0;
+    if(!MappedTextReader::parseInteger(MappedTextReader::nextToken(line), label) || label < 1 || static_cast<uint64_t>(label) > numVerts)
+    {
+      return false;
+    }
+    nodes[i] = static_cast<MeshIndexType>(label - 1);
+  }
+  return true;
+}
+
+/**
+ * @brief The data lines of one section of the file: the nodes, the elements or a field output
+ */
+struct Section
+{
+  enum class Kind
+  {
+    Nodes,
+    Elements,
+    Field
+  };
+
+  Kind kind = Kind::Field;
+  QString name;
+  size_t numLines = 0;
+  size_t valuesPerLine = 0;
+  size_t numVerts = 0;
+  float* values = nullptr;
+  MeshIndexType* connectivity = nullptr;
+  FloatArrayType::Pointer data;
+  AttributeMatrix* attrMat = nullptr;
+};
+
+/**
+ * @brief A run of consecutive data lines of one section, parsed as one task
+ */
+struct Block
+{
+  size_t section = 0;
+  size_t firstLine = 0;
+  size_t numLines = 0;
+  size_t offset = 0;
+};
+
+constexpr size_t k_LinesPerBlock = 16384;
+
+// -----------------------------------------------------------------------------
+// Skips the data lines of a section and records where each of its blocks starts. A truncated section is
+// detected when its blocks are parsed.
+// -----------------------------------------------------------------------------
+void indexSection(MappedTextReader::LineReader& reader, size_t section, size_t numLines, std::vector<Block>& blocks)
+{
+  for(size_t firstLine = 0; firstLine < numLines; firstLine += k_LinesPerBlock)
+  {
+    Block block;
+    block.section = section;
+    block.firstLine = firstLine;
+    block.numLines = std::min(k_LinesPerBlock, numLines - firstLine);
+    block.offset = reader.pos();
+    blocks.push_back(block);
+    reader.skipLines(block.numLines);
+  }
+}
+
+// -----------------------------------------------------------------------------
+// Parses the lines of a block into the arrays of its section. Returns the index of the first line of the
+// block that could not be parsed, or the number of lines in the block.
+// -----------------------------------------------------------------------------
+size_t parseBlock(std::string_view text, const Section& section, const Block& block)
+{
+  MappedTextReader::LineReader reader(text);
+  reader.seek(block.offset);
+  for(size_t i = 0; i < block.numLines; i++)
+  {
+    size_t line = block.firstLine + i;
+    bool ok = false;
+    switch(section.kind)
+    {
+    case Section::Kind::Nodes:
+    {
+      float* vertex = section.values + 3 * line;
+      vertex[2] = 0.0f;
+      ok = parseFloats(reader.readLine(), section.valuesPerLine, vertex);
+      break;
+    }
+    case Section::Kind::Elements:
+      ok = parseConnectivity(reader.readLine(), section.valuesPerLine, section.numVerts, section.connectivity + section.valuesPerLine * line);
+      break;
+    case Section::Kind::Field:
+      ok = parseFloats(reader.readLine(), section.valuesPerLine, section.values + section.valuesPerLine * line);
+      break;
+    }
+    if(!ok)
+    {
+      return i;
+    }
+  }
+  return block.numLines;
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+bool AbaqusDatReader::read(AbstractFilter* filter, const QString& filePath, DataContainer& dataContainer, AttributeMatrix& vertexAttrMat, AttributeMatrix& cellAttrMat, int32_t numThreads)
+{
+  MappedTextReader::MappedFile file;
+  if(!file.open(filePath))
+  {
+    QString ss = QObject::tr("Input file could not be opened: %1").arg(filePath);
+    filter->setErrorCondition(-100, ss);
+    return false;
+  }
+
+  //
+  // Pass 1: index the start of every section and of every block of lines within it
+  //
+  MappedTextReader::LineReader reader(file.text());
+  std::vector<std::string_view> tokens;
+  std::vector<Section> sections(2);
+  std::vector<Block> blocks;
+
+  Section& elementsSection = sections[0];
+  Section& nodesSection = sections[1];
+  elementsSection.kind = Section::Kind::Elements;
+  elementsSection.name = "ELEMENTS";
+  nodesSection.kind = Section::Kind::Nodes;
+  nodesSection.name = "NODES";
+
+  bool foundElements = false;
+  bool foundNodes = false;
+  std::string_view elementTypeName;
+  while(!reader.atEnd() && !(foundElements && foundNodes))
+  {
+    if(MappedTextReader::tokenize(reader.readLine(), tokens) < 2)
+    {
+      continue;
+    }
+    if(!foundElements && tokens[0] == "ELEMENTS" && tokens.size() >= 3 && MappedTextReader::parseInteger(tokens[1], elementsSection.numLines))
+    {
+      foundElements = true;
+      elementTypeName = tokens[2];
+      indexSection(reader, 0, elementsSection.numLines, blocks);
+    }
+    else if(!foundNodes && tokens[0] == "NODES" && MappedTextReader::parseInteger(tokens[1], nodesSection.numLines))
+    {
+      foundNodes = true;
+      indexSection(reader, 1, nodesSection.numLines, blocks);
+    }
+  }
+
+  if(!foundElements || !foundNodes)
+  {
+    QString ss = QObject::tr("Could not find the %1 section in '%2'").arg(foundElements ? "NODES" : "ELEMENTS", filePath);
+    filter->setErrorCondition(-101, ss);
+    return false;
+  }
+
+  AbaqusMesh::ElementType elementType;
+  if(!AbaqusMesh::findElementType(elementTypeName, elementType))
+  {
+    QString ss = QObject::tr("Unsupported ABAQUS element type '%1'").arg(QString::fromLatin1(elementTypeName.data(), static_cast<int>(elementTypeName.size())));
+    filter->setErrorCondition(-102, ss);
+    return false;
+  }
+
+  size_t numCells = elementsSection.numLines;
+  size_t numVerts = nodesSection.numLines;
+
+  vertexAttrMat.resizeAttributeArrays(std::vector<size_t>(1, numVerts));
+  cellAttrMat.resizeAttributeArrays(std::vector<size_t>(1, numCells));
+
+  AbaqusMesh::MeshGeometry mesh = AbaqusMesh::createGeometry(elementType, numVerts, numCells);
+  dataContainer.setGeometry(mesh.geometry);
+
+  elementsSection.valuesPerLine = elementType.numNodes;
+  elementsSection.numVerts = numVerts;
+  elementsSection.connectivity = mesh.connectivity;
+  nodesSection.valuesPerLine = elementType.numCoords;
+  nodesSection.values = mesh.vertices;
+
+  // The field outputs follow the connectivity
+  filter->notifyStatusMessage("Scanning for Vertex & Cell data....");
+  while(!reader.atEnd())
+  {
+    if(filter->getCancel())
+    {
+      return false;
+    }
+
+    if(MappedTextReader::tokenize(reader.readLine(), tokens) == 0)
+    {
+      continue;
+    }
+    if(tokens.size() < 3)
+    {
+      QString ss = QObject::tr("Invalid field output header in '%1'").arg(filePath);
+      filter->setErrorCondition(-105, ss);
+      return false;
+    }
+
+    std::string_view position = tokens[0];
+    std::string_view fieldType = tokens[1];
+    QString name = QString::fromLatin1(tokens[2].data(), static_cast<int>(tokens[2].size()));
+
+    // Other output positions are listed by the script without any values
+    size_t numTuples = 0;
+    size_t linesPerTuple = 1;
+    AttributeMatrix* attrMat = nullptr;
+    if(position == "NODAL")
+    {
+      numTuples = numVerts;
+      attrMat = &vertexAttrMat;
+    }
+    else if(position == "INTEGRATION_POINT")
+    {
+      numTuples = numCells;
+      linesPerTuple = elementType.numIntPoints;
+      attrMat = &cellAttrMat;
+    }
+    if(attrMat == nullptr || numTuples == 0)
+    {
+      continue;
+    }
+
+    size_t numLines = numTuples * linesPerTuple;
+    int32_t numComp = AbaqusMesh::numComponents(fieldType, elementType.spatialDimensionality);
+    if(numComp == 0)
+    {
+      QString ss = QObject::tr("Skipping field output '%1' of unsupported type '%2'").arg(name, QString::fromLatin1(fieldType.data(), static_cast<int>(fieldType.size())));
+      filter->setWarningCondition(-106, ss);
+      reader.skipLines(numLines);
+      continue;
+    }
+
+    filter->notifyStatusMessage(QObject::tr("Found %1 Data: %2").arg(attrMat == &vertexAttrMat ? "Vertex" : "Cell", name));
+
+    // The values of all integration points of an element are stored as the components of one tuple
+    std::vector<size_t> cDims(1, static_cast<size_t>(numComp) * linesPerTuple);
+    Section section;
+    section.kind = Section::Kind::Field;
+    section.name = name;
+    section.numLines = numLines;
+    section.valuesPerLine = static_cast<size_t>(numComp);
+    section.data = FloatArrayType::CreateArray(numTuples, cDims, name, true);
+    section.values = section.data->getPointer(0);
+    section.attrMat = attrMat;
+    sections.push_back(section);
+
+    indexSection(reader, sections.size() - 1, numLines, blocks);
+  }
+
+  //
+  // Pass 2: parse the blocks in parallel, each into its own range of the pre-sized arrays
+  //
+  std::string_view text = file.text();
+  std::vector<size_t> parsedLines(blocks.size(), 0);
+
+  auto parseTask = [text, &sections, &blocks, &parsedLines](size_t index) {
+    const Block& block = blocks[index];
+    parsedLines[index] = parseBlock(text, sections[block.section], block);
+  };
+
+  int32_t percentReported = -1;
+  auto reportProgress = [filter, &blocks, &percentReported](size_t numFinished) {
+    int32_t percent = static_cast<int32_t>(numFinished * 100 / blocks.size());
+    if(percent != percentReported)
+    {
+      percentReported = percent;
+      filter->notifyStatusMessage(QObject::tr("Parsing ABAQUS data: %1%").arg(percent));
+    }
+  };
+
+  std::vector<size_t> blockCosts(blocks.size(), 0);
+  TaskPool::run(blocks.size(), SlabWriter::resolveThreadCount(numThreads), 0, blockCosts, parseTask, reportProgress, [filter]() { return filter->getCancel(); });
+
+  if(filter->getCancel())
+  {
+    return false;
+  }
+
+  for(size_t index = 0; index < blocks.size(); index++)
+  {
+    const Block& block = blocks[index];
+    if(parsedLines[index] == block.numLines)
+    {
+      continue;
+    }
+    const Section& section = sections[block.section];
+    size_t line = block.firstLine + parsedLines[index] + 1;
+    switch(section.kind)
+    {
+    case Section::Kind::Nodes:
+      filter->setErrorCondition(-103, QObject::tr("Invalid or missing coordinates for node %1 of %2 in '%3'").arg(line).arg(section.numLines).arg(filePath));
+      break;
+    case Section::Kind::Elements:
+      filter->setErrorCondition(-104, QObject::tr("Invalid or missing connectivity for element %1 of %2 in '%3'").arg(line).arg(section.numLines).arg(filePath));
+      break;
+    case Section::Kind::Field:
+      filter->setErrorCondition(-107, QObject::tr("Invalid or missing values on line %1 of field output '%2' in '%3'").arg(line).arg(section.name, filePath));
+      break;
+    }
+    return false;
+  }
+
+  for(const Section& section : sections)
+  {
+    if(section.kind == Section::Kind::Field)
+    {
+      section.attrMat->insertOrAssign(section.data);
+    }
+  }
+
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+AbaqusDatReader::StreamParser::StreamParser(AbstractFilter* filter, DataContainer& dataContainer, AttributeMatrix& vertexAttrMat, AttributeMatrix& cellAttrMat)
+: m_Filter(filter)
+, m_DataContainer(dataContainer)
+, m_VertexAttrMat(vertexAttrMat)
+, m_CellAttrMat(cellAttrMat)
+{
+}
+
+// -----------------------------------------------------------------------------
+bool AbaqusDatReader::StreamParser::append(const char* data, size_t size)
+{
+  std::string_view text(data, size);
+  size_t lineStart = 0;
+  for(size_t lineEnd = text.find('\n'); lineEnd != std::string_view::npos; lineEnd = text.find('\n', lineStart))
+  {
+    std::string_view line = text.substr(lineStart, lineEnd - lineStart);
+    lineStart = lineEnd + 1;
+
+    // A line split across two chunks is completed in the pending buffer
+    if(!m_PendingLine.empty())
+    {
+      m_PendingLine.append(line.data(), line.size());
+      line = m_PendingLine;
+    }
+    bool ok = parseLine(line);
+    m_PendingLine.clear();
+    if(!ok)
+    {
+      return false;
+    }
+  }
+  m_PendingLine.append(text.data() + lineStart, text.size() - lineStart);
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+bool AbaqusDatReader::StreamParser::finish()
+{
+  if(!m_PendingLine.empty())
+  {
+    bool ok = parseLine(m_PendingLine);
+    m_PendingLine.clear();
+    if(!ok)
+    {
+      return false;
+    }
+  }
+
+  if(!m_FoundElements || !m_FoundNodes)
+  {
+    QString ss = QObject::tr("Could not find the %1 section in the ABAQUS output").arg(m_FoundElements ? "NODES" : "ELEMENTS");
+    m_Filter->setErrorCondition(-101, ss);
+    return false;
+  }
+  if(m_Section != Section::None && m_Section != Section::Skipped)
+  {
+    reportInvalidLine();
+    return false;
+  }
+  auto invalidNode = std::find_if(m_Connectivity.cbegin(), m_Connectivity.cend(), [this](MeshIndexType node) { return node >= m_NumVerts; });
+  if(invalidNode != m_Connectivity.cend())
+  {
+    size_t element = static_cast<size_t>(invalidNode - m_Connectivity.cbegin()) / m_ElementType.numNodes + 1;
+    m_Filter->setErrorCondition(-104, QObject::tr("Invalid or missing connectivity for element %1 of %2 in the ABAQUS output").arg(element).arg(m_NumCells));
+    return false;
+  }
+
+  AbaqusMesh::MeshGeometry mesh = AbaqusMesh::createGeometry(m_ElementType, m_NumVerts, m_NumCells);
+  std::copy(m_Vertices.cbegin(), m_Vertices.cend(), mesh.vertices);
+  std::copy(m_Connectivity.cbegin(), m_Connectivity.cend(), mesh.connectivity);
+  m_Vertices = std::vector<float>();
+  m_Connectivity = std::vector<MeshIndexType>();
+  m_DataContainer.setGeometry(mesh.geometry);
+
+  m_VertexAttrMat.resizeAttributeArrays(std::vector<size_t>(1, m_NumVerts));
+  m_CellAttrMat.resizeAttributeArrays(std::vector<size_t>(1, m_NumCells));
+  for(const auto& array : m_Arrays)
+  {
+    array.first->insertOrAssign(array.second);
+  }
+  m_Arrays.clear();
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+bool AbaqusDatReader::StreamParser::parseLine(std::string_view line)
+{
+  if(m_Section == Section::None)
+  {
+    return parseHeader(line);
+  }
+
+  bool ok = parseDataLine(line);
+  if(!ok)
+  {
+    reportInvalidLine();
+    return false;
+  }
+  if(++m_Line == m_NumLines)
+  {
+    m_Section = Section::None;
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+// Mirrors the section headers read() accepts: lines before the ELEMENTS and NODES sections are ignored, every
+// other non-empty line after them must name a field output.
+// -----------------------------------------------------------------------------
+bool AbaqusDatReader::StreamParser::parseHeader(std::string_view line)
+{
+  size_t numTokens = MappedTextReader::tokenize(line, m_Tokens);
+  if(!m_FoundElements || !m_FoundNodes)
+  {
+    size_t numLines = 0;
+    if(numTokens < 2)
+    {
+      return true;
+    }
+    if(!m_FoundElements && m_Tokens[0] == "ELEMENTS" && numTokens >= 3 && MappedTextReader::parseInteger(m_Tokens[1], numLines))
+    {
+      if(!AbaqusMesh::findElementType(m_Tokens[2], m_ElementType))
+      {
+        QString ss = QObject::tr("Unsupported ABAQUS element type '%1'").arg(QString::fromLatin1(m_Tokens[2].data(), static_cast<int>(m_Tokens[2].size())));
+        m_Filter->setErrorCondition(-102, ss);
+        return false;
+      }
+      m_FoundElements = true;
+      m_NumCells = numLines;
+      m_Connectivity.resize(numLines * m_ElementType.numNodes);
+      startSection(Section::Elements, numLines, m_ElementType.numNodes);
+    }
+    else if(!m_FoundNodes && m_Tokens[0] == "NODES" && MappedTextReader::parseInteger(m_Tokens[1], numLines))
+    {
+      m_FoundNodes = true;
+      m_NumVerts = numLines;
+      m_Vertices.resize(numLines * 3);
+      startSection(Section::Nodes, numLines, m_FoundElements ? m_ElementType.numCoords : 3);
+    }
+    return true;
+  }
+
+  if(numTokens == 0)
+  {
+    return true;
+  }
+  if(numTokens < 3)
+  {
+    m_Filter->setErrorCondition(-105, QObject::tr("Invalid field output header in the ABAQUS output"));
+    return false;
+  }
+
+  std::string_view position = m_Tokens[0];
+  std::string_view fieldType = m_Tokens[1];
+  m_FieldName = QString::fromLatin1(m_Tokens[2].data(), static_cast<int>(m_Tokens[2].size()));
+
+  // Other output positions are listed by the script without any values
+  size_t numTuples = 0;
+  size_t linesPerTuple = 1;
+  AttributeMatrix* attrMat = nullptr;
+  if(position == "NODAL")
+  {
+    numTuples = m_NumVerts;
+    attrMat = &m_VertexAttrMat;
+  }
+  else if(position == "INTEGRATION_POINT")
+  {
+    numTuples = m_NumCells;
+    linesPerTuple = m_ElementType.numIntPoints;
+    attrMat = &m_CellAttrMat;
+  }
+  if(attrMat == nullptr || numTuples == 0)
+  {
+    return true;
+  }
+
+  size_t numLines = numTuples * linesPerTuple;
+  int32_t numComp = AbaqusMesh::numComponents(fieldType, m_ElementType.spatialDimensionality);
+  if(numComp == 0)
+  {
+    QString ss = QObject::tr("Skipping field output '%1' of unsupported type '%2'").arg(m_FieldName, QString::fromLatin1(fieldType.data(), static_cast<int>(fieldType.size())));
+    m_Filter->setWarningCondition(-106, ss);
+    startSection(Section::Skipped, numLines, 0);
+    return true;
+  }
+
+  m_Filter->notifyStatusMessage(QObject::tr("Found %1 Data: %2").arg(attrMat == &m_VertexAttrMat ? "Vertex" : "Cell", m_FieldName));
+
+  // The values of all integration points of an element are stored as the components of one tuple
+  std::vector<size_t> cDims(1, static_cast<size_t>(numComp) * linesPerTuple);
+  FloatArrayType::Pointer data = FloatArrayType::CreateArray(numTuples, cDims, m_FieldName, true);
+  m_FieldValues = data->getPointer(0);
+  m_Arrays.emplace_back(attrMat, data);
+  startSection(Section::Field, numLines, static_cast<size_t>(numComp));
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+bool AbaqusDatReader::StreamParser::parseDataLine(std::string_view line)
+{
+  switch(m_Section)
+  {
+  case Section::Elements:
+    // The node labels are checked against the number of nodes in finish() when the nodes follow the elements
+    return parseConnectivity(line, m_ValuesPerLine, m_FoundNodes ? m_NumVerts : std::numeric_limits<size_t>::max(), m_Connectivity.data() + m_ValuesPerLine * m_Line);
+  case Section::Nodes:
+  {
+    float* vertex = m_Vertices.data() + 3 * m_Line;
+    vertex[2] = 0.0f;
+    return parseFloats(line, m_ValuesPerLine, vertex);
+  }
+  case Section::Field:
+    return parseFloats(line, m_ValuesPerLine, m_FieldValues + m_ValuesPerLine * m_Line);
+  default:
+    return true;
+  }
+}
+
+// -----------------------------------------------------------------------------
+void AbaqusDatReader::StreamParser::startSection(Section section, size_t numLines, size_t valuesPerLine)
+{
+  m_Section = numLines > 0 ? section : Section::None;
+  m_NumLines = numLines;
+  m_Line = 0;
+  m_ValuesPerLine = valuesPerLine;
+}
+
+// -----------------------------------------------------------------------------
+void AbaqusDatReader::StreamParser::reportInvalidLine()
+{
+  size_t line = m_Line + 1;
+  switch(m_Section)
+  {
+  case Section::Nodes:
+    m_Filter->setErrorCondition(-103, QObject::tr("Invalid or missing coordinates for node %1 of %2 in the ABAQUS output").arg(line).arg(m_NumLines));
+    break;
+  case Section::Elements:
+    m_Filter->setErrorCondition(-104, QObject::tr("Invalid or missing connectivity for element %1 of %2 in the ABAQUS output").arg(line).arg(m_NumLines));
+    break;
+  default:
+    m_Filter->setErrorCondition(-107, QObject::tr("Invalid or missing values on line %1 of field output '%2' in the ABAQUS output").arg(line).arg(m_FieldName));
+    break;
+  }
+}
@@ -0,0 +1,141 @@
+/* ============================================================================
+ * Copyright (c) 2019-2019 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <QtCore/QString>
+
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
+#include "SIMPLib/DataContainers/DataContainer.h"
+#include "SIMPLib/Filtering/AbstractFilter.h"
+
+#include "SimulationIO/SimulationIOFilters/Utility/AbaqusMesh.h"
+
+namespace AbaqusDatReader
+{
+/**
+ * @brief Reads the odbtotxt.dat file written by the ImportFEAData ABAQUS python script. The ELEMENTS and NODES
+ * sections become the geometry of dataContainer, and every NODAL and INTEGRATION_POINT field output becomes a float
+ * array in vertexAttrMat and cellAttrMat respectively. The file is memory mapped and parsed in place: a first pass
+ * indexes the byte offset of every section and of every block of lines within it, then the blocks are parsed in
+ * parallel on numThreads threads (0 uses all cores) straight into the pre-sized arrays. Errors are reported through
+ * filter.
+ * @param filter
+ * @param filePath
+ * @param dataContainer
+ * @param vertexAttrMat
+ * @param cellAttrMat
+ * @param numThreads
+ * @return false if the file could not be read or the filter was canceled
+ */
+bool read(AbstractFilter* filter, const QString& filePath, DataContainer& dataContainer, AttributeMatrix& vertexAttrMat, AttributeMatrix& cellAttrMat, int32_t numThreads = 0);
+
+/**
+ * @brief Parses the text of an odbtotxt.dat file as it arrives, for instance from the standard output of the ABAQUS
+ * python script while it is still extracting the odb. It accepts the same sections as read(). The nodes and elements
+ * are collected until finish() creates the geometry, and the values of each field output are parsed straight into
+ * its array. Errors are reported through filter.
+ */
+class StreamParser
+{
+public:
+  StreamParser(AbstractFilter* filter, DataContainer& dataContainer, AttributeMatrix& vertexAttrMat, AttributeMatrix& cellAttrMat);
+  ~StreamParser() = default;
+
+  StreamParser(const StreamParser&) = delete;
+  StreamParser(StreamParser&&) = delete;
+  StreamParser& operator=(const StreamParser&) = delete;
+  StreamParser& operator=(StreamParser&&) = delete;
+
+  /**
+   * @brief Parses every complete line of data and keeps the trailing partial line for the next call
+   * @param data
+   * @param size
+   * @return false if the text could not be parsed
+   */
+  bool append(const char* data, size_t size);
+
+  /**
+   * @brief Parses the last line, checks that no section was cut short and moves the geometry and arrays into the
+   * data container
+   * @return false if the text could not be parsed
+   */
+  bool finish();
+
+private:
+  enum class Section
+  {
+    None,
+    Elements,
+    Nodes,
+    Field,
+    Skipped
+  };
+
+  bool parseLine(std::string_view line);
+  bool parseHeader(std::string_view line);
+  bool parseDataLine(std::string_view line);
+  void startSection(Section section, size_t numLines, size_t valuesPerLine);
+  void reportInvalidLine();
+
+  AbstractFilter* m_Filter = nullptr;
+  DataContainer& m_DataContainer;
+  AttributeMatrix& m_VertexAttrMat;
+  AttributeMatrix& m_CellAttrMat;
+
+  std::string m_PendingLine;
+  std::vector<std::string_view> m_Tokens;
+  Section m_Section = Section::None;
+  size_t m_NumLines = 0;
+  size_t m_Line = 0;
+  size_t m_ValuesPerLine = 0;
+
+  bool m_FoundElements = false;
+  bool m_FoundNodes = false;
+  size_t m_NumVerts = 0;
+  size_t m_NumCells = 0;
+  AbaqusMesh::ElementType m_ElementType;
+  std::vector<float> m_Vertices;
+  std::vector<MeshIndexType> m_Connectivity;
+
+  QString m_FieldName;
+  float* m_FieldValues = nullptr;
+  std::vector<std::pair<AttributeMatrix*, FloatArrayType::Pointer>> m_Arrays;
+};
+} // namespace AbaqusDatReader
@@ -0,0 +1,758 @@
+/* ============================================================================
+ * Copyright (c) 2019-2019 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+
+#include "AbaqusFilReader.h"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <limits>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <QtCore/QFile>
+
+#include "SimulationIO/SimulationIOFilters/Utility/AbaqusMesh.h"
+
+namespace
+{
+constexpr qint64 k_WordSize = 8;
+constexpr qint64 k_BlockSize = 512 * k_WordSize;
+constexpr qint64 k_BlocksPerRead = 256;
+constexpr int32_t k_BlockMarker = static_cast<int32_t>(k_BlockSize);
+constexpr int64_t k_MaxRecordLength = 1 << 24;
+constexpr size_t k_CancelCheckInterval = 4096;
+
+constexpr int64_t k_ElementHeader = 1;
+constexpr int64_t k_ElementDefinition = 1900;
+constexpr int64_t k_NodeDefinition = 1901;
+constexpr int64_t k_IncrementStart = 2000;
+constexpr int64_t k_IncrementEnd = 2001;
+
+/**
+ * @brief The result records that are imported, named like the field outputs of the odb
+ */
+struct ResultType
+{
+  int64_t key;
+  const char* name;
+  bool nodal;
+};
+
+const std::array<ResultType, 18> k_ResultTypes = {{{2, "TEMP", false},
+                                                   {5, "SDV", false},
+                                                   {8, "COORD", false},
+                                                   {11, "S", false},
+                                                   {12, "SINV", false},
+                                                   {21, "E", false},
+                                                   {22, "PE", false},
+                                                   {23, "CE", false},
+                                                   {24, "IE", false},
+                                                   {25, "EE", false},
+                                                   {89, "LE", false},
+                                                   {101, "U", true},
+                                                   {102, "V", true},
+                                                   {103, "A", true},
+                                                   {104, "RF", true},
+                                                   {106, "CF", true},
+                                                   {107, "COORD", true},
+                                                   {201, "NT", true}}};
+
+// -----------------------------------------------------------------------------
+const ResultType* findResultType(int64_t key)
+{
+  auto iter = std::find_if(k_ResultTypes.begin(), k_ResultTypes.end(), [key](const ResultType& type) { return type.key == key; });
+  return iter == k_ResultTypes.end() ? nullptr : &(*iter);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+T swapped(T value)
+{
+  char* bytes = reinterpret_cast<char*>(&value);
+  std::reverse(bytes, bytes + sizeof(T));
+  return value;
+}
+
+/**
+ * @brief Splits the results file into records of 8 byte words. ABAQUS writes the file as a FORTRAN sequential file
+ * of 512 word blocks, each framed by 4 byte length markers; files copied without the markers are read as well.
+ * Records run across block boundaries.
+ */
+class RecordReader
+{
+public:
+  RecordReader(AbstractFilter* filter, const QString& filePath)
+  : m_Filter(filter)
+  , m_FilePath(filePath)
+  , m_File(filePath)
+  {
+  }
+
+  /**
+   * @brief Opens the file and detects its layout and byte order from the first block
+   * @return false if the file could not be opened or is not a binary results file
+   */
+  bool open()
+  {
+    if(!m_File.open(QIODevice::ReadOnly))
+    {
+      QString ss = QObject::tr("Input file could not be opened: %1").arg(m_FilePath);
+      m_Filter->setErrorCondition(-100, ss);
+      return false;
+    }
+
+    int32_t marker = 0;
+    int64_t length = 0;
+    if(m_File.peek(reinterpret_cast<char*>(&marker), sizeof(marker)) != sizeof(marker) || m_File.peek(reinterpret_cast<char*>(&length), sizeof(length)) != sizeof(length))
+    {
+      return fail(QObject::tr("The results file '%1' is empty").arg(m_FilePath));
+    }
+
+    // The first word of the data is the length of the first record
+    if(marker == k_BlockMarker || swapped(marker) == k_BlockMarker)
+    {
+      m_Framed = true;
+      m_SwapBytes = marker != k_BlockMarker;
+    }
+    else if((length < 2 || length > k_MaxRecordLength) && swapped(length) >= 2 && swapped(length) <= k_MaxRecordLength)
+    {
+      m_SwapBytes = true;
+    }
+    else if(length < 2 || length > k_MaxRecordLength)
+    {
+      return fail(QObject::tr("'%1' is not a binary ABAQUS results file. ASCII results files written with *FILE FORMAT, ASCII are not supported.").arg(m_FilePath));
+    }
+    return true;
+  }
+
+  /**
+   * @brief Reads the next record. record[0] is its length in words, record[1] its key and the attributes follow.
+   * @param record
+   * @return false at the end of the data or if the file is damaged, which failed() tells apart
+   */
+  bool next(std::vector<uint64_t>& record)
+  {
+    uint64_t word = 0;
+    if(!nextWord(word))
+    {
+      return false;
+    }
+
+    // The rest of the last block is padded after the final record
+    int64_t length = integer(word);
+    if(length < 2)
+    {
+      return false;
+    }
+    if(length > k_MaxRecordLength)
+    {
+      return fail(QObject::tr("Invalid record length %1 in the results file '%2'").arg(length).arg(m_FilePath));
+    }
+
+    record.resize(static_cast<size_t>(length));
+    record[0] = word;
+    for(size_t i = 1; i < record.size(); i++)
+    {
+      if(!nextWord(record[i]))
+      {
+        return m_Failed ? false : fail(QObject::tr("The results file '%1' ends in the middle of a record").arg(m_FilePath));
+      }
+    }
+    return true;
+  }
+
+  bool failed() const
+  {
+    return m_Failed;
+  }
+
+  int64_t integer(uint64_t word) const
+  {
+    int64_t value = 0;
+    std::memcpy(&value, &word, sizeof(value));
+    return m_SwapBytes ? swapped(value) : value;
+  }
+
+  double real(uint64_t word) const
+  {
+    uint64_t bits = m_SwapBytes ? swapped(word) : word;
+    double value = 0.0;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+  }
+
+  /**
+   * @brief Returns the 8 characters of an A8 word without the trailing blanks. Characters keep their order in either
+   * byte order.
+   */
+  static std::string text(uint64_t word)
+  {
+    std::string value(reinterpret_cast<const char*>(&word), sizeof(word));
+    value.erase(value.find_last_not_of(std::string(" \0", 2)) + 1);
+    return value;
+  }
+
+private:
+  // -----------------------------------------------------------------------------
+  bool fail(const QString& message)
+  {
+    m_Filter->setErrorCondition(-113, message);
+    m_Failed = true;
+    return false;
+  }
+
+  // -----------------------------------------------------------------------------
+  bool nextWord(uint64_t& word)
+  {
+    if(m_Offset == m_Words.size() && !fill())
+    {
+      return false;
+    }
+    word = m_Words[m_Offset++];
+    return true;
+  }
+
+  // -----------------------------------------------------------------------------
+  // Reads the next blocks of the file and strips their length markers
+  // -----------------------------------------------------------------------------
+  bool fill()
+  {
+    qint64 blockSize = m_Framed ? k_BlockSize + 8 : k_BlockSize;
+    m_Buffer.resize(static_cast<size_t>(blockSize * k_BlocksPerRead));
+    qint64 numRead = m_File.read(m_Buffer.data(), static_cast<qint64>(m_Buffer.size()));
+    if(numRead <= 0)
+    {
+      return numRead < 0 ? fail(QObject::tr("Error reading the results file '%1'").arg(m_FilePath)) : false;
+    }
+    if((m_Framed && numRead % blockSize != 0) || numRead % k_WordSize != 0)
+    {
+      return fail(QObject::tr("The results file '%1' is truncated").arg(m_FilePath));
+    }
+
+    m_Offset = 0;
+    if(!m_Framed)
+    {
+      m_Words.resize(static_cast<size_t>(numRead / k_WordSize));
+      std::memcpy(m_Words.data(), m_Buffer.data(), static_cast<size_t>(numRead));
+      return true;
+    }
+
+    qint64 numBlocks = numRead / blockSize;
+    m_Words.resize(static_cast<size_t>(numBlocks * (k_BlockSize / k_WordSize)));
+    for(qint64 i = 0; i < numBlocks; i++)
+    {
+      const char* block = m_Buffer.data() + i * blockSize;
+      int32_t head = 0;
+      int32_t tail = 0;
+      std::memcpy(&head, block, sizeof(head));
+      std::memcpy(&tail, block + 4 + k_BlockSize, sizeof(tail));
+      if(head != tail || (m_SwapBytes ? swapped(head) : head) != k_BlockMarker)
+      {
+        return fail(QObject::tr("Invalid block marker in the results file '%1'").arg(m_FilePath));
+      }
+      std::memcpy(m_Words.data() + i * (k_BlockSize / k_WordSize), block + 4, static_cast<size_t>(k_BlockSize));
+    }
+    return true;
+  }
+
+  AbstractFilter* m_Filter = nullptr;
+  QString m_FilePath;
+  QFile m_File;
+  bool m_Framed = false;
+  bool m_SwapBytes = false;
+  bool m_Failed = false;
+  std::vector<char> m_Buffer;
+  std::vector<uint64_t> m_Words;
+  size_t m_Offset = 0;
+};
+
+/**
+ * @brief Collects the model definition and the results of the selected increment from the records of a results file
+ */
+class FilParser
+{
+public:
+  FilParser(AbstractFilter* filter, const QString& filePath, const RecordReader& reader, int32_t stepNumber, int32_t incrementNumber)
+  : m_Filter(filter)
+  , m_FilePath(filePath)
+  , m_Reader(reader)
+  , m_StepNumber(stepNumber)
+  , m_IncrementNumber(incrementNumber)
+  {
+  }
+
+  /**
+   * @brief Handles one record
+   * @param record
+   * @return false on an error or once the selected increment is complete
+   */
+  bool parse(const std::vector<uint64_t>& record)
+  {
+    int64_t key = m_Reader.integer(record[1]);
+    const uint64_t* attributes = record.data() + 2;
+    size_t numAttributes = record.size() - 2;
+
+    switch(key)
+    {
+    case k_ElementDefinition:
+      return readElement(attributes, numAttributes);
+    case k_NodeDefinition:
+      return readNode(attributes, numAttributes);
+    case k_IncrementStart:
+      return startIncrement(attributes, numAttributes);
+    case k_IncrementEnd:
+      // A single selected increment is complete, the rest of the file is not needed
+      m_Done = m_Collecting && m_IncrementNumber > 0;
+      m_Collecting = false;
+      return !m_Done;
+    default:
+      break;
+    }
+
+    if(!m_Collecting)
+    {
+      return true;
+    }
+    if(key == k_ElementHeader)
+    {
+      return readElementHeader(attributes, numAttributes);
+    }
+    const ResultType* type = findResultType(key);
+    if(type != nullptr)
+    {
+      return readResults(*type, attributes, numAttributes);
+    }
+    if(key < k_ElementDefinition)
+    {
+      warnOnce(key, QObject::tr("Skipping the results with record key %1, which are not supported").arg(key));
+    }
+    return true;
+  }
+
+  bool done() const
+  {
+    return m_Done;
+  }
+
+  /**
+   * @brief Creates the geometry and hands the arrays of the selected increment to the attribute matrices
+   * @return false if the model definition or the selected increment were not found
+   */
+  bool finish(DataContainer& dataContainer, AttributeMatrix& vertexAttrMat, AttributeMatrix& cellAttrMat)
+  {
+    if(!m_MeshBuilt && !buildMesh())
+    {
+      return false;
+    }
+    if(!m_FoundIncrement)
+    {
+      QString increment = m_IncrementNumber > 0 ? QObject::tr("increment %1").arg(m_IncrementNumber) : QObject::tr("any increment");
+      QString ss = QObject::tr("Could not find %1 of step %2 in the results file '%3'").arg(increment).arg(m_StepNumber).arg(m_FilePath);
+      m_Filter->setErrorCondition(-114, ss);
+      return false;
+    }
+
+    dataContainer.setGeometry(m_Geometry.geometry);
+    vertexAttrMat.resizeAttributeArrays(std::vector<size_t>(1, m_NodeLabels.size()));
+    cellAttrMat.resizeAttributeArrays(std::vector<size_t>(1, m_ElementLabels.size()));
+    for(const Field& field : m_Fields)
+    {
+      (field.nodal ? vertexAttrMat : cellAttrMat).insertOrAssign(field.data);
+    }
+    return true;
+  }
+
+private:
+  /**
+   * @brief The array of one result record key in the selected increment
+   */
+  struct Field
+  {
+    int64_t key = 0;
+    bool nodal = false;
+    size_t numComp = 0;
+    FloatArrayType::Pointer data;
+  };
+
+  // -----------------------------------------------------------------------------
+  bool readLabel(uint64_t word, int32_t& label) const
+  {
+    int64_t value = m_Reader.integer(word);
+    label = static_cast<int32_t>(value);
+    return value > 0 && value <= std::numeric_limits<int32_t>::max();
+  }
+
+  // -----------------------------------------------------------------------------
+  void warnOnce(int64_t key, const QString& message)
+  {
+    if(m_Skipped.insert(key).second)
+    {
+      m_Filter->setWarningCondition(-115, message);
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  // Element definition: element number, element type and the node numbers
+  // -----------------------------------------------------------------------------
+  bool readElement(const uint64_t* attributes, size_t numAttributes)
+  {
+    int32_t label = 0;
+    if(m_MeshBuilt || numAttributes < 2 || !readLabel(attributes[0], label))
+    {
+      QString ss = QObject::tr("Invalid element definition in the results file '%1'").arg(m_FilePath);
+      m_Filter->setErrorCondition(-104, ss);
+      return false;
+    }
+
+    std::string typeName = RecordReader::text(attributes[1]);
+    if(m_ElementLabels.empty())
+    {
+      if(!AbaqusMesh::findElementType(typeName, m_ElementType))
+      {
+        QString ss = QObject::tr("Unsupported ABAQUS element type '%1'").arg(QString::fromStdString(typeName));
+        m_Filter->setErrorCondition(-102, ss);
+        return false;
+      }
+      m_ElementTypeName = typeName;
+    }
+    else if(typeName != m_ElementTypeName)
+    {
+      QString ss = QObject::tr("Element %1 is of type '%2', but only one element type is supported and the first element is of type '%3'")
+                       .arg(label)
+                       .arg(QString::fromStdString(typeName), QString::fromStdString(m_ElementTypeName));
+      m_Filter->setErrorCondition(-102, ss);
+      return false;
+    }
+
+    size_t numNodes = m_ElementType.numNodes;
+    if(numAttributes - 2 < numNodes)
+    {
+      QString ss = QObject::tr("Element %1 in the results file '%2' lists %3 nodes instead of %4").arg(label).arg(m_FilePath).arg(numAttributes - 2).arg(numNodes);
+      m_Filter->setErrorCondition(-104, ss);
+      return false;
+    }
+
+    m_ElementLabels.push_back(label);
+    for(size_t i = 0; i < numNodes; i++)
+    {
+      int32_t node = 0;
+      m_ElementNodes.push_back(readLabel(attributes[2 + i], node) ? node : 0);
+    }
+    return true;
+  }
+
+  // -----------------------------------------------------------------------------
+  // Node definition: node number and coordinates
+  // -----------------------------------------------------------------------------
+  bool readNode(const uint64_t* attributes, size_t numAttributes)
+  {
+    int32_t label = 0;
+    if(m_MeshBuilt || numAttributes < 2 || !readLabel(attributes[0], label))
+    {
+      QString ss = QObject::tr("Invalid node definition in the results file '%1'").arg(m_FilePath);
+      m_Filter->setErrorCondition(-103, ss);
+      return false;
+    }
+
+    m_NodeLabels.push_back(label);
+    for(size_t c = 0; c < 3; c++)
+    {
+      m_Coordinates.push_back(c + 1 < numAttributes ? static_cast<float>(m_Reader.real(attributes[1 + c])) : 0.0f);
+    }
+    return true;
+  }
+
+  // -----------------------------------------------------------------------------
+  // The model definition ends where the first increment starts
+  // -----------------------------------------------------------------------------
+  bool buildMesh()
+  {
+    m_MeshBuilt = true;
+    if(m_ElementLabels.empty() || m_NodeLabels.empty())
+    {
+      QString ss = QObject::tr("The results file '%1' does not hold the element and node definitions").arg(m_FilePath);
+      m_Filter->setErrorCondition(-101, ss);
+      return false;
+    }
+    if(!m_Nodes.build(m_NodeLabels) || !m_Elements.build(m_ElementLabels))
+    {
+      QString ss = QObject::tr("The node and element numbers in the results file '%1' must be unique").arg(m_FilePath);
+      m_Filter->setErrorCondition(-110, ss);
+      return false;
+    }
+
+    m_Geometry = AbaqusMesh::createGeometry(m_ElementType, m_NodeLabels.size(), m_ElementLabels.size());
+    std::copy(m_Coordinates.begin(), m_Coordinates.end(), m_Geometry.vertices);
+    m_Coordinates = std::vector<float>();
+
+    size_t numNodes = m_ElementType.numNodes;
+    for(size_t i = 0; i < m_ElementNodes.size(); i++)
+    {
+      int64_t node = m_Nodes.find(m_ElementNodes[i]);
+      if(node < 0)
+      {
+        QString ss = QObject::tr("Element %1 refers to node %2, which is not defined in the results file").arg(m_ElementLabels[i / numNodes]).arg(m_ElementNodes[i]);
+        m_Filter->setErrorCondition(-110, ss);
+        return false;
+      }
+      m_Geometry.connectivity[i] = static_cast<MeshIndexType>(node);
+    }
+    m_ElementNodes = std::vector<int32_t>();
+    return true;
+  }
+
+  // -----------------------------------------------------------------------------
+  // Increment start: the 6th and 7th attributes are the step and increment numbers
+  // -----------------------------------------------------------------------------
+  bool startIncrement(const uint64_t* attributes, size_t numAttributes)
+  {
+    if(!m_MeshBuilt && !buildMesh())
+    {
+      return false;
+    }
+    if(numAttributes < 7)
+    {
+      QString ss = QObject::tr("Invalid increment start record in the results file '%1'").arg(m_FilePath);
+      m_Filter->setErrorCondition(-105, ss);
+      return false;
+    }
+
+    int64_t step = m_Reader.integer(attributes[5]);
+    int64_t increment = m_Reader.integer(attributes[6]);
+
+    // Steps are written in order, so nothing after the selected step is needed
+    if(m_FoundIncrement && step > m_StepNumber)
+    {
+      m_Done = true;
+      return false;
+    }
+
+    m_Collecting = step == m_StepNumber && (m_IncrementNumber == 0 || increment == m_IncrementNumber);
+    if(m_Collecting)
+    {
+      // With the last increment selected, each increment of the step replaces the one before
+      m_FoundIncrement = true;
+      m_Fields.clear();
+      m_Element = -1;
+      m_Filter->notifyStatusMessage(QObject::tr("Reading Vertex & Cell data of step %1 increment %2....").arg(step).arg(increment));
+    }
+    return true;
+  }
+
+  // -----------------------------------------------------------------------------
+  // Element header: element number, integration point, section point and location of the records that follow
+  // -----------------------------------------------------------------------------
+  bool readElementHeader(const uint64_t* attributes, size_t numAttributes)
+  {
+    int32_t label = 0;
+    if(numAttributes < 4 || !readLabel(attributes[0], label))
+    {
+      QString ss = QObject::tr("Invalid element header record in the results file '%1'").arg(m_FilePath);
+      m_Filter->setErrorCondition(-105, ss);
+      return false;
+    }
+
+    // Values at the integration points, or at the centroid of an element with a single integration point
+    int64_t location = m_Reader.integer(attributes[3]);
+    m_IntPoint = m_Reader.integer(attributes[1]);
+    m_AtIntPoints = location == 0 || (location == 1 && m_ElementType.numIntPoints == 1);
+    if(location == 1)
+    {
+      m_IntPoint = 1;
+    }
+    if(!m_AtIntPoints)
+    {
+      warnOnce(k_ElementHeader, QObject::tr("Skipping the element results at location %1, only integration point values are supported").arg(location));
+      return true;
+    }
+
+    m_Element = m_Elements.find(label);
+    if(m_Element < 0 || m_IntPoint < 1 || m_IntPoint > static_cast<int64_t>(m_ElementType.numIntPoints))
+    {
+      QString ss = QObject::tr("The results file refers to unknown element %1 or integration point %2").arg(label).arg(m_IntPoint);
+      m_Filter->setErrorCondition(-110, ss);
+      return false;
+    }
+    return true;
+  }
+
+  // -----------------------------------------------------------------------------
+  // Result record: the values of one element integration point, or a node number followed by its values
+  // -----------------------------------------------------------------------------
+  bool readResults(const ResultType& type, const uint64_t* attributes, size_t numAttributes)
+  {
+    int64_t tuple = -1;
+    size_t slot = 0;
+    if(type.nodal)
+    {
+      int32_t label = 0;
+      tuple = numAttributes > 1 && readLabel(attributes[0], label) ? m_Nodes.find(label) : -1;
+      if(tuple < 0)
+      {
+        QString ss = QObject::tr("A %1 record refers to an unknown node").arg(type.name);
+        m_Filter->setErrorCondition(-110, ss);
+        return false;
+      }
+      attributes++;
+      numAttributes--;
+    }
+    else
+    {
+      if(!m_AtIntPoints)
+      {
+        return true;
+      }
+      if(m_Element < 0 || numAttributes == 0)
+      {
+        QString ss = QObject::tr("A %1 record does not follow an element header record").arg(type.name);
+        m_Filter->setErrorCondition(-105, ss);
+        return false;
+      }
+      tuple = m_Element;
+      slot = static_cast<size_t>(m_IntPoint - 1);
+    }
+
+    Field* field = findField(type, numAttributes);
+    if(field == nullptr)
+    {
+      return false;
+    }
+
+    // The values of all integration points of an element are stored as the components of one tuple
+    size_t valuesPerTuple = type.nodal ? 1 : m_ElementType.numIntPoints;
+    float* values = field->data->getPointer((static_cast<size_t>(tuple) * valuesPerTuple + slot) * field->numComp);
+    for(size_t c = 0; c < numAttributes; c++)
+    {
+      values[c] = static_cast<float>(m_Reader.real(attributes[c]));
+    }
+    return true;
+  }
+
+  // -----------------------------------------------------------------------------
+  Field* findField(const ResultType& type, size_t numComp)
+  {
+    auto iter = std::find_if(m_Fields.begin(), m_Fields.end(), [&type](const Field& field) { return field.key == type.key; });
+    if(iter != m_Fields.end())
+    {
+      if(iter->numComp != numComp)
+      {
+        QString ss = QObject::tr("The %1 records in the results file '%2' hold %3 values instead of %4").arg(type.name).arg(m_FilePath).arg(numComp).arg(iter->numComp);
+        m_Filter->setErrorCondition(-107, ss);
+        return nullptr;
+      }
+      return &(*iter);
+    }
+
+    m_Filter->notifyStatusMessage(QObject::tr("Found %1 Data: %2").arg(type.nodal ? "Vertex" : "Cell", type.name));
+
+    // Nodes and elements without output keep values of 0
+    Field field;
+    field.key = type.key;
+    field.nodal = type.nodal;
+    field.numComp = numComp;
+    size_t numTuples = type.nodal ? m_NodeLabels.size() : m_ElementLabels.size();
+    std::vector<size_t> cDims(1, numComp * (type.nodal ? 1 : m_ElementType.numIntPoints));
+    field.data = FloatArrayType::CreateArray(numTuples, cDims, type.name, true);
+    field.data->initializeWithZeros();
+    m_Fields.push_back(field);
+    return &m_Fields.back();
+  }
+
+  AbstractFilter* m_Filter = nullptr;
+  QString m_FilePath;
+  const RecordReader& m_Reader;
+  int32_t m_StepNumber = 1;
+  int32_t m_IncrementNumber = 0;
+
+  AbaqusMesh::ElementType m_ElementType;
+  std::string m_ElementTypeName;
+  std::vector<int32_t> m_NodeLabels;
+  std::vector<float> m_Coordinates;
+  std::vector<int32_t> m_ElementLabels;
+  std::vector<int32_t> m_ElementNodes;
+  AbaqusMesh::LabelIndex m_Nodes;
+  AbaqusMesh::LabelIndex m_Elements;
+  AbaqusMesh::MeshGeometry m_Geometry;
+  bool m_MeshBuilt = false;
+
+  bool m_Collecting = false;
+  bool m_FoundIncrement = false;
+  bool m_Done = false;
+  int64_t m_Element = -1;
+  int64_t m_IntPoint = 1;
+  bool m_AtIntPoints = true;
+  std::vector<Field> m_Fields;
+  std::set<int64_t> m_Skipped;
+};
+} // namespace
+
+// -----------------------------------------------------------------------------
+bool AbaqusFilReader::read(AbstractFilter* filter, const QString& filePath, int32_t stepNumber, int32_t incrementNumber, DataContainer& dataContainer, AttributeMatrix& vertexAttrMat,
+                           AttributeMatrix& cellAttrMat)
+{
+  RecordReader reader(filter, filePath);
+  if(!reader.open())
+  {
+    return false;
+  }
+
+  filter->notifyStatusMessage(QObject::tr("Reading the results file %1....").arg(filePath));
+  FilParser parser(filter, filePath, reader, stepNumber, incrementNumber);
+  std::vector<uint64_t> record;
+  size_t numRecords = 0;
+  while(reader.next(record))
+  {
+    if(++numRecords % k_CancelCheckInterval == 0 && filter->getCancel())
+    {
+      return false;
+    }
+    if(!parser.parse(record))
+    {
+      if(!parser.done())
+      {
+        return false;
+      }
+      break;
+    }
+  }
+  if(reader.failed())
+  {
+    return false;
+  }
+
+  return parser.finish(dataContainer, vertexAttrMat, cellAttrMat);
+}
@@ -33,7 +33,9 @@
 
 #include "AbaqusFileWriter.h"
 
-#include <iomanip>
+#include <algorithm>
+#include <string>
+#include <vector>
 
 #include <QtCore/QDir>
 #include <QtCore/QTextStream>
@@ -41,9 +43,67 @@
 #include "SIMPLib/Math/SIMPLibMath.h"
 
 #include "SimulationIO/SimulationIOFilters/Utility/EntriesHelper.h"
+#include "SimulationIO/SimulationIOFilters/Utility/NumberFormatter.hpp"
+#include "SimulationIO/SimulationIOFilters/Utility/SlabWriter.hpp"
+
+namespace
+{
+/**
+ * @brief Element indices grouped by feature id in compressed sparse row form. The elements of
+ * grain g are elements[offsets[g]] .. elements[offsets[g + 1] - 1], in ascending order.
+ */
+struct ElementSets
+{
+  std::vector<size_t> offsets;
+  std::vector<size_t> elements;
+};
+
+/**
+ * @brief Buckets the element indices of every feature id in [1, maxGrainId]. Elements with a
+ * feature id outside of that range are not assigned to any set.
+ * @param featureIds
+ * @param totalPoints
+ * @param maxGrainId
+ * @return
+ */
+ElementSets bucketElementsByGrain(const int32_t* featureIds, size_t totalPoints, int32_t maxGrainId)
+{
+  ElementSets sets;
+  size_t numGrains = static_cast<size_t>(std::max(maxGrainId, 0));
+  sets.offsets.resize(numGrains + 2, 0);
+
+  for(size_t i = 0; i < totalPoints; i++)
+  {
+    int32_t grainId = featureIds[i];
+    if(grainId > 0)
+    {
+      sets.offsets[grainId + 1]++;
+    }
+  }
+
+  for(size_t grainId = 1; grainId <= numGrains; grainId++)
+  {
+    sets.offsets[grainId + 1] += sets.offsets[grainId];
+  }
+
+  sets.elements.resize(sets.offsets[numGrains + 1]);
+  std::vector<size_t> cursor(sets.offsets.begin(), sets.offsets.end() - 1);
+  for(size_t i = 0; i < totalPoints; i++)
+  {
+    int32_t grainId = featureIds[i];
+    if(grainId > 0)
+    {
+      sets.elements[cursor[grainId]++] = i;
+    }
+  }
+
+  return sets;
+}
+} // namespace
 
 bool AbaqusFileWriter::write(AbstractFilter* filter, const ImageGeom& imageGeom, const DataArray<int32_t>& featureIds, const DataArray<int32_t>& cellPhases, const DataArray<float>& cellEulerAngles,
-                             const DynamicTableData& matConst, const QString& outputPath, const QString& filePrefix, const QString& jobName, int32_t numDepvar, int32_t numUserOutVar)
+                             const DynamicTableData& matConst, const QString& outputPath, const QString& filePrefix, const QString& jobName, int32_t numDepvar, int32_t numUserOutVar, int32_t numThreads,
+                             FeatureAggregator::Orientation orientation)
 {
   SizeVec3Type dims = imageGeom.getDimensions();
   FloatVec3Type spacing = imageGeom.getSpacing();
@@ -98,15 +158,36 @@ bool AbaqusFileWriter::write(AbstractFilter* filter, const ImageGeom& imageGeom,
   int32_t nnode_y = ne_y + 1;
   int32_t nnode_z = ne_z + 1;
 
-  QTextStream nodesStream(&nodesFile);
+  size_t threadCount = SlabWriter::resolveThreadCount(numThreads);
 
-  nodesStream << "*NODE, NSET=ALLNODES\n";
+  const char nodesHeader[] = "*NODE, NSET=ALLNODES\n";
+  nodesFile.write(nodesHeader, sizeof(nodesHeader) - 1);
 
-  nodesStream.setRealNumberNotation(QTextStream::RealNumberNotation::FixedNotation);
-  nodesStream.setRealNumberPrecision(3);
+  // Each Z layer is formatted independently on the worker threads and appended to the file in order
+  auto formatNodes = [&](size_t k, std::string& buffer) {
+    buffer.reserve(static_cast<size_t>(nnode_x) * static_cast<size_t>(nnode_y) * 48);
+    float value3 = origin[2] + (static_cast<int32_t>(k) * spacing[2]);
+    for(int32_t j = 0; j < nnode_y; j++)
+    {
+      float value2 = origin[1] + (j * spacing[1]);
+      for(int32_t i = 0; i < nnode_x; i++)
+      {
+        int64_t index = static_cast<int64_t>(k) * nnode_x * nnode_y + static_cast<int64_t>(j) * nnode_x + i;
+        float value1 = origin[0] + (i * spacing[0]);
 
-  for(int32_t k = 0; k < nnode_z; k++)
-  {
+        NumberFormatter::appendInteger(buffer, index + 1);
+        buffer += ", ";
+        NumberFormatter::appendFixed<3>(buffer, value1);
+        buffer += ", ";
+        NumberFormatter::appendFixed<3>(buffer, value2);
+        buffer += ", ";
+        NumberFormatter::appendFixed<3>(buffer, value3);
+        buffer += '\n';
+      }
+    }
+  };
+
+  auto writeNodes = [&](size_t k, const std::string& buffer) {
     if(filter != nullptr)
     {
       if(filter->getCancel())
@@ -116,22 +197,12 @@ bool AbaqusFileWriter::write(AbstractFilter* filter, const ImageGeom& imageGeom,
       QString ss = QObject::tr("File [1/5] Writing Z=%1/%2 Layer Nodes").arg(k).arg(nnode_z);
       filter->notifyStatusMessage(ss);
     }
-    std::stringstream ss;
-
-    for(int32_t j = 0; j < nnode_y; j++)
-    {
-      for(int32_t i = 0; i < nnode_x; i++)
-      {
-        int32_t index = k * nnode_x * nnode_y + j * nnode_x + i;
-
-        float value1 = origin[0] + (i * spacing[0]);
-        float value2 = origin[1] + (j * spacing[1]);
-        float value3 = origin[2] + (k * spacing[2]);
+    return nodesFile.write(buffer.data(), static_cast<qint64>(buffer.size())) == static_cast<qint64>(buffer.size());
+  };
 
-        ss << std::fixed << std::setprecision(3) << index + 1 << ", " << value1 << ", " << value2 << ", " << value3 << "\n";
-      }
-    }
-    nodesStream << QString::fromStdString(ss.str());
+  if(!SlabWriter::write(static_cast<size_t>(nnode_z), threadCount, formatNodes, writeNodes))
+  {
+    return false;
   }
 
   // notifyStatusMessage("Finished Writing ABAQUS Nodes File");
@@ -147,15 +218,41 @@ bool AbaqusFileWriter::write(AbstractFilter* filter, const ImageGeom& imageGeom,
     return false;
   }
 
-  QTextStream elemsStream(&elemsFile);
-
-  elemsStream.setRealNumberNotation(QTextStream::RealNumberNotation::FixedNotation);
-  elemsStream.setRealNumberPrecision(3);
+  const char elemsHeader[] = "*ELEMENT, TYPE=C3D8R, ELSET=ALLELEMENTS\n";
+  elemsFile.write(elemsHeader, sizeof(elemsHeader) - 1);
 
-  elemsStream << "*ELEMENT, TYPE=C3D8R, ELSET=ALLELEMENTS\n";
+  auto formatElems = [&](size_t k, std::string& buffer) {
+    buffer.reserve(static_cast<size_t>(ne_x) * static_cast<size_t>(ne_y) * 96);
+    const int64_t nodesPerLayer = static_cast<int64_t>(nnode_x) * nnode_y;
+    for(int32_t j = 0; j < ne_y; j++)
+    {
+      for(int32_t i = 0; i < ne_x; i++)
+      {
+        int64_t eindex = static_cast<int64_t>(k) * ne_x * ne_y + static_cast<int64_t>(j) * ne_x + i;
+        int64_t index = static_cast<int64_t>(k) * nodesPerLayer + static_cast<int64_t>(j) * nnode_x + i + 1;
+
+        const int64_t values[9] = {eindex + 1,
+                                   index,
+                                   index + 1,
+                                   index + nnode_x + 1,
+                                   index + nnode_x,
+                                   index + nodesPerLayer,
+                                   index + 1 + nodesPerLayer,
+                                   index + nnode_x + nodesPerLayer + 1,
+                                   index + nnode_x + nodesPerLayer};
+
+        NumberFormatter::appendInteger(buffer, values[0]);
+        for(size_t v = 1; v < 9; v++)
+        {
+          buffer += ", ";
+          NumberFormatter::appendInteger(buffer, values[v]);
+        }
+        buffer += '\n';
+      }
+    }
+  };
 
-  for(int32_t k = 0; k < ne_z; k++)
-  {
+  auto writeElems = [&](size_t k, const std::string& buffer) {
     if(filter != nullptr)
     {
       if(filter->getCancel())
@@ -165,35 +262,16 @@ bool AbaqusFileWriter::write(AbstractFilter* filter, const ImageGeom& imageGeom,
       QString ss = QObject::tr("File [2/5] Writing Z=%1/%2 Layer Elements").arg(k).arg(ne_z);
       filter->notifyStatusMessage(ss);
     }
-    std::stringstream ss;
-    for(int32_t j = 0; j < ne_y; j++)
-    {
-      for(int32_t i = 0; i < ne_x; i++)
-      {
-        int32_t eindex = k * ne_x * ne_y + j * ne_x + i;
-        int32_t index = k * nnode_x * nnode_y + j * nnode_x + i + 1;
-
-        int32_t value1 = index;
-        int32_t value2 = index + 1;
-        int32_t value3 = index + nnode_x + 1;
-        int32_t value4 = index + nnode_x;
-        int32_t value5 = index + nnode_x * nnode_y;
-        int32_t value6 = index + 1 + nnode_x * nnode_y;
-        int32_t value7 = index + nnode_x + nnode_x * nnode_y + 1;
-        int32_t value8 = index + nnode_x + nnode_x * nnode_y;
-
-        ss << std::fixed << std::setprecision(3) << eindex + 1 << ", " << value1 << ", " << value2 << ", " << value3 << ", " << value4 << ", " << value5 << ", " << value6 << ", " << value7 << ", "
-           << value8 << "\n";
-      }
-    }
-    elemsStream << QString::fromStdString(ss.str());
+    return elemsFile.write(buffer.data(), static_cast<qint64>(buffer.size())) == static_cast<qint64>(buffer.size());
+  };
+
+  if(!SlabWriter::write(static_cast<size_t>(ne_z), threadCount, formatElems, writeElems))
+  {
+    return false;
   }
 
   // notifyStatusMessage("Finished Writing ABAQUS Elements Connectivity File");
 
-  std::vector<int32_t> phaseId(maxGrainId, 0);
-  std::vector<float> orient(maxGrainId * 3, 0);
-
   int32_t totalPoints = imageGeom.getNumberOfElements();
 
   if(filter != nullptr)
@@ -206,20 +284,14 @@ bool AbaqusFileWriter::write(AbstractFilter* filter, const ImageGeom& imageGeom,
     filter->notifyStatusMessage(ss);
   }
 
-  // This function is essentially creating the "Feature Level" or Grain Level mapping of Grain Id to Phase and Euler Angle
-  // While this is fine for the Phases Array, the Eulers data may not be completely correct as the last Euler Entry found
-  // for each grain will be used instead of something like an "average" orientation.
-  // We also loop over all the voxels once instead of looping over all of the voxels for each grain.
-  for(int32_t i = 0; i < totalPoints; i++)
+  // The "Feature Level" or Grain Level mapping of Grain Id to Phase and Euler Angle, built in one parallel pass.
+  // The orientation of a grain is the one of its last voxel unless the mean orientation was requested.
+  FeatureAggregator::FeatureData grains = FeatureAggregator::aggregate(featureIdsData, cellPhasesData, cellEulerAnglesData, static_cast<size_t>(totalPoints), orientation, numThreads);
+  std::vector<int32_t> phaseId(grains.phases.begin() + 1, grains.phases.end());
+  std::vector<float> orient(grains.eulerAngles.size() - 3);
+  for(size_t i = 0; i < orient.size(); i++)
   {
-    size_t grainId = static_cast<size_t>(featureIdsData[i]);
-    if(grainId > 0)
-    {
-      phaseId[grainId - 1] = cellPhasesData[i];
-      orient[(grainId - 1) * 3] = cellEulerAnglesData[i * 3] * 180.0 * SIMPLib::Constants::k_1OverPiD;
-      orient[(grainId - 1) * 3 + 1] = cellEulerAnglesData[i * 3 + 1] * 180.0 * SIMPLib::Constants::k_1OverPiD;
-      orient[(grainId - 1) * 3 + 2] = cellEulerAnglesData[i * 3 + 2] * 180.0 * SIMPLib::Constants::k_1OverPiD;
-    }
+    orient[i] = grains.eulerAngles[i + 3] * 180.0 * SIMPLib::Constants::k_1OverPiD;
   }
 
   QFile elsetFile(elsetFilePath);
@@ -243,33 +315,40 @@ bool AbaqusFileWriter::write(AbstractFilter* filter, const ImageGeom& imageGeom,
     filter->notifyStatusMessage(ss);
   }
 
+  // Bucket the element indices by grain in two passes over the voxels (count, then scatter) so that
+  // each set can be written straight from its bucket instead of rescanning every voxel for every grain.
+  ElementSets elementSets = bucketElementsByGrain(featureIdsData, static_cast<size_t>(totalPoints), maxGrainId);
+
+  std::string buffer;
   for(int32_t voxelId = 1; voxelId <= maxGrainId; voxelId++)
   {
-    std::stringstream ss;
-    size_t elementPerLine = 0;
-    ss << "*Elset, elset=Grain" << voxelId << "_Phase" << phaseId[voxelId - 1] << "_set\n";
-
-    for(int32_t i = 0; i < totalPoints; i++)
+    buffer.clear();
+    buffer += "*Elset, elset=Grain";
+    NumberFormatter::appendInteger(buffer, voxelId);
+    buffer += "_Phase";
+    NumberFormatter::appendInteger(buffer, phaseId[voxelId - 1]);
+    buffer += "_set\n";
+
+    size_t begin = elementSets.offsets[voxelId];
+    size_t end = elementSets.offsets[voxelId + 1];
+    for(size_t elementPerLine = 0; elementPerLine < end - begin; elementPerLine++)
     {
-      if(featureIdsData[i] == voxelId)
+      if(elementPerLine != 0) // no comma at start
       {
-        if(elementPerLine != 0) // no comma at start
-        {
-          if((elementPerLine % 16) != 0u) // 16 per line
-          {
-            ss << ", ";
-          }
-          else
-          {
-            ss << ",\n";
-          }
-        }
-        ss << static_cast<uint64_t>(i + 1);
-        elementPerLine++;
+        buffer += ((elementPerLine % 16) != 0u) ? ", " : ",\n"; // 16 per line
       }
+      NumberFormatter::appendInteger(buffer, static_cast<uint64_t>(elementSets.elements[begin + elementPerLine]) + 1);
+    }
+    buffer += "\n";
+    if(elsetFile.write(buffer.data(), static_cast<qint64>(buffer.size())) != static_cast<qint64>(buffer.size()))
+    {
+      QString ss = QObject::tr("Error writing ABAQUS element file '%1'").arg(elsetFilePath);
+      if(filter != nullptr)
+      {
+        filter->setErrorCondition(-10220, ss);
+      }
+      return false;
     }
-    ss << "\n";
-    elsetFile.write(ss.str().c_str(), ss.str().size());
   }
 
   // notifyStatusMessage("Finished Writing ABAQUS Element Sets File");
@@ -39,6 +39,8 @@
 #include "SIMPLib/FilterParameters/DynamicTableData.h"
 #include "SIMPLib/Geometry/ImageGeom.h"
 
+#include "SimulationIO/SimulationIOFilters/Utility/FeatureAggregator.h"
+
 namespace AbaqusFileWriter
 {
 /**
@@ -54,6 +56,8 @@ namespace AbaqusFileWriter
  * @param jobName
  * @param numDepvar
  * @param numUserOutVar
+ * @param numThreads Number of threads formatting the nodes and elements files, 0 uses all cores
+ * @param orientation Whether a grain gets the orientation of its last voxel or the mean orientation of its voxels
  * @return
  */
 // clang-format off
@@ -67,6 +71,8 @@ bool write(AbstractFilter* filter,
            const QString& filePrefix,
            const QString& jobName,
            int32_t numDepvar,
-           int32_t numUserOutVar);
+           int32_t numUserOutVar,
+           int32_t numThreads = 1,
+           FeatureAggregator::Orientation orientation = FeatureAggregator::Orientation::LastVoxel);
 //clang-format on
 }
@@ -0,0 +1,209 @@
+/* ============================================================================
+ * Copyright (c) 2019-2019 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include "AbaqusMesh.h"
+
+#include <algorithm>
+
+#include "SIMPLib/Geometry/HexahedralGeom.h"
+#include "SIMPLib/Geometry/QuadGeom.h"
+#include "SIMPLib/Geometry/TetrahedralGeom.h"
+#include "SIMPLib/Geometry/TriangleGeom.h"
+
+namespace
+{
+constexpr size_t k_MinDenseLabels = 1 << 20;
+constexpr size_t k_MaxLabelsPerEntry = 8;
+} // namespace
+
+// -----------------------------------------------------------------------------
+bool AbaqusMesh::LabelIndex::build(const std::vector<int32_t>& labels)
+{
+  m_Table.clear();
+  m_Sorted.clear();
+
+  int32_t maxLabel = 0;
+  for(int32_t label : labels)
+  {
+    if(label <= 0)
+    {
+      return false;
+    }
+    maxLabel = std::max(maxLabel, label);
+  }
+
+  if(static_cast<size_t>(maxLabel) <= k_MaxLabelsPerEntry * labels.size() + k_MinDenseLabels)
+  {
+    m_Table.assign(static_cast<size_t>(maxLabel) + 1, -1);
+    for(size_t i = 0; i < labels.size(); i++)
+    {
+      int64_t& entry = m_Table[static_cast<size_t>(labels[i])];
+      if(entry >= 0)
+      {
+        return false;
+      }
+      entry = static_cast<int64_t>(i);
+    }
+    return true;
+  }
+
+  m_Sorted.resize(labels.size());
+  for(size_t i = 0; i < labels.size(); i++)
+  {
+    m_Sorted[i] = {labels[i], static_cast<int64_t>(i)};
+  }
+  std::sort(m_Sorted.begin(), m_Sorted.end());
+  auto isDuplicate = [](const std::pair<int32_t, int64_t>& a, const std::pair<int32_t, int64_t>& b) { return a.first == b.first; };
+  return std::adjacent_find(m_Sorted.begin(), m_Sorted.end(), isDuplicate) == m_Sorted.end();
+}
+
+// -----------------------------------------------------------------------------
+int64_t AbaqusMesh::LabelIndex::find(int32_t label) const
+{
+  if(!m_Table.empty())
+  {
+    return label > 0 && static_cast<size_t>(label) < m_Table.size() ? m_Table[static_cast<size_t>(label)] : -1;
+  }
+  auto iter = std::lower_bound(m_Sorted.begin(), m_Sorted.end(), std::make_pair(label, int64_t(-1)));
+  return iter != m_Sorted.end() && iter->first == label ? iter->second : -1;
+}
+
+// -----------------------------------------------------------------------------
+bool AbaqusMesh::findElementType(std::string_view name, ElementType& type)
+{
+  if(name == "CPE3" || name == "CPS3")
+  {
+    type = {IGeometry::Type::Triangle, 3, 2, 1, 2};
+  }
+  else if(name == "C3D4")
+  {
+    type = {IGeometry::Type::Tetrahedral, 4, 3, 1, 3};
+  }
+  else if(name == "CPE4R" || name == "CPS4R")
+  {
+    type = {IGeometry::Type::Quad, 4, 2, 1, 2};
+  }
+  else if(name == "CPE4" || name == "CPS4")
+  {
+    type = {IGeometry::Type::Quad, 4, 2, 4, 2};
+  }
+  else if(name == "C3D8R")
+  {
+    type = {IGeometry::Type::Hexahedral, 8, 3, 1, 3};
+  }
+  else if(name == "C3D8")
+  {
+    type = {IGeometry::Type::Hexahedral, 8, 3, 8, 3};
+  }
+  else
+  {
+    return false;
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+AbaqusMesh::MeshGeometry AbaqusMesh::createGeometry(const ElementType& type, size_t numVerts, size_t numCells)
+{
+  MeshGeometry mesh;
+  switch(type.geometryType)
+  {
+  case IGeometry::Type::Triangle:
+  {
+    SharedVertexList::Pointer vertexPtr = TriangleGeom::CreateSharedVertexList(static_cast<int64_t>(numVerts), true);
+    TriangleGeom::Pointer triGeomPtr = TriangleGeom::CreateGeometry(static_cast<int64_t>(numCells), vertexPtr, SIMPL::Geometry::TriangleGeometry, true);
+    mesh.connectivity = triGeomPtr->getTriPointer(0);
+    mesh.geometry = triGeomPtr;
+    mesh.vertices = vertexPtr->getPointer(0);
+    break;
+  }
+  case IGeometry::Type::Tetrahedral:
+  {
+    SharedVertexList::Pointer vertexPtr = TetrahedralGeom::CreateSharedVertexList(static_cast<int64_t>(numVerts), true);
+    TetrahedralGeom::Pointer tetGeomPtr = TetrahedralGeom::CreateGeometry(static_cast<int64_t>(numCells), vertexPtr, SIMPL::Geometry::TetrahedralGeometry, true);
+    mesh.connectivity = tetGeomPtr->getTetPointer(0);
+    mesh.geometry = tetGeomPtr;
+    mesh.vertices = vertexPtr->getPointer(0);
+    break;
+  }
+  case IGeometry::Type::Quad:
+  {
+    SharedVertexList::Pointer vertexPtr = QuadGeom::CreateSharedVertexList(static_cast<int64_t>(numVerts), true);
+    QuadGeom::Pointer quadGeomPtr = QuadGeom::CreateGeometry(static_cast<int64_t>(numCells), vertexPtr, SIMPL::Geometry::QuadGeometry, true);
+    mesh.connectivity = quadGeomPtr->getQuadPointer(0);
+    mesh.geometry = quadGeomPtr;
+    mesh.vertices = vertexPtr->getPointer(0);
+    break;
+  }
+  case IGeometry::Type::Hexahedral:
+  {
+    SharedVertexList::Pointer vertexPtr = HexahedralGeom::CreateSharedVertexList(static_cast<int64_t>(numVerts), true);
+    HexahedralGeom::Pointer hexGeomPtr = HexahedralGeom::CreateGeometry(static_cast<int64_t>(numCells), vertexPtr, SIMPL::Geometry::HexahedralGeometry, true);
+    mesh.connectivity = hexGeomPtr->getHexPointer(0);
+    mesh.geometry = hexGeomPtr;
+    mesh.vertices = vertexPtr->getPointer(0);
+    break;
+  }
+  default:
+    return mesh;
+  }
+  mesh.geometry->setSpatialDimensionality(type.spatialDimensionality);
+  return mesh;
+}
+
+// -----------------------------------------------------------------------------
+int32_t AbaqusMesh::numComponents(std::string_view fieldType, uint32_t spatialDimensionality)
+{
+  if(fieldType == "SCALAR")
+  {
+    return 1;
+  }
+  if(fieldType == "VECTOR")
+  {
+    return spatialDimensionality == 2 ? 2 : 3;
+  }
+  if(fieldType == "TENSOR_3D_FULL")
+  {
+    return 6;
+  }
+  if(fieldType == "TENSOR_3D_SURFACE" || fieldType == "TENSOR_2D_SURFACE")
+  {
+    return 3;
+  }
+  if(fieldType == "TENSOR_3D_PLANAR" || fieldType == "TENSOR_2D_PLANAR")
+  {
+    return 4;
+  }
+  return 0;
+}
@@ -0,0 +1,123 @@
+/* ============================================================================
+ * Copyright (c) 2019-2019 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#pragma once
+
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "SIMPLib/Geometry/IGeometry.h"
+
+/**
+ * @brief The element types, geometry creation and field output layouts shared by the readers of the files the
+ * ImportFEAData ABAQUS python scripts write.
+ */
+namespace AbaqusMesh
+{
+/**
+ * @brief The ABAQUS element types the importer understands. 2D elements store two coordinates per node and the
+ * z coordinate of their vertices is set to 0.
+ */
+struct ElementType
+{
+  IGeometry::Type geometryType = IGeometry::Type::Unknown;
+  size_t numNodes = 0;
+  size_t numCoords = 3;
+  size_t numIntPoints = 1;
+  uint32_t spatialDimensionality = 3;
+};
+
+/**
+ * @brief The geometry created for the elements of an instance together with the arrays the readers fill in
+ */
+struct MeshGeometry
+{
+  IGeometry::Pointer geometry;
+  float* vertices = nullptr;
+  MeshIndexType* connectivity = nullptr;
+};
+
+/**
+ * @brief Maps ABAQUS node or element labels to the 0 based index of the node or element. Labels are usually numbered
+ * densely from 1 and are looked up in a table; sparse labels fall back to a binary search.
+ */
+class LabelIndex
+{
+public:
+  /**
+   * @brief Indexes labels
+   * @param labels
+   * @return false if a label is not positive or appears more than once
+   */
+  bool build(const std::vector<int32_t>& labels);
+
+  /**
+   * @brief Returns the index of label, or -1 if it is not one of the indexed labels
+   * @param label
+   * @return
+   */
+  int64_t find(int32_t label) const;
+
+private:
+  std::vector<int64_t> m_Table;
+  std::vector<std::pair<int32_t, int64_t>> m_Sorted;
+};
+
+/**
+ * @brief Looks up an ABAQUS element type name such as "C3D8R"
+ * @param name
+ * @param type
+ * @return false if the element type is not supported
+ */
+bool findElementType(std::string_view name, ElementType& type);
+
+/**
+ * @brief Creates the geometry for numCells elements of the given type sharing numVerts vertices. The vertices and
+ * connectivity are allocated but not initialized.
+ * @param type
+ * @param numVerts
+ * @param numCells
+ * @return The geometry, or an empty MeshGeometry if the type has no geometry
+ */
+MeshGeometry createGeometry(const ElementType& type, size_t numVerts, size_t numCells);
+
+/**
+ * @brief Returns the number of components of an ABAQUS field output type such as "TENSOR_3D_FULL"
+ * @param fieldType
+ * @param spatialDimensionality
+ * @return The number of components, or 0 if the type is not supported
+ */
+int32_t numComponents(std::string_view fieldType, uint32_t spatialDimensionality);
+} // namespace AbaqusMesh
@@ -0,0 +1,575 @@
+/* ============================================================================
+ * Copyright (c) 2019-2019 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include "AbaqusResultCache.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+#include <QtCore/QCryptographicHash>
+#include <QtCore/QDateTime>
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QSaveFile>
+#include <QtCore/QStringList>
+
+#include "SIMPLib/Geometry/HexahedralGeom.h"
+#include "SIMPLib/Geometry/QuadGeom.h"
+#include "SIMPLib/Geometry/TetrahedralGeom.h"
+#include "SIMPLib/Geometry/TriangleGeom.h"
+
+#include "SimulationIO/SimulationIOFilters/Utility/AbaqusMesh.h"
+
+const QString AbaqusResultCache::k_EntryExtension(".abqcache");
+
+namespace
+{
+constexpr char k_Magic[8] = {'S', 'I', 'O', 'A', 'B', 'Q', 'C', '\0'};
+constexpr uint32_t k_Version = 1;
+constexpr uint32_t k_ByteOrderMark = 0x01020304;
+constexpr qint64 k_ChunkSize = 1 << 26;
+
+/**
+ * @brief The vertices and connectivity of one of the geometries the ABAQUS readers create
+ */
+struct MeshArrays
+{
+  const float* vertices = nullptr;
+  const MeshIndexType* connectivity = nullptr;
+  size_t nodesPerElement = 0;
+};
+
+// -----------------------------------------------------------------------------
+size_t nodesPerElement(IGeometry::Type type)
+{
+  switch(type)
+  {
+  case IGeometry::Type::Triangle:
+    return 3;
+  case IGeometry::Type::Tetrahedral:
+  case IGeometry::Type::Quad:
+    return 4;
+  case IGeometry::Type::Hexahedral:
+    return 8;
+  default:
+    return 0;
+  }
+}
+
+// -----------------------------------------------------------------------------
+MeshArrays meshArrays(const IGeometry::Pointer& geometry)
+{
+  MeshArrays mesh;
+  if(nullptr == geometry)
+  {
+    return mesh;
+  }
+  switch(geometry->getGeometryType())
+  {
+  case IGeometry::Type::Triangle:
+  {
+    TriangleGeom::Pointer triGeom = std::dynamic_pointer_cast<TriangleGeom>(geometry);
+    mesh.vertices = triGeom->getVertexPointer(0);
+    mesh.connectivity = triGeom->getTriPointer(0);
+    break;
+  }
+  case IGeometry::Type::Tetrahedral:
+  {
+    TetrahedralGeom::Pointer tetGeom = std::dynamic_pointer_cast<TetrahedralGeom>(geometry);
+    mesh.vertices = tetGeom->getVertexPointer(0);
+    mesh.connectivity = tetGeom->getTetPointer(0);
+    break;
+  }
+  case IGeometry::Type::Quad:
+  {
+    QuadGeom::Pointer quadGeom = std::dynamic_pointer_cast<QuadGeom>(geometry);
+    mesh.vertices = quadGeom->getVertexPointer(0);
+    mesh.connectivity = quadGeom->getQuadPointer(0);
+    break;
+  }
+  case IGeometry::Type::Hexahedral:
+  {
+    HexahedralGeom::Pointer hexGeom = std::dynamic_pointer_cast<HexahedralGeom>(geometry);
+    mesh.vertices = hexGeom->getVertexPointer(0);
+    mesh.connectivity = hexGeom->getHexPointer(0);
+    break;
+  }
+  default:
+    return mesh;
+  }
+  mesh.nodesPerElement = nodesPerElement(geometry->getGeometryType());
+  return mesh;
+}
+
+/**
+ * @brief Writes the values of an entry in chunks and remembers whether any write failed
+ */
+class EntryWriter
+{
+public:
+  explicit EntryWriter(QSaveFile& file)
+  : m_File(file)
+  {
+  }
+
+  template <typename T>
+  void write(const T* values, size_t count)
+  {
+    const char* bytes = reinterpret_cast<const char*>(values);
+    qint64 numBytes = static_cast<qint64>(count * sizeof(T));
+    for(qint64 offset = 0; offset < numBytes && m_Ok;)
+    {
+      qint64 numWritten = m_File.write(bytes + offset, std::min(k_ChunkSize, numBytes - offset));
+      m_Ok = numWritten > 0;
+      offset += numWritten;
+    }
+  }
+
+  template <typename T>
+  void write(T value)
+  {
+    write(&value, 1);
+  }
+
+  void write(const QString& text)
+  {
+    QByteArray bytes = text.toUtf8();
+    write(static_cast<uint32_t>(bytes.size()));
+    write(bytes.constData(), static_cast<size_t>(bytes.size()));
+  }
+
+  bool ok() const
+  {
+    return m_Ok;
+  }
+
+private:
+  QSaveFile& m_File;
+  bool m_Ok = true;
+};
+
+/**
+ * @brief Reads the values of an entry in chunks. Counts are checked against the bytes left in the file before
+ * anything is allocated for them, so a damaged entry cannot ask for more memory than the file could hold.
+ */
+class EntryReader
+{
+public:
+  explicit EntryReader(QFile& file)
+  : m_File(file)
+  {
+  }
+
+  /**
+   * @brief Returns the number of values of type T left in the file
+   * @return
+   */
+  template <typename T>
+  size_t remaining() const
+  {
+    return static_cast<size_t>(m_File.size() - m_File.pos()) / sizeof(T);
+  }
+
+  /**
+   * @brief Returns true if the file still holds count groups of size values of type T
+   * @param count
+   * @param size
+   * @return
+   */
+  template <typename T>
+  bool fits(size_t count, size_t size = 1) const
+  {
+    return size == 0 || count <= remaining<T>() / size;
+  }
+
+  template <typename T>
+  bool read(T* values, size_t count)
+  {
+    if(!fits<T>(count))
+    {
+      return false;
+    }
+    char* bytes = reinterpret_cast<char*>(values);
+    qint64 numBytes = static_cast<qint64>(count * sizeof(T));
+    for(qint64 offset = 0; offset < numBytes;)
+    {
+      qint64 numRead = m_File.read(bytes + offset, std::min(k_ChunkSize, numBytes - offset));
+      if(numRead <= 0)
+      {
+        return false;
+      }
+      offset += numRead;
+    }
+    return true;
+  }
+
+  template <typename T>
+  bool read(T& value)
+  {
+    return read(&value, 1);
+  }
+
+  bool read(QString& text)
+  {
+    uint32_t size = 0;
+    if(!read(size) || !fits<char>(size))
+    {
+      return false;
+    }
+    QByteArray bytes(static_cast<int>(size), '\0');
+    if(!read(bytes.data(), size))
+    {
+      return false;
+    }
+    text = QString::fromUtf8(bytes);
+    return true;
+  }
+
+private:
+  QFile& m_File;
+};
+
+// -----------------------------------------------------------------------------
+size_t numValues(const FloatArrayType::Pointer& array)
+{
+  return array->getNumberOfTuples() * static_cast<size_t>(array->getNumberOfComponents());
+}
+
+// -----------------------------------------------------------------------------
+// Reads the body of an entry following its key
+// -----------------------------------------------------------------------------
+bool readEntry(EntryReader& reader, AbaqusBulkDataReader::Data& data)
+{
+  uint32_t geometryType = 0;
+  uint32_t numNodes = 0;
+  uint32_t spatialDimensionality = 0;
+  uint64_t numVerts = 0;
+  uint64_t numCells = 0;
+  if(!reader.read(geometryType) || !reader.read(numNodes) || !reader.read(spatialDimensionality) || !reader.read(numVerts) || !reader.read(numCells))
+  {
+    return false;
+  }
+
+  AbaqusMesh::ElementType elementType;
+  elementType.geometryType = static_cast<IGeometry::Type>(geometryType);
+  elementType.numNodes = numNodes;
+  elementType.spatialDimensionality = spatialDimensionality;
+  if(numNodes == 0 || numNodes != nodesPerElement(elementType.geometryType) || !reader.fits<float>(numVerts, 3) || !reader.fits<uint32_t>(numCells, numNodes))
+  {
+    return false;
+  }
+
+  AbaqusMesh::MeshGeometry geometry = AbaqusMesh::createGeometry(elementType, numVerts, numCells);
+  std::vector<uint32_t> connectivity(numCells * numNodes);
+  if(nullptr == geometry.geometry || !reader.read(geometry.vertices, numVerts * 3) || !reader.read(connectivity.data(), connectivity.size()))
+  {
+    return false;
+  }
+  for(size_t i = 0; i < connectivity.size(); i++)
+  {
+    if(connectivity[i] >= numVerts)
+    {
+      return false;
+    }
+    geometry.connectivity[i] = connectivity[i];
+  }
+
+  uint32_t numFrames = 0;
+  if(!reader.read(numFrames) || !reader.fits<int32_t>(numFrames))
+  {
+    return false;
+  }
+  std::vector<AbaqusBulkDataReader::Frame> frames(numFrames);
+  for(AbaqusBulkDataReader::Frame& frame : frames)
+  {
+    uint32_t numVertexArrays = 0;
+    uint32_t numCellArrays = 0;
+    if(!reader.read(frame.frameNumber) || !reader.read(frame.frameValue) || !reader.read(numVertexArrays) || !reader.read(numCellArrays))
+    {
+      return false;
+    }
+    for(uint32_t i = 0; i < numVertexArrays + numCellArrays; i++)
+    {
+      QString name;
+      uint32_t numDims = 0;
+      if(!reader.read(name) || !reader.read(numDims) || numDims == 0 || !reader.fits<uint64_t>(numDims))
+      {
+        return false;
+      }
+      std::vector<uint64_t> dims(numDims);
+      if(!reader.read(dims.data(), dims.size()))
+      {
+        return false;
+      }
+      std::vector<size_t> cDims(dims.cbegin(), dims.cend());
+      size_t numTuples = i < numVertexArrays ? numVerts : numCells;
+      size_t numComp = 1;
+      for(size_t dim : cDims)
+      {
+        if(dim == 0 || !reader.fits<float>(dim, numComp))
+        {
+          return false;
+        }
+        numComp *= dim;
+      }
+      if(!reader.fits<float>(numTuples, numComp))
+      {
+        return false;
+      }
+      FloatArrayType::Pointer array = FloatArrayType::CreateArray(numTuples, cDims, name, true);
+      if(!reader.read(array->getPointer(0), numTuples * numComp))
+      {
+        return false;
+      }
+      (i < numVertexArrays ? frame.vertexArrays : frame.cellArrays).push_back(array);
+    }
+  }
+
+  data.geometry = geometry.geometry;
+  data.numVerts = numVerts;
+  data.numCells = numCells;
+  data.frames = std::move(frames);
+  return true;
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+AbaqusResultCache::AbaqusResultCache(const QString& directory, qint64 maxSize)
+: m_Directory(directory)
+, m_MaxSize(maxSize)
+{
+}
+
+// -----------------------------------------------------------------------------
+QString AbaqusResultCache::key(const QString& odbFilePath, int extractionMode, const QString& instanceName, const QString& step, const std::vector<int>& frameNumbers)
+{
+  QFileInfo odbInfo(odbFilePath);
+  if(!odbInfo.isFile())
+  {
+    return QString();
+  }
+
+  QStringList frames;
+  for(int frameNum : frameNumbers)
+  {
+    frames << QString::number(frameNum);
+  }
+
+  QString key;
+  key += QString("odb=%1\n").arg(odbInfo.canonicalFilePath());
+  key += QString("size=%1\n").arg(odbInfo.size());
+  key += QString("modified=%1\n").arg(odbInfo.lastModified().toMSecsSinceEpoch());
+  key += QString("mode=%1\n").arg(extractionMode);
+  key += QString("instance=%1\n").arg(instanceName);
+  key += QString("step=%1\n").arg(step);
+  key += QString("frames=%1\n").arg(frames.join(','));
+  return key;
+}
+
+// -----------------------------------------------------------------------------
+QString AbaqusResultCache::entryPath(const QString& key) const
+{
+  QString hash = QString::fromLatin1(QCryptographicHash::hash(key.toUtf8(), QCryptographicHash::Sha1).toHex());
+  return QDir(m_Directory).filePath(hash + k_EntryExtension);
+}
+
+// -----------------------------------------------------------------------------
+bool AbaqusResultCache::load(AbstractFilter* filter, const QString& key, AbaqusBulkDataReader::Data& data) const
+{
+  QString filePath = entryPath(key);
+  QFile file(filePath);
+  if(key.isEmpty() || !file.open(QIODevice::ReadOnly))
+  {
+    return false;
+  }
+
+  filter->notifyStatusMessage(QObject::tr("Reading the cached ABAQUS results '%1'").arg(filePath));
+
+  EntryReader reader(file);
+  char magic[sizeof(k_Magic)] = {};
+  uint32_t version = 0;
+  uint32_t byteOrderMark = 0;
+  QString entryKey;
+  bool valid = reader.read(magic, sizeof(magic)) && std::memcmp(magic, k_Magic, sizeof(k_Magic)) == 0 && reader.read(version) && version == k_Version && reader.read(byteOrderMark) &&
+               byteOrderMark == k_ByteOrderMark && reader.read(entryKey);
+
+  // Two keys with the same hash are simply a miss; the entry is left for the key it belongs to
+  if(valid && entryKey != key)
+  {
+    return false;
+  }
+
+  AbaqusBulkDataReader::Data entryData;
+  if(!valid || !readEntry(reader, entryData) || !file.atEnd())
+  {
+    file.close();
+    QFile::remove(filePath);
+    QString ss = QObject::tr("Removed the unreadable ABAQUS cache entry '%1'").arg(filePath);
+    filter->setWarningCondition(-111, ss);
+    return false;
+  }
+  file.close();
+
+  // The modification time of an entry is the time it was last used, which is what eviction goes by
+  if(file.open(QIODevice::ReadWrite))
+  {
+    file.setFileTime(QDateTime::currentDateTimeUtc(), QFileDevice::FileModificationTime);
+    file.close();
+  }
+
+  data = std::move(entryData);
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+bool AbaqusResultCache::store(AbstractFilter* filter, const QString& key, const AbaqusBulkDataReader::Data& data) const
+{
+  MeshArrays mesh = meshArrays(data.geometry);
+  if(key.isEmpty() || nullptr == mesh.vertices || data.numVerts > std::numeric_limits<uint32_t>::max())
+  {
+    return false;
+  }
+
+  // Results that could never fit are not written only to be evicted again
+  qint64 entrySize = static_cast<qint64>(data.numVerts * 3 * sizeof(float) + data.numCells * mesh.nodesPerElement * sizeof(uint32_t));
+  for(const AbaqusBulkDataReader::Frame& frame : data.frames)
+  {
+    for(const FloatArrayType::Pointer& array : frame.vertexArrays)
+    {
+      entrySize += static_cast<qint64>(numValues(array) * sizeof(float));
+    }
+    for(const FloatArrayType::Pointer& array : frame.cellArrays)
+    {
+      entrySize += static_cast<qint64>(numValues(array) * sizeof(float));
+    }
+  }
+  if(entrySize > m_MaxSize)
+  {
+    filter->notifyStatusMessage(QObject::tr("The ABAQUS results are larger than the cache size limit and are not cached"));
+    return false;
+  }
+
+  QString filePath = entryPath(key);
+  QSaveFile file(filePath);
+  if(!QDir().mkpath(m_Directory) || !file.open(QIODevice::WriteOnly))
+  {
+    QString ss = QObject::tr("Could not write the ABAQUS cache entry '%1'").arg(filePath);
+    filter->setWarningCondition(-112, ss);
+    return false;
+  }
+
+  filter->notifyStatusMessage(QObject::tr("Caching the ABAQUS results in '%1'").arg(filePath));
+
+  EntryWriter writer(file);
+  writer.write(k_Magic, sizeof(k_Magic));
+  writer.write(k_Version);
+  writer.write(k_ByteOrderMark);
+  writer.write(key);
+
+  writer.write(static_cast<uint32_t>(data.geometry->getGeometryType()));
+  writer.write(static_cast<uint32_t>(mesh.nodesPerElement));
+  writer.write(static_cast<uint32_t>(data.geometry->getSpatialDimensionality()));
+  writer.write(static_cast<uint64_t>(data.numVerts));
+  writer.write(static_cast<uint64_t>(data.numCells));
+  writer.write(mesh.vertices, data.numVerts * 3);
+
+  // The vertex count fits in 32 bits, so the connectivity is stored at half the size of the geometry's indices
+  std::vector<uint32_t> connectivity(data.numCells * mesh.nodesPerElement);
+  std::copy_n(mesh.connectivity, connectivity.size(), connectivity.begin());
+  writer.write(connectivity.data(), connectivity.size());
+  connectivity = std::vector<uint32_t>();
+
+  writer.write(static_cast<uint32_t>(data.frames.size()));
+  for(const AbaqusBulkDataReader::Frame& frame : data.frames)
+  {
+    writer.write(frame.frameNumber);
+    writer.write(frame.frameValue);
+    writer.write(static_cast<uint32_t>(frame.vertexArrays.size()));
+    writer.write(static_cast<uint32_t>(frame.cellArrays.size()));
+    for(const std::vector<FloatArrayType::Pointer>* arrays : {&frame.vertexArrays, &frame.cellArrays})
+    {
+      for(const FloatArrayType::Pointer& array : *arrays)
+      {
+        std::vector<size_t> cDims = array->getComponentDimensions();
+        std::vector<uint64_t> dims(cDims.cbegin(), cDims.cend());
+        writer.write(array->getName());
+        writer.write(static_cast<uint32_t>(dims.size()));
+        writer.write(dims.data(), dims.size());
+        writer.write(array->getPointer(0), numValues(array));
+      }
+    }
+  }
+
+  if(!writer.ok() || !file.commit())
+  {
+    QString ss = QObject::tr("Could not write the ABAQUS cache entry '%1'").arg(filePath);
+    filter->setWarningCondition(-112, ss);
+    return false;
+  }
+
+  evict(key);
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+void AbaqusResultCache::evict(const QString& keep) const
+{
+  QString keepPath = keep.isEmpty() ? QString() : QFileInfo(entryPath(keep)).absoluteFilePath();
+
+  // Newest first, so every entry after the limit is reached is older than all the entries that are kept
+  QFileInfoList entries = QDir(m_Directory).entryInfoList({"*" + k_EntryExtension}, QDir::Files, QDir::Time);
+  qint64 totalSize = 0;
+  for(const QFileInfo& entry : entries)
+  {
+    if(entry.absoluteFilePath() == keepPath)
+    {
+      totalSize += entry.size();
+    }
+  }
+  for(const QFileInfo& entry : entries)
+  {
+    if(entry.absoluteFilePath() == keepPath)
+    {
+      continue;
+    }
+    totalSize += entry.size();
+    if(totalSize > m_MaxSize)
+    {
+      QFile::remove(entry.absoluteFilePath());
+      totalSize -= entry.size();
+    }
+  }
+}
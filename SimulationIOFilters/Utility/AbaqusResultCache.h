@@ -0,0 +1,116 @@
+/* ============================================================================
+ * Copyright (c) 2019-2019 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#pragma once
+
+#include <vector>
+
+#include <QtCore/QString>
+
+#include "SIMPLib/Filtering/AbstractFilter.h"
+
+#include "SimulationIO/SimulationIOFilters/Utility/AbaqusBulkDataReader.h"
+
+/**
+ * @brief A local cache of the meshes and field outputs ImportFEAData extracted from ABAQUS odb files, so that
+ * running a pipeline again does not have to start ABAQUS. Each entry is a single binary file named after the key
+ * that holds the geometry and the float arrays of every frame as they were imported. Reading an entry marks it
+ * as recently used, and storing one evicts the least recently used entries until the cache fits its size limit.
+ */
+class AbaqusResultCache
+{
+public:
+  /**
+   * @brief The extension of the cache entry files
+   */
+  static const QString k_EntryExtension;
+
+  AbaqusResultCache(const QString& directory, qint64 maxSize);
+  ~AbaqusResultCache() = default;
+
+  AbaqusResultCache(const AbaqusResultCache&) = delete;
+  AbaqusResultCache(AbaqusResultCache&&) = delete;
+  AbaqusResultCache& operator=(const AbaqusResultCache&) = delete;
+  AbaqusResultCache& operator=(AbaqusResultCache&&) = delete;
+
+  /**
+   * @brief Returns the key of the results extracted from the odb file with the extraction mode for the instance,
+   * step and frames. The key changes whenever the odb file is rewritten, as it covers the size and modification
+   * time of the file.
+   * @param odbFilePath
+   * @param extractionMode
+   * @param instanceName
+   * @param step
+   * @param frameNumbers
+   * @return The key, or an empty string if the odb file does not exist
+   */
+  static QString key(const QString& odbFilePath, int extractionMode, const QString& instanceName, const QString& step, const std::vector<int>& frameNumbers);
+
+  /**
+   * @brief Returns the path of the entry file of key
+   * @param key
+   * @return
+   */
+  QString entryPath(const QString& key) const;
+
+  /**
+   * @brief Reads the entry of key. A missing entry is not an error; an unreadable entry is removed with a warning.
+   * @param filter
+   * @param key
+   * @param data
+   * @return false if the cache does not hold the key
+   */
+  bool load(AbstractFilter* filter, const QString& key, AbaqusBulkDataReader::Data& data) const;
+
+  /**
+   * @brief Writes data as the entry of key and evicts the least recently used entries that no longer fit. Failing to
+   * write the entry only raises a warning.
+   * @param filter
+   * @param key
+   * @param data
+   * @return false if the entry could not be written
+   */
+  bool store(AbstractFilter* filter, const QString& key, const AbaqusBulkDataReader::Data& data) const;
+
+  /**
+   * @brief Removes the least recently used entries until the entries take up no more than the size limit. The entry
+   * of keep is never removed.
+   * @param keep
+   */
+  void evict(const QString& keep = QString()) const;
+
+private:
+  QString m_Directory;
+  qint64 m_MaxSize = 0;
+};
@@ -0,0 +1,632 @@
+/* ============================================================================
+ * Copyright (c) 2019-2019 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "DamaskFileWriter.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include <QtCore/QByteArray>
+#include <QtCore/QFile>
+#include <QtCore/QSysInfo>
+
+#include "SIMPLib/Math/SIMPLibMath.h"
+
+#include "SimulationIO/SimulationIOFilters/Utility/NumberFormatter.hpp"
+#include "SimulationIO/SimulationIOFilters/Utility/SlabWriter.hpp"
+
+namespace
+{
+// Grid entries per formatted block of the .geom file and sections per block of the material.config
+constexpr size_t k_EntriesPerBlock = 1 << 18;
+constexpr size_t k_SectionsPerBlock = 1 << 15;
+// Shortest run or range written as "n of id" or "a to b", the same limit DAMASK uses when it compresses a grid
+constexpr size_t k_MinCompressedLength = 3;
+// Cells per block of the .vti appended data, every block is zlib compressed on its own
+constexpr size_t k_CellsPerVtiBlock = 1 << 18;
+// zlib level of the .vti blocks: runs of material ids compress well even at the fastest level
+constexpr int k_VtiCompressionLevel = 1;
+
+/**
+ * @brief Appends printf formatted text, used for the few header lines.
+ * @param buffer
+ * @param format
+ */
+template <typename... Args>
+void appendFormatted(std::string& buffer, const char* format, Args... args)
+{
+  char text[256];
+  int count = std::snprintf(text, sizeof(text), format, args...);
+  buffer.append(text, static_cast<size_t>(std::clamp(count, 0, static_cast<int>(sizeof(text) - 1))));
+}
+
+/**
+ * @brief Opens the file for writing and writes the header, reporting errors to the filter.
+ * @param filter
+ * @param file
+ * @param header
+ * @return
+ */
+bool openFile(AbstractFilter* filter, QFile& file, const std::string& header)
+{
+  if(!file.open(QIODevice::WriteOnly))
+  {
+    if(filter != nullptr)
+    {
+      QString ss = QObject::tr("Error opening DAMASK file '%1'").arg(file.fileName());
+      filter->setErrorCondition(-10500, ss);
+    }
+    return false;
+  }
+  if(file.write(header.data(), static_cast<qint64>(header.size())) != static_cast<qint64>(header.size()))
+  {
+    if(filter != nullptr)
+    {
+      QString ss = QObject::tr("Error writing DAMASK file '%1'").arg(file.fileName());
+      filter->setErrorCondition(-10501, ss);
+    }
+    return false;
+  }
+  return true;
+}
+
+/**
+ * @brief Returns the SlabWriter callback appending each block to the file, with progress and cancel checks.
+ * @param filter
+ * @param file
+ * @param numBlocks
+ * @return
+ */
+auto blockWriter(AbstractFilter* filter, QFile& file, size_t numBlocks)
+{
+  return [filter, &file, numBlocks](size_t block, const std::string& buffer) {
+    if(filter != nullptr)
+    {
+      if(filter->getCancel())
+      {
+        return false;
+      }
+      QString ss = QObject::tr("Writing %1 block %2/%3").arg(file.fileName()).arg(block + 1).arg(numBlocks);
+      filter->notifyStatusMessage(ss);
+    }
+    if(file.write(buffer.data(), static_cast<qint64>(buffer.size())) != static_cast<qint64>(buffer.size()))
+    {
+      if(filter != nullptr)
+      {
+        QString ss = QObject::tr("Error writing DAMASK file '%1'").arg(file.fileName());
+        filter->setErrorCondition(-10501, ss);
+      }
+      return false;
+    }
+    return true;
+  };
+}
+
+/**
+ * @brief Writes the material.config with numSections texture and microstructure sections named
+ * <label>1 .. <label>N. appendAngles(i, buffer) appends the three angles of section i in degrees
+ * and phase(i) returns its phase.
+ */
+template <typename AnglesFunc, typename PhaseFunc>
+bool writeMaterialConfig(AbstractFilter* filter, const QString& filePath, const char* label, size_t numSections, int32_t numThreads, AnglesFunc&& appendAngles, PhaseFunc&& phase)
+{
+  std::string header;
+  header += "#############################################################################\n";
+  header += "# Generated by DREAM.3D\n";
+  header += "#############################################################################\n";
+  header += "# Add <homogenization>, <crystallite>, and <phase> for a complete definition\n";
+  header += "#############################################################################\n";
+  header += "<texture>\n";
+  if(numSections == 0)
+  {
+    header += "<microstructure>\n";
+  }
+
+  QFile file(filePath);
+  if(!openFile(filter, file, header))
+  {
+    return false;
+  }
+
+  // The texture blocks are followed by the microstructure blocks in one pipeline
+  const size_t numBlocks = (numSections + k_SectionsPerBlock - 1) / k_SectionsPerBlock;
+  auto formatBlock = [&](size_t slab, std::string& buffer) {
+    const bool microstructure = slab >= numBlocks;
+    const size_t block = slab % std::max<size_t>(numBlocks, 1);
+    const size_t begin = block * k_SectionsPerBlock;
+    const size_t end = std::min(begin + k_SectionsPerBlock, numSections);
+    buffer.reserve((end - begin) * 96 + 32);
+    if(microstructure && block == 0)
+    {
+      buffer += "<microstructure>\n";
+    }
+    for(size_t i = begin; i < end; i++)
+    {
+      buffer += '[';
+      buffer += label;
+      NumberFormatter::appendInteger(buffer, i + 1);
+      if(microstructure)
+      {
+        buffer += "]\ncrystallite 1\n(constituent)   phase ";
+        NumberFormatter::appendInteger(buffer, phase(i));
+        buffer += " texture ";
+        NumberFormatter::appendInteger(buffer, i + 1);
+        buffer += " fraction 1.0\n";
+      }
+      else
+      {
+        buffer += "]\n(gauss) ";
+        appendAngles(i, buffer);
+        buffer += "   scatter 0.0   fraction 1.0 \n";
+      }
+    }
+  };
+
+  return SlabWriter::write(numBlocks * 2, SlabWriter::resolveThreadCount(numThreads), formatBlock, blockWriter(filter, file, numBlocks * 2));
+}
+
+/**
+ * @brief Returns the phase ids that occur in phases, in ascending order.
+ * @param phases
+ * @param count
+ * @return
+ */
+std::vector<int32_t> findPhases(const int32_t* phases, size_t count)
+{
+  std::vector<int32_t> phaseIds;
+  if(count == 0)
+  {
+    return phaseIds;
+  }
+  auto range = std::minmax_element(phases, phases + count);
+  const int64_t minPhase = *range.first;
+  std::vector<char> used(static_cast<size_t>(*range.second - minPhase) + 1, 0);
+  for(size_t i = 0; i < count; i++)
+  {
+    used[static_cast<size_t>(phases[i] - minPhase)] = 1;
+  }
+  for(size_t i = 0; i < used.size(); i++)
+  {
+    if(used[i] != 0)
+    {
+      phaseIds.push_back(static_cast<int32_t>(minPhase + static_cast<int64_t>(i)));
+    }
+  }
+  return phaseIds;
+}
+
+/**
+ * @brief Converts Bunge Euler angles to the quaternion (w, x, y, z) of DAMASK, which uses the P = -1 convention
+ * and therefore the negated vector part of FeatureAggregator::eulerToQuaternion.
+ * @param euler
+ * @param quaternion
+ */
+void eulerToDamaskQuaternion(const float* euler, double* quaternion)
+{
+  FeatureAggregator::eulerToQuaternion(euler, quaternion);
+  for(size_t i = 1; i < 4; i++)
+  {
+    // Subtracting from +0.0 keeps zeros positive, so "-0.000000000" is never written
+    quaternion[i] = 0.0 - quaternion[i];
+  }
+}
+
+/**
+ * @brief Writes the material.yaml with numMaterials materials. eulerAngles(i) returns the Bunge Euler angles of
+ * material i in radians and phase(i) its phase.
+ */
+template <typename AnglesFunc, typename PhaseFunc>
+bool writeMaterialYaml(AbstractFilter* filter, const QString& filePath, int32_t homogenizationIndex, size_t numMaterials, const std::vector<int32_t>& phaseIds, int32_t numThreads,
+                       AnglesFunc&& eulerAngles, PhaseFunc&& phase)
+{
+  std::string homogenization = "Homogenization_";
+  NumberFormatter::appendInteger(homogenization, homogenizationIndex);
+
+  std::string header;
+  header += "# Generated by DREAM.3D\n";
+  header += "# Add the homogenization and phase definitions for a complete material file\n";
+  header += "homogenization:\n  " + homogenization + ": {N_constituents: 1}\n";
+  header += phaseIds.empty() ? "phase: {}\n" : "phase:\n";
+  for(int32_t phaseId : phaseIds)
+  {
+    header += "  Phase_";
+    NumberFormatter::appendInteger(header, phaseId);
+    header += ": {}\n";
+  }
+  header += (numMaterials == 0) ? "material: []\n" : "material:\n";
+
+  QFile file(filePath);
+  if(!openFile(filter, file, header))
+  {
+    return false;
+  }
+
+  const size_t numBlocks = (numMaterials + k_SectionsPerBlock - 1) / k_SectionsPerBlock;
+  auto formatBlock = [&](size_t block, std::string& buffer) {
+    const size_t begin = block * k_SectionsPerBlock;
+    const size_t end = std::min(begin + k_SectionsPerBlock, numMaterials);
+    buffer.reserve((end - begin) * 160);
+    double quaternion[4] = {1.0, 0.0, 0.0, 0.0};
+    for(size_t i = begin; i < end; i++)
+    {
+      eulerToDamaskQuaternion(eulerAngles(i), quaternion);
+      buffer += "  - {homogenization: ";
+      buffer += homogenization;
+      buffer += ", constituents: [{phase: Phase_";
+      NumberFormatter::appendInteger(buffer, phase(i));
+      buffer += ", v: 1.0, O: [";
+      for(size_t c = 0; c < 4; c++)
+      {
+        if(c != 0)
+        {
+          buffer += ", ";
+        }
+        NumberFormatter::appendFixed<9>(buffer, quaternion[c]);
+      }
+      buffer += "]}]}\n";
+    }
+  };
+
+  return SlabWriter::write(numBlocks, SlabWriter::resolveThreadCount(numThreads), formatBlock, blockWriter(filter, file, numBlocks));
+}
+
+/**
+ * @brief Appends the "phi1 .. Phi .. phi2 .." angles of a texture section.
+ * @param buffer
+ * @param phi1
+ * @param Phi
+ * @param phi2
+ */
+template <typename T>
+void appendTextureAngles(std::string& buffer, T phi1, T Phi, T phi2)
+{
+  buffer += "phi1 ";
+  NumberFormatter::appendFixed<3>(buffer, phi1);
+  buffer += "   Phi ";
+  NumberFormatter::appendFixed<3>(buffer, Phi);
+  buffer += "    phi2 ";
+  NumberFormatter::appendFixed<3>(buffer, phi2);
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool DamaskFileWriter::writeGeomFile(AbstractFilter* filter, const QString& filePath, const ImageGeom& imageGeom, int32_t homogenizationIndex, const int32_t* featureIds, size_t numMicrostructures,
+                                     bool compress, int32_t numThreads)
+{
+  SizeVec3Type dims = imageGeom.getDimensions();
+  FloatVec3Type spacing = imageGeom.getSpacing();
+  FloatVec3Type origin = imageGeom.getOrigin();
+  const size_t totalPoints = dims[0] * dims[1] * dims[2];
+
+  std::string header;
+  header += "6       header\n";
+  header += "# Generated by DREAM.3D\n";
+  appendFormatted(header, "grid    a %zu    b %zu    c %zu\n", dims[0], dims[1], dims[2]);
+  appendFormatted(header, "size    x %.3f    y %.3f    z %.3f\n", dims[0] * spacing[0], dims[1] * spacing[1], dims[2] * spacing[2]);
+  appendFormatted(header, "origin    x %.3f    y %.3f    z %.3f\n", origin[0], origin[1], origin[2]);
+  appendFormatted(header, "homogenization  %d\n", homogenizationIndex);
+  header += "microstructures ";
+  NumberFormatter::appendInteger(header, numMicrostructures);
+  header += '\n';
+  if(compress && featureIds == nullptr)
+  {
+    header += "1 to ";
+    NumberFormatter::appendInteger(header, totalPoints, 10);
+  }
+
+  QFile file(filePath);
+  if(!openFile(filter, file, header))
+  {
+    return false;
+  }
+  if((compress && featureIds == nullptr) || totalPoints == 0)
+  {
+    return true;
+  }
+
+  // One x row per line (or per group of compressed lines), blocks of whole rows so that 2D images are split across the threads as well
+  const size_t numRows = dims[1] * dims[2];
+  const size_t rowsPerBlock = std::max<size_t>(k_EntriesPerBlock / dims[0], 1);
+  const size_t numBlocks = (numRows + rowsPerBlock - 1) / rowsPerBlock;
+  auto formatBlock = [&](size_t block, std::string& buffer) {
+    const size_t beginRow = block * rowsPerBlock;
+    const size_t endRow = std::min(beginRow + rowsPerBlock, numRows);
+    buffer.reserve((endRow - beginRow) * dims[0] * (compress ? 4 : 11));
+    for(size_t row = beginRow; row < endRow; row++)
+    {
+      if(row != 0)
+      {
+        buffer += '\n';
+      }
+      const size_t offset = row * dims[0];
+      if(compress)
+      {
+        DamaskFileWriter::appendCompressedRow(buffer, featureIds + offset, dims[0]);
+        continue;
+      }
+      for(size_t x = 0; x < dims[0]; x++)
+      {
+        if(x != 0)
+        {
+          buffer += ' ';
+        }
+        if(featureIds != nullptr)
+        {
+          NumberFormatter::appendInteger(buffer, featureIds[offset + x], 10);
+        }
+        else
+        {
+          NumberFormatter::appendInteger(buffer, offset + x + 1, 10);
+        }
+      }
+    }
+  };
+
+  return SlabWriter::write(numBlocks, SlabWriter::resolveThreadCount(numThreads), formatBlock, blockWriter(filter, file, numBlocks));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void DamaskFileWriter::appendCompressedRow(std::string& buffer, const int32_t* ids, size_t count)
+{
+  bool firstToken = true;
+  bool inList = false;
+  size_t i = 0;
+  while(i < count)
+  {
+    size_t run = 1;
+    while(i + run < count && ids[i + run] == ids[i])
+    {
+      run++;
+    }
+    size_t range = 1;
+    while(run == 1 && i + range < count && static_cast<int64_t>(ids[i + range]) == static_cast<int64_t>(ids[i]) + static_cast<int64_t>(range))
+    {
+      range++;
+    }
+
+    if(run >= k_MinCompressedLength || range >= k_MinCompressedLength)
+    {
+      if(!firstToken)
+      {
+        buffer += '\n';
+      }
+      if(run >= k_MinCompressedLength)
+      {
+        NumberFormatter::appendInteger(buffer, run);
+        buffer += " of ";
+        NumberFormatter::appendInteger(buffer, ids[i]);
+        i += run;
+      }
+      else
+      {
+        NumberFormatter::appendInteger(buffer, ids[i]);
+        buffer += " to ";
+        NumberFormatter::appendInteger(buffer, ids[i + range - 1]);
+        i += range;
+      }
+      inList = false;
+    }
+    else
+    {
+      if(!firstToken)
+      {
+        buffer += inList ? ' ' : '\n';
+      }
+      NumberFormatter::appendInteger(buffer, ids[i]);
+      inList = true;
+      i++;
+    }
+    firstToken = false;
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool DamaskFileWriter::writeVtiFile(AbstractFilter* filter, const QString& filePath, const ImageGeom& imageGeom, const int32_t* featureIds, bool compress, int32_t numThreads)
+{
+  SizeVec3Type dims = imageGeom.getDimensions();
+  FloatVec3Type spacing = imageGeom.getSpacing();
+  FloatVec3Type origin = imageGeom.getOrigin();
+  const size_t totalPoints = dims[0] * dims[1] * dims[2];
+
+  std::string header;
+  header += "<?xml version=\"1.0\"?>\n";
+  header += "<VTKFile type=\"ImageData\" version=\"1.0\" byte_order=\"";
+  header += (QSysInfo::ByteOrder == QSysInfo::LittleEndian) ? "LittleEndian" : "BigEndian";
+  header += compress ? "\" header_type=\"UInt64\" compressor=\"vtkZLibDataCompressor\">\n" : "\" header_type=\"UInt64\">\n";
+  appendFormatted(header, "  <ImageData WholeExtent=\"0 %zu 0 %zu 0 %zu\" Origin=\"%.9g %.9g %.9g\" Spacing=\"%.9g %.9g %.9g\">\n", dims[0], dims[1], dims[2], origin[0], origin[1], origin[2],
+                  spacing[0], spacing[1], spacing[2]);
+  appendFormatted(header, "    <Piece Extent=\"0 %zu 0 %zu 0 %zu\">\n", dims[0], dims[1], dims[2]);
+  header += "      <PointData>\n";
+  header += "      </PointData>\n";
+  header += "      <CellData Scalars=\"material\">\n";
+  header += "        <DataArray type=\"Int32\" Name=\"material\" format=\"appended\" offset=\"0\"/>\n";
+  header += "      </CellData>\n";
+  header += "    </Piece>\n";
+  header += "  </ImageData>\n";
+  header += "  <AppendedData encoding=\"raw\">\n";
+  header += "   _";
+
+  // Raw data starts with its size in bytes. Compressed data starts with the number of blocks, the block size, the
+  // size of a partial last block and the compressed size of every block, which are filled in once they are known.
+  const size_t numBlocks = (totalPoints + k_CellsPerVtiBlock - 1) / k_CellsPerVtiBlock;
+  std::vector<uint64_t> blockHeader;
+  if(compress)
+  {
+    blockHeader.assign(3 + numBlocks, 0);
+    blockHeader[0] = numBlocks;
+    blockHeader[1] = k_CellsPerVtiBlock * sizeof(int32_t);
+    blockHeader[2] = (totalPoints % k_CellsPerVtiBlock) * sizeof(int32_t);
+  }
+  else
+  {
+    blockHeader.assign(1, totalPoints * sizeof(int32_t));
+  }
+  const size_t blockHeaderOffset = header.size();
+  header.append(reinterpret_cast<const char*>(blockHeader.data()), blockHeader.size() * sizeof(uint64_t));
+
+  QFile file(filePath);
+  if(!openFile(filter, file, header))
+  {
+    return false;
+  }
+
+  auto formatBlock = [&](size_t block, std::string& buffer) {
+    const size_t begin = block * k_CellsPerVtiBlock;
+    const size_t count = std::min(k_CellsPerVtiBlock, totalPoints - begin);
+    const int32_t* values = (featureIds != nullptr) ? featureIds + begin : nullptr;
+    std::vector<int32_t> indices;
+    if(values == nullptr)
+    {
+      indices.resize(count);
+      for(size_t i = 0; i < count; i++)
+      {
+        indices[i] = static_cast<int32_t>(begin + i);
+      }
+      values = indices.data();
+    }
+
+    if(compress)
+    {
+      // qCompress prefixes the zlib stream with the uncompressed size, which VTK does not expect
+      QByteArray compressed = qCompress(reinterpret_cast<const uchar*>(values), static_cast<int>(count * sizeof(int32_t)), k_VtiCompressionLevel);
+      if(compressed.size() > 4)
+      {
+        buffer.append(compressed.constData() + 4, static_cast<size_t>(compressed.size() - 4));
+      }
+    }
+    else
+    {
+      buffer.append(reinterpret_cast<const char*>(values), count * sizeof(int32_t));
+    }
+  };
+
+  auto writeBlock = blockWriter(filter, file, numBlocks);
+  auto writeCompressedBlock = [&](size_t block, const std::string& buffer) {
+    if(compress)
+    {
+      if(buffer.empty())
+      {
+        if(filter != nullptr)
+        {
+          QString ss = QObject::tr("Error compressing the grid of DAMASK file '%1'").arg(filePath);
+          filter->setErrorCondition(-10502, ss);
+        }
+        return false;
+      }
+      blockHeader[3 + block] = buffer.size();
+    }
+    return writeBlock(block, buffer);
+  };
+
+  if(!SlabWriter::write(numBlocks, SlabWriter::resolveThreadCount(numThreads), formatBlock, writeCompressedBlock))
+  {
+    return false;
+  }
+
+  const std::string trailer = "\n  </AppendedData>\n</VTKFile>\n";
+  const qint64 blockHeaderSize = static_cast<qint64>(blockHeader.size() * sizeof(uint64_t));
+  bool success = true;
+  if(compress)
+  {
+    const qint64 end = file.pos();
+    success = file.seek(static_cast<qint64>(blockHeaderOffset)) && file.write(reinterpret_cast<const char*>(blockHeader.data()), blockHeaderSize) == blockHeaderSize && file.seek(end);
+  }
+  success = success && file.write(trailer.data(), static_cast<qint64>(trailer.size())) == static_cast<qint64>(trailer.size());
+  if(!success && filter != nullptr)
+  {
+    QString ss = QObject::tr("Error writing DAMASK file '%1'").arg(filePath);
+    filter->setErrorCondition(-10501, ss);
+  }
+  return success;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool DamaskFileWriter::writePointwiseMaterialYaml(AbstractFilter* filter, const QString& filePath, int32_t homogenizationIndex, const int32_t* cellPhases, const float* cellEulerAngles, size_t numPoints,
+                                                  int32_t numThreads)
+{
+  auto eulerAngles = [cellEulerAngles](size_t i) { return cellEulerAngles + i * 3; };
+  auto phase = [cellPhases](size_t i) { return cellPhases[i]; };
+
+  return writeMaterialYaml(filter, filePath, homogenizationIndex, numPoints, findPhases(cellPhases, numPoints), numThreads, eulerAngles, phase);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool DamaskFileWriter::writeGrainwiseMaterialYaml(AbstractFilter* filter, const QString& filePath, int32_t homogenizationIndex, const FeatureAggregator::FeatureData& grains, int32_t numThreads)
+{
+  auto eulerAngles = [&grains](size_t i) { return grains.eulerAngles.data() + i * 3; };
+  auto phase = [&grains](size_t i) { return grains.phases[i]; };
+
+  return writeMaterialYaml(filter, filePath, homogenizationIndex, grains.phases.size(), findPhases(grains.phases.data(), grains.phases.size()), numThreads, eulerAngles, phase);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool DamaskFileWriter::writePointwiseMaterialConfig(AbstractFilter* filter, const QString& filePath, const int32_t* cellPhases, const float* cellEulerAngles, size_t numPoints, int32_t numThreads)
+{
+  // The degrees are computed in double precision, as the values printed with fprintf always were
+  auto appendAngles = [cellEulerAngles](size_t i, std::string& buffer) {
+    const float* euler = cellEulerAngles + i * 3;
+    appendTextureAngles(buffer, euler[0] * 180.0 * SIMPLib::Constants::k_1OverPiD, euler[1] * 180.0 * SIMPLib::Constants::k_1OverPiD, euler[2] * 180.0 * SIMPLib::Constants::k_1OverPiD);
+  };
+  auto phase = [cellPhases](size_t i) { return cellPhases[i]; };
+
+  return writeMaterialConfig(filter, filePath, "point", numPoints, numThreads, appendAngles, phase);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool DamaskFileWriter::writeGrainwiseMaterialConfig(AbstractFilter* filter, const QString& filePath, const FeatureAggregator::FeatureData& grains, int32_t numThreads)
+{
+  auto toDegrees = [](float radians) { return static_cast<float>(radians * 180.0 * SIMPLib::Constants::k_1OverPiD); };
+  auto appendAngles = [&grains, toDegrees](size_t i, std::string& buffer) {
+    const float* euler = grains.eulerAngles.data() + (i + 1) * 3;
+    appendTextureAngles(buffer, toDegrees(euler[0]), toDegrees(euler[1]), toDegrees(euler[2]));
+  };
+  auto phase = [&grains](size_t i) { return grains.phases[i + 1]; };
+
+  return writeMaterialConfig(filter, filePath, "grain", static_cast<size_t>(std::max(grains.maxFeatureId, 0)), numThreads, appendAngles, phase);
+}
@@ -0,0 +1,136 @@
+/* ============================================================================
+ * Copyright (c) 2019-2019 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include <QtCore/QString>
+
+#include "SIMPLib/Filtering/AbstractFilter.h"
+#include "SIMPLib/Geometry/ImageGeom.h"
+
+#include "SimulationIO/SimulationIOFilters/Utility/FeatureAggregator.h"
+
+namespace DamaskFileWriter
+{
+/**
+ * @brief Writes the DAMASK .geom file. The grid is written one x row per line, formatted in blocks of
+ * rows on numThreads threads and appended to the file in order.
+ * @param filter Receives progress, cancel requests and errors, may be nullptr
+ * @param filePath
+ * @param imageGeom
+ * @param homogenizationIndex
+ * @param featureIds The microstructure of every voxel, or nullptr to number the voxels 1..N (pointwise)
+ * @param numMicrostructures
+ * @param compress Writes "1 to N" for the pointwise numbering, or every row of feature ids with appendCompressedRow
+ * @param numThreads 0 uses all cores
+ * @return false on a write error or if the filter was canceled
+ */
+bool writeGeomFile(AbstractFilter* filter, const QString& filePath, const ImageGeom& imageGeom, int32_t homogenizationIndex, const int32_t* featureIds, size_t numMicrostructures, bool compress,
+                   int32_t numThreads = 0);
+
+/**
+ * @brief Appends one row of the grid in the compressed DAMASK notation: "n of id" for runs of an id, "a to b"
+ * for ascending ranges and plain lists for everything else. DAMASK only recognizes "of" and "to" in lines with
+ * three entries, so every token is written on its own line.
+ * @param buffer
+ * @param ids
+ * @param count
+ */
+void appendCompressedRow(std::string& buffer, const int32_t* ids, size_t count);
+
+/**
+ * @brief Writes a material.config with one [pointN] texture and microstructure per voxel.
+ * @param filter Receives progress, cancel requests and errors, may be nullptr
+ * @param filePath
+ * @param cellPhases
+ * @param cellEulerAngles Radians
+ * @param numPoints
+ * @param numThreads 0 uses all cores
+ * @return false on a write error or if the filter was canceled
+ */
+bool writePointwiseMaterialConfig(AbstractFilter* filter, const QString& filePath, const int32_t* cellPhases, const float* cellEulerAngles, size_t numPoints, int32_t numThreads = 0);
+
+/**
+ * @brief Writes a material.config with one [grainN] texture and microstructure per feature id 1..maxFeatureId.
+ * @param filter Receives progress, cancel requests and errors, may be nullptr
+ * @param filePath
+ * @param grains
+ * @param numThreads 0 uses all cores
+ * @return false on a write error or if the filter was canceled
+ */
+bool writeGrainwiseMaterialConfig(AbstractFilter* filter, const QString& filePath, const FeatureAggregator::FeatureData& grains, int32_t numThreads = 0);
+
+/**
+ * @brief Writes the grid as a VTK ImageData (.vti) file as read by DAMASK 3: the material index of every cell
+ * is stored as the binary Int32 "material" cell array in the appended data section, either raw or as
+ * zlib compressed blocks that are compressed on numThreads threads.
+ * @param filter Receives progress, cancel requests and errors, may be nullptr
+ * @param filePath
+ * @param imageGeom
+ * @param featureIds The material index of every cell, or nullptr to number the cells 0..N-1 (pointwise)
+ * @param compress
+ * @param numThreads 0 uses all cores
+ * @return false on a write error or if the filter was canceled
+ */
+bool writeVtiFile(AbstractFilter* filter, const QString& filePath, const ImageGeom& imageGeom, const int32_t* featureIds, bool compress, int32_t numThreads = 0);
+
+/**
+ * @brief Writes a DAMASK 3 material.yaml with one material per voxel, material i belonging to the .vti material index i.
+ * The homogenization and phases are listed by name only and have to be defined by the user.
+ * @param filter Receives progress, cancel requests and errors, may be nullptr
+ * @param filePath
+ * @param homogenizationIndex
+ * @param cellPhases
+ * @param cellEulerAngles Radians
+ * @param numPoints
+ * @param numThreads 0 uses all cores
+ * @return false on a write error or if the filter was canceled
+ */
+bool writePointwiseMaterialYaml(AbstractFilter* filter, const QString& filePath, int32_t homogenizationIndex, const int32_t* cellPhases, const float* cellEulerAngles, size_t numPoints,
+                                int32_t numThreads = 0);
+
+/**
+ * @brief Writes a DAMASK 3 material.yaml with one material per feature id 0..maxFeatureId, so that the feature ids
+ * are the .vti material indices.
+ * @param filter Receives progress, cancel requests and errors, may be nullptr
+ * @param filePath
+ * @param homogenizationIndex
+ * @param grains
+ * @param numThreads 0 uses all cores
+ * @return false on a write error or if the filter was canceled
+ */
+bool writeGrainwiseMaterialYaml(AbstractFilter* filter, const QString& filePath, int32_t homogenizationIndex, const FeatureAggregator::FeatureData& grains, int32_t numThreads = 0);
+} // namespace DamaskFileWriter
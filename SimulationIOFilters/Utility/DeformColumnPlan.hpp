@@ -0,0 +1,232 @@
+/* ============================================================================
+ * Copyright (c) 2019-2019 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#pragma once
+
+#include <algorithm>
+#include <string_view>
+#include <vector>
+
+#include <QtCore/QString>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
+
+#include "SimulationIO/SimulationIOFilters/Utility/MappedTextReader.hpp"
+
+namespace SimulationIO
+{
+/**
+ * @brief Compiled description of the columns of a DEFORM point tracking record. The plan is built once per file
+ * from the header. Each time step binds the plan to its arrays, and every record is then parsed in a single pass
+ * over its tokens, converting each token straight into the array of its column without any name lookups or
+ * virtual calls.
+ */
+class DeformColumnPlan
+{
+public:
+  enum class Conversion
+  {
+    Int32,
+    Float
+  };
+
+  struct Column
+  {
+    int32_t index = 0;
+    Conversion conversion = Conversion::Float;
+    QString name;
+    void* destination = nullptr;
+  };
+
+  DeformColumnPlan() = default;
+  ~DeformColumnPlan() = default;
+
+  DeformColumnPlan(const DeformColumnPlan&) = default;
+  DeformColumnPlan(DeformColumnPlan&&) = default;
+  DeformColumnPlan& operator=(const DeformColumnPlan&) = default;
+  DeformColumnPlan& operator=(DeformColumnPlan&&) = default;
+
+  /**
+   * @brief Removes every column
+   */
+  void clear()
+  {
+    m_Columns.clear();
+  }
+
+  /**
+   * @brief Adds the column at token index of each record. The columns are kept sorted by index.
+   * @param index
+   * @param conversion
+   * @param name
+   */
+  void addColumn(int32_t index, Conversion conversion, const QString& name)
+  {
+    Column column;
+    column.index = index;
+    column.conversion = conversion;
+    column.name = name;
+    auto pos = std::upper_bound(m_Columns.begin(), m_Columns.end(), index, [](int32_t value, const Column& other) { return value < other.index; });
+    m_Columns.insert(pos, column);
+  }
+
+  /**
+   * @brief Returns the columns in index order
+   * @return
+   */
+  const std::vector<Column>& columns() const
+  {
+    return m_Columns;
+  }
+
+  /**
+   * @brief Returns the token index of the last column called name, or -1 if there is none
+   * @param name
+   * @return
+   */
+  int32_t findColumn(const QString& name) const
+  {
+    auto column = std::find_if(m_Columns.crbegin(), m_Columns.crend(), [&name](const Column& other) { return other.name == name; });
+    return column == m_Columns.crend() ? -1 : column->index;
+  }
+
+  /**
+   * @brief Creates an array of the type of column with numTuples tuples, zero filled if it is allocated
+   * @param column
+   * @param numTuples
+   * @param allocate
+   * @return
+   */
+  static IDataArray::Pointer createArray(const Column& column, size_t numTuples, bool allocate)
+  {
+    if(column.conversion == Conversion::Int32)
+    {
+      Int32ArrayType::Pointer array = Int32ArrayType::CreateArray(numTuples, column.name, allocate);
+      if(allocate)
+      {
+        array->initializeWithZeros();
+      }
+      return array;
+    }
+    FloatArrayType::Pointer array = FloatArrayType::CreateArray(numTuples, column.name, allocate);
+    if(allocate)
+    {
+      array->initializeWithZeros();
+    }
+    return array;
+  }
+
+  /**
+   * @brief Points every column at the array of the same name in attrMat
+   * @param attrMat
+   * @param numTuples
+   * @return false if an array is missing, has the wrong type or holds fewer than numTuples values
+   */
+  bool bind(AttributeMatrix& attrMat, size_t numTuples)
+  {
+    for(auto& column : m_Columns)
+    {
+      column.destination = nullptr;
+      if(column.conversion == Conversion::Int32)
+      {
+        column.destination = bindArray<Int32ArrayType>(attrMat, column.name, numTuples);
+      }
+      else
+      {
+        column.destination = bindArray<FloatArrayType>(attrMat, column.name, numTuples);
+      }
+      if(nullptr == column.destination)
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /**
+   * @brief Parses the tokens of the next numLines lines of reader into tuple of the bound arrays. As with
+   * QByteArray::toInt() and toFloat() a token that is not a number is stored as 0.
+   * @param reader
+   * @param numLines
+   * @param tuple
+   * @return false if the record holds fewer tokens than the plan has columns
+   */
+  bool parseRecord(MappedTextReader::LineReader& reader, size_t numLines, size_t tuple) const
+  {
+    auto next = m_Columns.cbegin();
+    int32_t index = 0;
+    for(size_t l = 0; l < numLines; l++)
+    {
+      std::string_view line = reader.readLine();
+      for(std::string_view token = MappedTextReader::nextToken(line); !token.empty(); token = MappedTextReader::nextToken(line))
+      {
+        if(next != m_Columns.cend() && next->index == index)
+        {
+          if(next->conversion == Conversion::Int32)
+          {
+            int32_t value = 0;
+            MappedTextReader::parseInteger(token, value);
+            static_cast<int32_t*>(next->destination)[tuple] = value;
+          }
+          else
+          {
+            float value = 0.0f;
+            MappedTextReader::parseFloat(token, value);
+            static_cast<float*>(next->destination)[tuple] = value;
+          }
+          ++next;
+        }
+        index++;
+      }
+    }
+    return next == m_Columns.cend();
+  }
+
+private:
+  std::vector<Column> m_Columns;
+
+  template <typename ArrayType>
+  static void* bindArray(AttributeMatrix& attrMat, const QString& name, size_t numTuples)
+  {
+    typename ArrayType::Pointer array = attrMat.getAttributeArrayAs<ArrayType>(name);
+    if(nullptr == array || !array->isAllocated() || array->getNumberOfTuples() < numTuples)
+    {
+      return nullptr;
+    }
+    return array->getPointer(0);
+  }
+};
+} // namespace SimulationIO
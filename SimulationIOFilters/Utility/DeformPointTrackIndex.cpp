@@ -0,0 +1,267 @@
+/* ============================================================================
+ * Copyright (c) 2019-2019 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include "DeformPointTrackIndex.h"
+
+#include <QtCore/QDataStream>
+#include <QtCore/QDateTime>
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QSaveFile>
+
+#include "SimulationIO/SimulationIOFilters/Utility/MappedTextReader.hpp"
+
+namespace
+{
+constexpr quint32 k_Magic = 0x44505449; // "DPTI"
+constexpr quint32 k_Version = 1;
+
+/**
+ * @brief Returns the size and modification time the cache is validated against
+ * @param filePath
+ * @param fileSize
+ * @param lastModified
+ */
+void fileStamp(const QString& filePath, qint64& fileSize, qint64& lastModified)
+{
+  QFileInfo fi(filePath);
+  fileSize = fi.size();
+  lastModified = fi.lastModified().toMSecsSinceEpoch();
+}
+} // namespace
+
+namespace DeformPointTrackIndex
+{
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString sidecarPath(const QString& filePath)
+{
+  return filePath + ".index";
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool build(std::string_view text, Index& index)
+{
+  index.numPoints = 0;
+  index.numBlocks = 0;
+  index.timeStepOffsets.clear();
+
+  if(index.linesPerBlock <= 0 || index.dataOffset < 0 || static_cast<size_t>(index.dataOffset) > text.size())
+  {
+    return false;
+  }
+  std::string_view data = text.substr(static_cast<size_t>(index.dataOffset));
+
+  // Walk back from the end of the file over the lines of the last block. The line feed that ends the file
+  // terminates the last line rather than starting an empty one.
+  size_t blockEnd = data.size();
+  if(blockEnd > 0 && data[blockEnd - 1] == '\n')
+  {
+    blockEnd--;
+  }
+  size_t blockStart = blockEnd;
+  size_t lineEnd = blockEnd;
+  for(qint32 l = 0; l < index.linesPerBlock; l++)
+  {
+    size_t newline = (lineEnd == 0) ? std::string_view::npos : data.rfind('\n', lineEnd - 1);
+    if(newline == std::string_view::npos)
+    {
+      if(l < index.linesPerBlock - 1 || blockEnd == 0)
+      {
+        return false;
+      }
+      blockStart = 0;
+      break;
+    }
+    blockStart = newline + 1;
+    lineEnd = newline;
+  }
+
+  // The 'Point #' column of the last block holds the number of points
+  MappedTextReader::LineReader blockReader(data.substr(blockStart, blockEnd - blockStart));
+  std::vector<std::string_view> lineTokens;
+  qint32 column = 0;
+  bool found = false;
+  while(!blockReader.atEnd() && !found)
+  {
+    MappedTextReader::tokenize(blockReader.readLine(), lineTokens);
+    for(const auto& token : lineTokens)
+    {
+      if(column == index.pointNumColumn)
+      {
+        found = MappedTextReader::parseInteger(token, index.numPoints);
+        break;
+      }
+      column++;
+    }
+  }
+  if(!found || index.numPoints <= 0)
+  {
+    index.numPoints = 0;
+    return false;
+  }
+
+  // Count the lines of the data section and remember where every time step starts
+  const qint64 linesPerStep = static_cast<qint64>(index.numPoints) * index.linesPerBlock;
+  MappedTextReader::LineReader reader(data);
+  qint64 numLines = 0;
+  while(!reader.atEnd())
+  {
+    if(numLines % linesPerStep == 0)
+    {
+      index.timeStepOffsets.push_back(index.dataOffset + static_cast<qint64>(reader.pos()));
+    }
+    reader.readLine();
+    numLines++;
+  }
+
+  index.numBlocks = numLines / index.linesPerBlock;
+  index.timeStepOffsets.resize(static_cast<size_t>(index.numBlocks / index.numPoints));
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool load(const QString& filePath, Index& index)
+{
+  QFile file(sidecarPath(filePath));
+  if(!file.open(QIODevice::ReadOnly))
+  {
+    return false;
+  }
+
+  QDataStream in(&file);
+  quint32 magic = 0;
+  quint32 version = 0;
+  in >> magic >> version;
+  if(magic != k_Magic || version != k_Version)
+  {
+    return false;
+  }
+
+  qint64 fileSize = 0;
+  qint64 lastModified = 0;
+  fileStamp(filePath, fileSize, lastModified);
+
+  qint64 cachedFileSize = 0;
+  qint64 cachedLastModified = 0;
+  qint64 dataOffset = 0;
+  qint32 linesPerBlock = 0;
+  qint32 pointNumColumn = 0;
+  in >> cachedFileSize >> cachedLastModified >> dataOffset >> linesPerBlock >> pointNumColumn;
+  if(cachedFileSize != fileSize || cachedLastModified != lastModified || dataOffset != index.dataOffset || linesPerBlock != index.linesPerBlock || pointNumColumn != index.pointNumColumn)
+  {
+    return false;
+  }
+
+  qint32 numPoints = 0;
+  qint64 numBlocks = 0;
+  quint64 numTimeSteps = 0;
+  in >> numPoints >> numBlocks >> numTimeSteps;
+  if(in.status() != QDataStream::Ok || numPoints <= 0 || numBlocks < 0 || numTimeSteps != static_cast<quint64>(numBlocks / numPoints))
+  {
+    return false;
+  }
+
+  std::vector<qint64> timeStepOffsets(numTimeSteps);
+  for(auto& offset : timeStepOffsets)
+  {
+    in >> offset;
+  }
+  if(in.status() != QDataStream::Ok)
+  {
+    return false;
+  }
+
+  index.numPoints = numPoints;
+  index.numBlocks = numBlocks;
+  index.timeStepOffsets = std::move(timeStepOffsets);
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool save(const QString& filePath, const Index& index)
+{
+  // QSaveFile only replaces the sidecar once it is completely written, so a concurrent reader never sees half of it
+  QSaveFile file(sidecarPath(filePath));
+  if(!file.open(QIODevice::WriteOnly))
+  {
+    return false;
+  }
+
+  qint64 fileSize = 0;
+  qint64 lastModified = 0;
+  fileStamp(filePath, fileSize, lastModified);
+
+  QDataStream out(&file);
+  out << k_Magic << k_Version;
+  out << fileSize << lastModified << index.dataOffset << index.linesPerBlock << index.pointNumColumn;
+  out << index.numPoints << index.numBlocks << static_cast<quint64>(index.timeStepOffsets.size());
+  for(const auto& offset : index.timeStepOffsets)
+  {
+    out << offset;
+  }
+  if(out.status() != QDataStream::Ok)
+  {
+    file.cancelWriting();
+    return false;
+  }
+  return file.commit();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool loadOrBuild(const QString& filePath, Index& index)
+{
+  if(load(filePath, index))
+  {
+    return true;
+  }
+
+  MappedTextReader::MappedFile file;
+  if(!file.open(filePath) || !build(file.text(), index))
+  {
+    return false;
+  }
+  save(filePath, index);
+  return true;
+}
+} // namespace DeformPointTrackIndex
@@ -0,0 +1,105 @@
+/* ============================================================================
+ * Copyright (c) 2019-2019 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+#include <QtCore/QString>
+
+namespace DeformPointTrackIndex
+{
+/**
+ * @brief Byte offset index of a DEFORM point tracking file. Every time step is a run of numPoints blocks of
+ * linesPerBlock lines, so the offset of the first line of each step is all that is needed to read any step without
+ * touching the ones before it.
+ */
+struct Index
+{
+  // Taken from the header of the file; an index is only valid for the header it was built from
+  qint64 dataOffset = 0;
+  qint32 linesPerBlock = 0;
+  qint32 pointNumColumn = 0;
+
+  // Found by scanning the data section
+  qint32 numPoints = 0;
+  qint64 numBlocks = 0;
+  std::vector<qint64> timeStepOffsets;
+};
+
+/**
+ * @brief Returns the path of the sidecar file the index of filePath is cached in
+ * @param filePath
+ * @return
+ */
+QString sidecarPath(const QString& filePath);
+
+/**
+ * @brief Scans the data section of text, starting at index.dataOffset, and fills in the rest of the index. The
+ * number of points is the 'Point #' value of the last block and every numPoints * linesPerBlock lines start a
+ * new time step; a trailing partial time step is ignored.
+ * @param text
+ * @param index
+ * @return false if the data section does not hold a single complete block
+ */
+bool build(std::string_view text, Index& index);
+
+/**
+ * @brief Loads the cached index of filePath. The cache is rejected if the file changed since it was written or
+ * if it was built from a different header than the one described by index.
+ * @param filePath
+ * @param index
+ * @return
+ */
+bool load(const QString& filePath, Index& index);
+
+/**
+ * @brief Writes index to the sidecar file of filePath. Failing to write it (e.g. a read only directory) is
+ * not an error; the index is simply rebuilt next time.
+ * @param filePath
+ * @param index
+ * @return
+ */
+bool save(const QString& filePath, const Index& index);
+
+/**
+ * @brief Loads the cached index of filePath, or builds it from the memory mapped file and caches it.
+ * @param filePath
+ * @param index
+ * @return false if the file could not be read or holds no complete block
+ */
+bool loadOrBuild(const QString& filePath, Index& index);
+} // namespace DeformPointTrackIndex
@@ -35,6 +35,7 @@
 
 #include <cstdint>
 #include <functional>
+#include <string>
 
 #include <QtCore/QString>
 #include <QtCore/QTextStream>
@@ -43,4 +44,54 @@ namespace EntriesHelper
 {
 void writeEntries(QTextStream& stream, std::function<QString(size_t)> func, size_t maxIndex, size_t maxEntriesPerLine, const QString& delimiter = " ", const QString& eol = "\n",
                   size_t startingNumEntries = 0);
+
+/**
+ * @brief Writes entries with the same layout as writeEntries, but appendEntry(index, buffer) formats each
+ * value directly into a reusable line buffer (see NumberFormatter) instead of returning a QString. The buffer
+ * is handed to the stream in blocks of whole lines.
+ * @param stream
+ * @param appendEntry
+ * @param maxIndex
+ * @param maxEntriesPerLine
+ * @param delimiter
+ * @param eol
+ * @param startingNumEntries
+ */
+template <typename AppendFunc>
+void writeEntriesBuffered(QTextStream& stream, AppendFunc&& appendEntry, size_t maxIndex, size_t maxEntriesPerLine, const char* delimiter = " ", const char* eol = "\n", size_t startingNumEntries = 0)
+{
+  constexpr size_t k_FlushSize = 64 * 1024;
+
+  std::string buffer;
+  buffer.reserve(k_FlushSize + 1024);
+
+  auto flush = [&stream, &buffer]() {
+    stream << QLatin1String(buffer.data(), static_cast<int>(buffer.size()));
+    buffer.clear();
+  };
+
+  size_t entriesPerLine = startingNumEntries;
+  for(size_t i = 0; i < maxIndex; i++)
+  {
+    if(entriesPerLine != 0)
+    {
+      if((entriesPerLine % maxEntriesPerLine) != 0)
+      {
+        buffer += delimiter;
+      }
+      else
+      {
+        buffer += eol;
+        entriesPerLine = 0;
+        if(buffer.size() >= k_FlushSize)
+        {
+          flush();
+        }
+      }
+    }
+    appendEntry(i, buffer);
+    entriesPerLine++;
+  }
+  flush();
 }
+} // namespace EntriesHelper
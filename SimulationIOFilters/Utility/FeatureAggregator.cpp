@@ -0,0 +1,272 @@
+/* ============================================================================
+ * Copyright (c) 2019-2019 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+
+#include "FeatureAggregator.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "SimulationIO/SimulationIOFilters/Utility/SlabWriter.hpp"
+#include "SimulationIO/SimulationIOFilters/Utility/TaskPool.hpp"
+
+namespace
+{
+constexpr double k_TwoPi = 6.283185307179586;
+
+/**
+ * @brief Runs task(0) .. task(numTasks - 1) on numTasks threads and waits for them
+ * @param numTasks
+ * @param task
+ */
+template <typename TaskFunc>
+void runTasks(size_t numTasks, TaskFunc&& task)
+{
+  TaskPool::run(numTasks, numTasks, 0, std::vector<size_t>(numTasks, 0), task, [](size_t) {}, []() { return false; });
+}
+
+// -----------------------------------------------------------------------------
+double dot(const double* a, const double* b)
+{
+  return a[0] * b[0] + a[1] * b[1] + a[2] * b[2] + a[3] * b[3];
+}
+
+/**
+ * @brief What one task collected over its range of voxels, indexed by feature id
+ */
+struct Partial
+{
+  std::vector<size_t> lastVoxels;
+  std::vector<size_t> counts;
+  std::vector<double> quaternionSums;
+  std::vector<double> references;
+};
+} // namespace
+
+namespace FeatureAggregator
+{
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void eulerToQuaternion(const float* euler, double* quaternion)
+{
+  const double sigma = 0.5 * (static_cast<double>(euler[0]) + euler[2]);
+  const double delta = 0.5 * (static_cast<double>(euler[0]) - euler[2]);
+  const double c = std::cos(0.5 * euler[1]);
+  const double s = std::sin(0.5 * euler[1]);
+  quaternion[0] = c * std::cos(sigma);
+  quaternion[1] = -s * std::cos(delta);
+  quaternion[2] = -s * std::sin(delta);
+  quaternion[3] = -c * std::sin(sigma);
+  if(quaternion[0] < 0.0)
+  {
+    for(size_t i = 0; i < 4; i++)
+    {
+      quaternion[i] = -quaternion[i];
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void quaternionToEuler(const double* quaternion, float* euler)
+{
+  const double q0 = quaternion[0];
+  const double q1 = quaternion[1];
+  const double q2 = quaternion[2];
+  const double q3 = quaternion[3];
+  const double q03 = q0 * q0 + q3 * q3;
+  const double q12 = q1 * q1 + q2 * q2;
+  const double chi = std::sqrt(q03 * q12);
+
+  double phi1 = 0.0;
+  double Phi = 0.0;
+  double phi2 = 0.0;
+  if(chi == 0.0 && q12 == 0.0)
+  {
+    phi1 = std::atan2(-2.0 * q0 * q3, q0 * q0 - q3 * q3);
+  }
+  else if(chi == 0.0)
+  {
+    Phi = k_TwoPi * 0.5;
+    phi1 = std::atan2(2.0 * q1 * q2, q1 * q1 - q2 * q2);
+  }
+  else
+  {
+    Phi = std::atan2(2.0 * chi, q03 - q12);
+    phi1 = std::atan2((q1 * q3 - q0 * q2) / chi, (-q0 * q1 - q2 * q3) / chi);
+    phi2 = std::atan2((q0 * q2 + q1 * q3) / chi, (q2 * q3 - q0 * q1) / chi);
+  }
+  euler[0] = static_cast<float>(phi1 < 0.0 ? phi1 + k_TwoPi : phi1);
+  euler[1] = static_cast<float>(Phi);
+  euler[2] = static_cast<float>(phi2 < 0.0 ? phi2 + k_TwoPi : phi2);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+FeatureData aggregate(const int32_t* featureIds, const int32_t* cellPhases, const float* cellEulerAngles, size_t numVoxels, Orientation orientation, int32_t numThreads)
+{
+  FeatureData data;
+  const size_t threads = std::max<size_t>(std::min(SlabWriter::resolveThreadCount(numThreads), numVoxels), 1);
+
+  // The highest feature id, reduced over contiguous voxel ranges
+  std::vector<int32_t> maxIds(threads, 0);
+  runTasks(threads, [&](size_t task) {
+    const size_t begin = numVoxels * task / threads;
+    const size_t end = numVoxels * (task + 1) / threads;
+    if(begin < end)
+    {
+      maxIds[task] = std::max(*std::max_element(featureIds + begin, featureIds + end), 0);
+    }
+  });
+  data.maxFeatureId = *std::max_element(maxIds.begin(), maxIds.end());
+
+  const size_t numFeatures = static_cast<size_t>(data.maxFeatureId) + 1;
+  data.phases.assign(numFeatures, 0);
+  data.eulerAngles.assign(numFeatures * 3, 0.0f);
+  data.voxelCounts.assign(numFeatures, 0);
+  if(data.maxFeatureId == 0)
+  {
+    return data;
+  }
+
+  // Each task accumulates a contiguous range of voxels into partial results for every feature. A partial takes 16 bytes
+  // per feature for LastVoxel (last voxel and count) and 80 bytes for Mean (plus the quaternion sum and reference),
+  // while the input takes 20 bytes per voxel (id, phase and three angles). Tasks are limited so that the partials of
+  // all tasks together stay within the size of the input in either mode.
+  const bool mean = orientation == Orientation::Mean;
+  const size_t partialBytes = mean ? 80 : 16;
+  const size_t numTasks = std::max<size_t>(std::min(threads, numVoxels * 20 / (numFeatures * partialBytes)), 1);
+  std::vector<Partial> partials(numTasks);
+  runTasks(numTasks, [&](size_t task) {
+    Partial& partial = partials[task];
+    partial.lastVoxels.assign(numFeatures, 0);
+    partial.counts.assign(numFeatures, 0);
+    partial.quaternionSums.assign(mean ? numFeatures * 4 : 0, 0.0);
+    partial.references.assign(partial.quaternionSums.size(), 0.0);
+
+    const size_t begin = numVoxels * task / numTasks;
+    const size_t end = numVoxels * (task + 1) / numTasks;
+    double quaternion[4] = {0.0, 0.0, 0.0, 0.0};
+    for(size_t i = begin; i < end; i++)
+    {
+      const int32_t featureId = featureIds[i];
+      if(featureId <= 0)
+      {
+        continue;
+      }
+      const size_t feature = static_cast<size_t>(featureId);
+      partial.lastVoxels[feature] = i;
+      partial.counts[feature]++;
+      if(mean)
+      {
+        // q and -q are the same rotation, so each quaternion is flipped into the half space of the first one
+        eulerToQuaternion(cellEulerAngles + i * 3, quaternion);
+        double* reference = partial.references.data() + feature * 4;
+        if(partial.counts[feature] == 1)
+        {
+          std::copy(quaternion, quaternion + 4, reference);
+        }
+        const double sign = dot(quaternion, reference) < 0.0 ? -1.0 : 1.0;
+        for(size_t c = 0; c < 4; c++)
+        {
+          partial.quaternionSums[feature * 4 + c] += sign * quaternion[c];
+        }
+      }
+    }
+  });
+
+  // The partials are merged in voxel order over ranges of feature ids. The last voxel is the highest index, and the
+  // quaternion sum of each range is flipped into the half space of the first voxel of the feature before it is added.
+  const size_t numMergeTasks = std::min(threads, numFeatures - 1);
+  runTasks(numMergeTasks, [&](size_t task) {
+    const size_t firstId = 1 + (numFeatures - 1) * task / numMergeTasks;
+    const size_t endId = 1 + (numFeatures - 1) * (task + 1) / numMergeTasks;
+    for(size_t feature = firstId; feature < endId; feature++)
+    {
+      size_t count = 0;
+      size_t last = 0;
+      double sum[4] = {0.0, 0.0, 0.0, 0.0};
+      const double* reference = nullptr;
+      for(const Partial& partial : partials)
+      {
+        if(partial.counts[feature] == 0)
+        {
+          continue;
+        }
+        count += partial.counts[feature];
+        last = std::max(last, partial.lastVoxels[feature]);
+        if(mean)
+        {
+          const double* partialReference = partial.references.data() + feature * 4;
+          if(reference == nullptr)
+          {
+            reference = partialReference;
+          }
+          const double sign = dot(partialReference, reference) < 0.0 ? -1.0 : 1.0;
+          for(size_t c = 0; c < 4; c++)
+          {
+            sum[c] += sign * partial.quaternionSums[feature * 4 + c];
+          }
+        }
+      }
+      if(count == 0)
+      {
+        continue;
+      }
+
+      data.voxelCounts[feature] = count;
+      data.phases[feature] = cellPhases[last];
+      if(mean)
+      {
+        const double norm = std::sqrt(dot(sum, sum));
+        if(norm > 0.0)
+        {
+          for(size_t c = 0; c < 4; c++)
+          {
+            sum[c] /= norm;
+          }
+          quaternionToEuler(sum, data.eulerAngles.data() + feature * 3);
+          continue;
+        }
+      }
+      std::copy(cellEulerAngles + last * 3, cellEulerAngles + last * 3 + 3, data.eulerAngles.data() + feature * 3);
+    }
+  });
+
+  return data;
+}
+} // namespace FeatureAggregator
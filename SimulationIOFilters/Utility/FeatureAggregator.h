@@ -0,0 +1,94 @@
+/* ============================================================================
+ * Copyright (c) 2019-2019 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace FeatureAggregator
+{
+/**
+ * @brief How the orientation of a feature is taken from the orientations of its voxels
+ */
+enum class Orientation
+{
+  LastVoxel, ///< The Euler angles of the voxel with the highest index, as the writers always did
+  Mean       ///< The mean orientation of all voxels, averaged as quaternions without crystal symmetry
+};
+
+/**
+ * @brief Per feature values, indexed by feature id from 0 to maxFeatureId. Features without voxels keep zeros.
+ */
+struct FeatureData
+{
+  int32_t maxFeatureId = 0;
+  std::vector<int32_t> phases;
+  std::vector<float> eulerAngles;
+  std::vector<size_t> voxelCounts;
+};
+
+/**
+ * @brief Collects the phase, orientation and voxel count of every feature id greater than 0 in a single parallel
+ * pass over the voxels. Each of up to numThreads threads (0 for all cores) accumulates a contiguous range of voxels,
+ * and the partial results are merged in voxel order. Fewer threads are used when the partial results of all of them
+ * would take more memory than the input. The phase and the LastVoxel orientation are the ones of the last
+ * voxel of the feature. Mean orientations are summed per range, so they can differ in the last bits between
+ * thread counts.
+ * @param featureIds
+ * @param cellPhases
+ * @param cellEulerAngles Bunge Euler angles in radians, 3 per voxel; the result uses the same units
+ * @param numVoxels
+ * @param orientation
+ * @param numThreads
+ * @return
+ */
+FeatureData aggregate(const int32_t* featureIds, const int32_t* cellPhases, const float* cellEulerAngles, size_t numVoxels, Orientation orientation, int32_t numThreads = 0);
+
+/**
+ * @brief Converts Bunge Euler angles in radians to a unit quaternion (w, x, y, z) with w >= 0
+ * @param euler
+ * @param quaternion
+ */
+void eulerToQuaternion(const float* euler, double* quaternion);
+
+/**
+ * @brief Converts a unit quaternion (w, x, y, z) to Bunge Euler angles in radians, phi1 and phi2 in [0, 2pi)
+ * @param quaternion
+ * @param euler
+ */
+void quaternionToEuler(const double* quaternion, float* euler);
+} // namespace FeatureAggregator
@@ -0,0 +1,209 @@
+/* ============================================================================
+ * Copyright (c) 2019-2019 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+
+#include "FeatureStlWriter.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+
+#include <QtCore/QFile>
+
+#include "SimulationIO/SimulationIOFilters/Utility/SlabWriter.hpp"
+#include "SimulationIO/SimulationIOFilters/Utility/TaskPool.hpp"
+
+namespace
+{
+constexpr size_t k_HeaderSize = 80;
+constexpr size_t k_TriangleSize = 50;
+
+/**
+ * @brief Appends the raw bytes of value to buffer; STL is little endian like every platform DREAM.3D runs on
+ * @param buffer
+ * @param value
+ */
+template <typename T>
+void appendBytes(char*& buffer, T value)
+{
+  std::memcpy(buffer, &value, sizeof(T));
+  buffer += sizeof(T);
+}
+} // namespace
+
+namespace FeatureStlWriter
+{
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool sortByFeature(const int32_t* faceLabels, size_t numTris, size_t numFeatures, std::vector<size_t>& offsets, FeatureTriangles& triangles, size_t& invalidTriangle)
+{
+  // Counting sort: count the triangles of each feature, then place them at the running offsets
+  offsets.assign(numFeatures + 1, 0);
+  for(size_t i = 0; i < numTris; i++)
+  {
+    for(size_t side = 0; side < 2; side++)
+    {
+      const int32_t feature = faceLabels[i * 2 + side];
+      if(feature <= 0)
+      {
+        continue;
+      }
+      if(static_cast<size_t>(feature) >= numFeatures)
+      {
+        invalidTriangle = i;
+        return false;
+      }
+      offsets[feature + 1]++;
+    }
+  }
+  for(size_t f = 0; f < numFeatures; f++)
+  {
+    offsets[f + 1] += offsets[f];
+  }
+
+  triangles.resize(offsets[numFeatures]);
+  std::vector<size_t> next(offsets.begin(), offsets.end() - 1);
+  for(size_t i = 0; i < numTris; i++)
+  {
+    for(size_t side = 0; side < 2; side++)
+    {
+      const int32_t feature = faceLabels[i * 2 + side];
+      if(feature > 0)
+      {
+        triangles[next[feature]++] = static_cast<MeshIndexType>(i * 2 + side);
+      }
+    }
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void formatFeature(const float* vertices, const MeshIndexType* tris, int32_t featureId, const MeshIndexType* begin, const MeshIndexType* end, std::vector<char>& buffer)
+{
+  const size_t numTris = static_cast<size_t>(end - begin);
+  const size_t start = buffer.size();
+  buffer.resize(start + k_HeaderSize + sizeof(uint32_t) + numTris * k_TriangleSize, 0);
+  char* out = buffer.data() + start;
+
+  QByteArray header = QString("DREAM3D Generated For Feature ID %1").arg(featureId).toLatin1();
+  std::memcpy(out, header.constData(), std::min<size_t>(static_cast<size_t>(header.size()), k_HeaderSize));
+  out += k_HeaderSize;
+  appendBytes(out, static_cast<uint32_t>(numTris));
+
+  for(const MeshIndexType* entry = begin; entry != end; ++entry)
+  {
+    const MeshIndexType tri = *entry / 2;
+    std::array<MeshIndexType, 3> nodes = {tris[tri * 3], tris[tri * 3 + 1], tris[tri * 3 + 2]};
+    if(*entry % 2 == 1)
+    {
+      // The feature is on the second side of the triangle, so it faces the other way for this feature
+      std::swap(nodes[1], nodes[2]);
+    }
+    const float* a = vertices + nodes[0] * 3;
+    const float* b = vertices + nodes[1] * 3;
+    const float* c = vertices + nodes[2] * 3;
+
+    double normal[3] = {(static_cast<double>(b[1]) - a[1]) * (static_cast<double>(c[2]) - a[2]) - (static_cast<double>(b[2]) - a[2]) * (static_cast<double>(c[1]) - a[1]),
+                        (static_cast<double>(b[2]) - a[2]) * (static_cast<double>(c[0]) - a[0]) - (static_cast<double>(b[0]) - a[0]) * (static_cast<double>(c[2]) - a[2]),
+                        (static_cast<double>(b[0]) - a[0]) * (static_cast<double>(c[1]) - a[1]) - (static_cast<double>(b[1]) - a[1]) * (static_cast<double>(c[0]) - a[0])};
+    const double length = std::sqrt(normal[0] * normal[0] + normal[1] * normal[1] + normal[2] * normal[2]);
+    for(double component : normal)
+    {
+      appendBytes(out, static_cast<float>(length > 0.0 ? component / length : 0.0));
+    }
+    for(const float* vertex : {a, b, c})
+    {
+      appendBytes(out, vertex[0]);
+      appendBytes(out, vertex[1]);
+      appendBytes(out, vertex[2]);
+    }
+    appendBytes(out, static_cast<uint16_t>(0));
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool writeBinary(AbstractFilter* filter, TriangleGeom& surfaceMesh, const int32_t* faceLabels, size_t numFeatures, const std::function<QString(size_t)>& featureFile, int32_t numThreads)
+{
+  std::vector<size_t> offsets;
+  FeatureTriangles triangles;
+  size_t invalidTriangle = 0;
+  if(!sortByFeature(faceLabels, surfaceMesh.getNumberOfTris(), numFeatures, offsets, triangles, invalidTriangle))
+  {
+    filter->setErrorCondition(-4023, QObject::tr("Triangle %1 borders feature %2, which does not exist")
+                                         .arg(invalidTriangle)
+                                         .arg(std::max(faceLabels[invalidTriangle * 2], faceLabels[invalidTriangle * 2 + 1])));
+    return false;
+  }
+  if(numFeatures < 2)
+  {
+    return true;
+  }
+
+  const float* vertices = surfaceMesh.getVertexPointer(0);
+  const MeshIndexType* tris = surfaceMesh.getTriPointer(0);
+  const size_t numFiles = numFeatures - 1;
+  std::vector<char> written(numFiles, 0);
+
+  // Each feature is formatted into its own buffer and written by the same thread, so features are independent
+  auto writeTask = [&](size_t task) {
+    const size_t feature = task + 1;
+    std::vector<char> buffer;
+    formatFeature(vertices, tris, static_cast<int32_t>(feature), triangles.data() + offsets[feature], triangles.data() + offsets[feature + 1], buffer);
+    QFile file(featureFile(feature));
+    written[task] = file.open(QIODevice::WriteOnly) && file.write(buffer.data(), static_cast<qint64>(buffer.size())) == static_cast<qint64>(buffer.size()) ? 1 : 0;
+  };
+  auto reportProgress = [filter, numFiles](size_t numWritten) { filter->notifyStatusMessage(QObject::tr("Wrote %1/%2 feature STL files").arg(numWritten).arg(numFiles)); };
+  TaskPool::run(numFiles, SlabWriter::resolveThreadCount(numThreads), 0, std::vector<size_t>(numFiles, 0), writeTask, reportProgress, [filter]() { return filter->getCancel(); });
+
+  if(filter->getCancel())
+  {
+    return false;
+  }
+  for(size_t i = 0; i < numFiles; i++)
+  {
+    if(written[i] == 0)
+    {
+      filter->setErrorCondition(-4024, QObject::tr("Could not write the STL file '%1'").arg(featureFile(i + 1)));
+      return false;
+    }
+  }
+  return true;
+}
+} // namespace FeatureStlWriter
@@ -0,0 +1,93 @@
+/* ============================================================================
+ * Copyright (c) 2019-2019 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include <QtCore/QString>
+
+#include "SIMPLib/Filtering/AbstractFilter.h"
+#include "SIMPLib/Geometry/TriangleGeom.h"
+
+namespace FeatureStlWriter
+{
+/**
+ * @brief Triangles of one feature: each entry is a triangle index times two, plus one if the triangle must be
+ * written with reversed winding because the feature is on its second side
+ */
+using FeatureTriangles = std::vector<MeshIndexType>;
+
+/**
+ * @brief Sorts the triangles of the surface mesh by feature. Triangles are listed for both features they separate;
+ * labels of 0 or less are outside the sample and are skipped.
+ * @param faceLabels The two feature ids on either side of each triangle
+ * @param numTris
+ * @param numFeatures Number of features including feature 0
+ * @param offsets Set to numFeatures + 1 offsets into triangles, so feature f owns [offsets[f], offsets[f + 1])
+ * @param triangles Set to the entries of every feature, see FeatureTriangles
+ * @param invalidTriangle Set to the first triangle with a label of numFeatures or more
+ * @return false if a label is not a feature
+ */
+bool sortByFeature(const int32_t* faceLabels, size_t numTris, size_t numFeatures, std::vector<size_t>& offsets, FeatureTriangles& triangles, size_t& invalidTriangle);
+
+/**
+ * @brief Appends the binary STL of one feature to buffer: an 80 byte header, the triangle count and 50 bytes per
+ * triangle. The triangles are wound as the "Export STL Files from Triangle Geometry" filter does, so the file
+ * matches the one that filter writes for the same surface mesh.
+ * @param vertices
+ * @param tris
+ * @param featureId
+ * @param begin First entry of the feature in the sorted triangles
+ * @param end One past the last entry of the feature
+ * @param buffer
+ */
+void formatFeature(const float* vertices, const MeshIndexType* tris, int32_t featureId, const MeshIndexType* begin, const MeshIndexType* end, std::vector<char>& buffer);
+
+/**
+ * @brief Writes one binary STL file per feature 1 to numFeatures - 1 of the surface mesh. The features are formatted
+ * and written on numThreads threads (0 for all cores). Errors are reported through filter.
+ * @param filter
+ * @param surfaceMesh
+ * @param faceLabels
+ * @param numFeatures Number of features including feature 0
+ * @param featureFile Returns the path of the STL file of a feature
+ * @param numThreads
+ * @return false if a file could not be written, a label is not a feature or the filter was canceled
+ */
+bool writeBinary(AbstractFilter* filter, TriangleGeom& surfaceMesh, const int32_t* faceLabels, size_t numFeatures, const std::function<QString(size_t)>& featureFile, int32_t numThreads);
+} // namespace FeatureStlWriter
@@ -0,0 +1,266 @@
+/* ============================================================================
+ * Copyright (c) 2019-2019 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+
+#include "GmshMesher.h"
+
+#include <algorithm>
+#include <exception>
+#include <map>
+#include <mutex>
+#include <utility>
+
+#ifdef SimulationIO_USE_GMSH_LIBRARY
+#include <gmsh.h>
+
+#include "SimulationIO/SimulationIOFilters/Utility/SlabWriter.hpp"
+#endif
+
+#ifdef SimulationIO_USE_GMSH_LIBRARY
+namespace
+{
+// Gmsh keeps a single global model, so only one filter may mesh with it at a time
+std::mutex s_GmshMutex;
+
+/**
+ * @brief Initializes Gmsh for the lifetime of the object and finalizes it again, also when meshing throws
+ */
+class GmshSession
+{
+public:
+  GmshSession()
+  {
+    gmsh::initialize(0, nullptr, false);
+  }
+  ~GmshSession()
+  {
+    gmsh::finalize();
+  }
+
+  GmshSession(const GmshSession&) = delete;
+  GmshSession& operator=(const GmshSession&) = delete;
+  GmshSession(GmshSession&&) = delete;
+  GmshSession& operator=(GmshSession&&) = delete;
+};
+} // namespace
+#endif
+
+namespace GmshMesher
+{
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool isAvailable()
+{
+#ifdef SimulationIO_USE_GMSH_LIBRARY
+  return true;
+#else
+  return false;
+#endif
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool tetrahedralize(AbstractFilter* filter, TriangleGeom& surfaceMesh, const int32_t* faceLabels, size_t numFeatures, int32_t numThreads, TetrahedralGeom& tetGeom, AttributeMatrix& vertexAttrMat,
+                    AttributeMatrix& cellAttrMat, std::vector<int32_t>& tetFeatures)
+{
+#ifdef SimulationIO_USE_GMSH_LIBRARY
+  const MeshIndexType numVerts = surfaceMesh.getNumberOfVertices();
+  const MeshIndexType numTris = surfaceMesh.getNumberOfTris();
+  const float* vertices = surfaceMesh.getVertexPointer(0);
+  const MeshIndexType* triangles = surfaceMesh.getTriPointer(0);
+
+  // Group the triangles by the pair of features they separate; each group becomes one surface
+  std::map<std::pair<int32_t, int32_t>, std::vector<MeshIndexType>> interfaces;
+  for(MeshIndexType i = 0; i < numTris; i++)
+  {
+    const int32_t first = std::min(faceLabels[i * 2], faceLabels[i * 2 + 1]);
+    const int32_t second = std::max(faceLabels[i * 2], faceLabels[i * 2 + 1]);
+    if(second <= 0)
+    {
+      continue;
+    }
+    if(static_cast<size_t>(second) >= numFeatures)
+    {
+      filter->setErrorCondition(-4023, QObject::tr("Triangle %1 borders feature %2, which does not exist").arg(i).arg(second));
+      return false;
+    }
+    interfaces[std::make_pair(std::max(first, 0), second)].push_back(i);
+  }
+  if(interfaces.empty())
+  {
+    filter->setErrorCondition(-4025, QObject::tr("The surface mesh does not enclose any feature"));
+    return false;
+  }
+
+  std::lock_guard<std::mutex> lock(s_GmshMutex);
+  try
+  {
+    GmshSession session;
+    const size_t threads = SlabWriter::resolveThreadCount(numThreads);
+    gmsh::option::setNumber("General.Terminal", 0);
+    gmsh::option::setNumber("General.NumThreads", static_cast<double>(threads));
+    gmsh::option::setNumber("Mesh.MaxNumThreads3D", static_cast<double>(threads));
+    gmsh::model::add("Export3dSolidMesh");
+
+    // Each node is added once, to the first surface that uses it; the other surfaces refer to it by tag
+    std::vector<bool> addedNodes(numVerts, false);
+    std::vector<std::vector<int>> featureSurfaces(numFeatures);
+    std::vector<std::size_t> nodeTags;
+    std::vector<double> coords;
+    std::vector<std::size_t> triangleNodeTags;
+    for(const auto& entry : interfaces)
+    {
+      const int surfaceTag = gmsh::model::addDiscreteEntity(2);
+      if(entry.first.first > 0)
+      {
+        featureSurfaces[entry.first.first].push_back(surfaceTag);
+      }
+      featureSurfaces[entry.first.second].push_back(surfaceTag);
+
+      nodeTags.clear();
+      coords.clear();
+      triangleNodeTags.clear();
+      for(MeshIndexType tri : entry.second)
+      {
+        for(size_t j = 0; j < 3; j++)
+        {
+          const MeshIndexType node = triangles[tri * 3 + j];
+          triangleNodeTags.push_back(static_cast<std::size_t>(node) + 1);
+          if(!addedNodes[node])
+          {
+            addedNodes[node] = true;
+            nodeTags.push_back(static_cast<std::size_t>(node) + 1);
+            coords.insert(coords.end(), vertices + node * 3, vertices + node * 3 + 3);
+          }
+        }
+      }
+      gmsh::model::mesh::addNodes(2, surfaceTag, nodeTags, coords);
+      gmsh::model::mesh::addElementsByType(surfaceTag, 2, {}, triangleNodeTags);
+    }
+
+    // The volume of each feature is a discrete entity bounded by the surfaces it shares with its neighbors and is
+    // tagged with its id. Built-in kernel volumes would need geometric surfaces, which discrete surfaces are not.
+    std::vector<int> volumeFeatures;
+    for(size_t i = 1; i < numFeatures; i++)
+    {
+      if(featureSurfaces[i].empty())
+      {
+        continue;
+      }
+      gmsh::model::addDiscreteEntity(3, static_cast<int>(i), featureSurfaces[i]);
+      volumeFeatures.push_back(static_cast<int>(i));
+    }
+
+    filter->notifyStatusMessage(QObject::tr("Meshing %1 features with Gmsh on %2 threads").arg(volumeFeatures.size()).arg(threads));
+    gmsh::model::mesh::generate(3);
+
+    std::vector<double> parametricCoords;
+    gmsh::model::mesh::getNodes(nodeTags, coords, parametricCoords);
+    std::size_t maxNodeTag = 0;
+    for(std::size_t tag : nodeTags)
+    {
+      maxNodeTag = std::max(maxNodeTag, tag);
+    }
+    std::vector<MeshIndexType> nodeIndices(maxNodeTag + 1, 0);
+    for(size_t i = 0; i < nodeTags.size(); i++)
+    {
+      nodeIndices[nodeTags[i]] = static_cast<MeshIndexType>(i);
+    }
+
+    std::vector<std::vector<std::size_t>> featureTets(volumeFeatures.size());
+    std::vector<std::size_t> elementTags;
+    size_t numTets = 0;
+    for(size_t i = 0; i < volumeFeatures.size(); i++)
+    {
+      gmsh::model::mesh::getElementsByType(4, elementTags, featureTets[i], volumeFeatures[i]);
+      numTets += featureTets[i].size() / 4;
+    }
+    if(numTets == 0)
+    {
+      filter->setErrorCondition(-4022, QObject::tr("Gmsh did not create any tetrahedra"));
+      return false;
+    }
+
+    const size_t numPoints = nodeTags.size();
+    vertexAttrMat.resizeAttributeArrays(std::vector<size_t>(1, numPoints));
+    cellAttrMat.resizeAttributeArrays(std::vector<size_t>(1, numTets));
+    tetGeom.resizeVertexList(numPoints);
+    tetGeom.resizeTetList(numTets);
+
+    float* tetVertices = tetGeom.getVertexPointer(0);
+    for(size_t i = 0; i < numPoints * 3; i++)
+    {
+      tetVertices[i] = static_cast<float>(coords[i]);
+    }
+
+    MeshIndexType* tets = tetGeom.getTetPointer(0);
+    tetFeatures.resize(numTets);
+    size_t tet = 0;
+    for(size_t i = 0; i < volumeFeatures.size(); i++)
+    {
+      for(size_t j = 0; j < featureTets[i].size(); j += 4, tet++)
+      {
+        for(size_t k = 0; k < 4; k++)
+        {
+          tets[tet * 4 + k] = nodeIndices[featureTets[i][j + k]];
+        }
+        tetFeatures[tet] = volumeFeatures[i];
+      }
+    }
+  } catch(const std::exception& e)
+  {
+    filter->setErrorCondition(-4022, QObject::tr("Gmsh failed: %1").arg(e.what()));
+    return false;
+  } catch(...)
+  {
+    filter->setErrorCondition(-4022, QObject::tr("Gmsh failed"));
+    return false;
+  }
+  return true;
+#else
+  Q_UNUSED(surfaceMesh);
+  Q_UNUSED(faceLabels);
+  Q_UNUSED(numFeatures);
+  Q_UNUSED(numThreads);
+  Q_UNUSED(tetGeom);
+  Q_UNUSED(vertexAttrMat);
+  Q_UNUSED(cellAttrMat);
+  Q_UNUSED(tetFeatures);
+  filter->setErrorCondition(-4022, QObject::tr("The SimulationIO plugin was built without the Gmsh library (SimulationIO_USE_GMSH_LIBRARY)"));
+  return false;
+#endif
+}
+} // namespace GmshMesher
@@ -0,0 +1,74 @@
+/* ============================================================================
+ * Copyright (c) 2019-2019 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
+#include "SIMPLib/Filtering/AbstractFilter.h"
+#include "SIMPLib/Geometry/TetrahedralGeom.h"
+#include "SIMPLib/Geometry/TriangleGeom.h"
+
+namespace GmshMesher
+{
+/**
+ * @brief Returns true if the plugin was built with SimulationIO_USE_GMSH_LIBRARY, so Gmsh runs in process
+ * rather than as the gmsh executable
+ * @return
+ */
+bool isAvailable();
+
+/**
+ * @brief Meshes every feature enclosed by the surface mesh with the Gmsh library. The triangles between each pair
+ * of features become one discrete Gmsh surface that is shared by both feature volumes, so the tetrahedra are
+ * conforming without merging duplicate nodes afterwards. The resulting points and tetrahedra are copied straight
+ * into tetGeom, with the vertex and cell attribute matrices resized to match. Nothing is written to disk. Errors
+ * are reported through filter.
+ * @param filter
+ * @param surfaceMesh
+ * @param faceLabels The two feature ids on either side of each triangle; ids of 0 or less are outside the sample
+ * @param numFeatures Number of features including feature 0
+ * @param numThreads Number of threads Gmsh may use, 0 for all cores
+ * @param tetGeom
+ * @param vertexAttrMat
+ * @param cellAttrMat
+ * @param tetFeatures Set to the feature id of each tetrahedron
+ * @return false if Gmsh is not available or failed
+ */
+bool tetrahedralize(AbstractFilter* filter, TriangleGeom& surfaceMesh, const int32_t* faceLabels, size_t numFeatures, int32_t numThreads, TetrahedralGeom& tetGeom, AttributeMatrix& vertexAttrMat,
+                    AttributeMatrix& cellAttrMat, std::vector<int32_t>& tetFeatures);
+} // namespace GmshMesher
@@ -0,0 +1,287 @@
+/* ============================================================================
+ * Copyright (c) 2019-2019 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#pragma once
+
+#include <algorithm>
+#include <charconv>
+#include <cstdint>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+#include <QtCore/QByteArray>
+#include <QtCore/QFile>
+#include <QtCore/QString>
+
+namespace MappedTextReader
+{
+/**
+ * @brief Read-only view of a whole text file. The file is memory mapped when possible so the text is never
+ * copied; otherwise it is read into memory once. The view stays valid as long as the MappedFile exists.
+ */
+class MappedFile
+{
+public:
+  MappedFile() = default;
+  ~MappedFile() = default;
+
+  MappedFile(const MappedFile&) = delete;
+  MappedFile(MappedFile&&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+  MappedFile& operator=(MappedFile&&) = delete;
+
+  /**
+   * @brief Opens and maps the file. Returns false if the file could not be opened.
+   * @param filePath
+   * @return
+   */
+  bool open(const QString& filePath)
+  {
+    m_File.setFileName(filePath);
+    if(!m_File.open(QIODevice::ReadOnly))
+    {
+      return false;
+    }
+    qint64 size = m_File.size();
+    if(size <= 0)
+    {
+      return true;
+    }
+    uchar* data = m_File.map(0, size);
+    if(data != nullptr)
+    {
+      m_Text = std::string_view(reinterpret_cast<const char*>(data), static_cast<size_t>(size));
+      return true;
+    }
+    // Not every file system supports mapping, so fall back to reading the file in one go
+    m_Buffer = m_File.readAll();
+    m_Text = std::string_view(m_Buffer.constData(), static_cast<size_t>(m_Buffer.size()));
+    return true;
+  }
+
+  /**
+   * @brief Returns the contents of the file
+   * @return
+   */
+  std::string_view text() const
+  {
+    return m_Text;
+  }
+
+private:
+  QFile m_File;
+  QByteArray m_Buffer;
+  std::string_view m_Text;
+};
+
+/**
+ * @brief Returns true for the characters QByteArray::simplified() treats as whitespace, apart from the line feed
+ * that ends a line.
+ * @param c
+ * @return
+ */
+inline bool isSpace(char c)
+{
+  return c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+}
+
+/**
+ * @brief Removes and returns the first whitespace separated token of text. Returns an empty view once text
+ * holds no more tokens.
+ * @param text
+ * @return
+ */
+inline std::string_view nextToken(std::string_view& text)
+{
+  size_t begin = 0;
+  while(begin < text.size() && isSpace(text[begin]))
+  {
+    begin++;
+  }
+  size_t end = begin;
+  while(end < text.size() && !isSpace(text[end]))
+  {
+    end++;
+  }
+  std::string_view token = text.substr(begin, end - begin);
+  text.remove_prefix(end);
+  return token;
+}
+
+/**
+ * @brief Splits a line into its whitespace separated tokens. The tokens point into the line and the vector is
+ * reused, so no memory is allocated once it has grown to the longest line.
+ * @param line
+ * @param tokens
+ * @return The number of tokens
+ */
+inline size_t tokenize(std::string_view line, std::vector<std::string_view>& tokens)
+{
+  tokens.clear();
+  std::string_view token = nextToken(line);
+  while(!token.empty())
+  {
+    tokens.push_back(token);
+    token = nextToken(line);
+  }
+  return tokens.size();
+}
+
+/**
+ * @brief Parses a whole token as an integer. Returns false and leaves value untouched if it is not one.
+ * @param token
+ * @param value
+ * @return
+ */
+template <typename T>
+bool parseInteger(std::string_view token, T& value)
+{
+  if(!token.empty() && token.front() == '+')
+  {
+    token.remove_prefix(1);
+  }
+  T number = 0;
+  const char* end = token.data() + token.size();
+  std::from_chars_result result = std::from_chars(token.data(), end, number);
+  if(result.ec != std::errc() || result.ptr != end)
+  {
+    return false;
+  }
+  value = number;
+  return true;
+}
+
+/**
+ * @brief Parses a whole token as a float. Like QByteArray::toFloat() the text is converted to a double first,
+ * so the values are identical to the ones the QByteArray based readers produced.
+ * @param token
+ * @param value
+ * @return
+ */
+inline bool parseFloat(std::string_view token, float& value)
+{
+  if(!token.empty() && token.front() == '+')
+  {
+    token.remove_prefix(1);
+  }
+  double number = 0.0;
+  const char* end = token.data() + token.size();
+  std::from_chars_result result = std::from_chars(token.data(), end, number);
+  if(result.ec != std::errc() || result.ptr != end)
+  {
+    return false;
+  }
+  value = static_cast<float>(number);
+  return true;
+}
+
+/**
+ * @brief Reads lines from a block of text without copying them. Lines end at '\n'; a trailing '\r' is left in
+ * the line and treated as whitespace by the tokenizer.
+ */
+class LineReader
+{
+public:
+  explicit LineReader(std::string_view text)
+  : m_Text(text)
+  {
+  }
+
+  /**
+   * @brief Returns true once every line has been read
+   * @return
+   */
+  bool atEnd() const
+  {
+    return m_Pos >= m_Text.size();
+  }
+
+  /**
+   * @brief Returns the offset of the next line in the text
+   * @return
+   */
+  size_t pos() const
+  {
+    return m_Pos;
+  }
+
+  /**
+   * @brief Continues reading at offset pos, which should be the start of a line
+   * @param pos
+   */
+  void seek(size_t pos)
+  {
+    m_Pos = std::min(pos, m_Text.size());
+  }
+
+  /**
+   * @brief Returns the next line without its line feed, or an empty view at the end of the text
+   * @return
+   */
+  std::string_view readLine()
+  {
+    size_t end = m_Text.find('\n', m_Pos);
+    if(end == std::string_view::npos)
+    {
+      end = m_Text.size();
+    }
+    std::string_view line = m_Text.substr(m_Pos, end - m_Pos);
+    m_Pos = std::min(end + 1, m_Text.size());
+    return line;
+  }
+
+  /**
+   * @brief Skips count lines. Returns false if the text ends first.
+   * @param count
+   * @return
+   */
+  bool skipLines(size_t count)
+  {
+    for(size_t i = 0; i < count; i++)
+    {
+      if(atEnd())
+      {
+        return false;
+      }
+      readLine();
+    }
+    return true;
+  }
+
+private:
+  std::string_view m_Text;
+  size_t m_Pos = 0;
+};
+} // namespace MappedTextReader
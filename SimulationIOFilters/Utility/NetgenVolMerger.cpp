@@ -0,0 +1,676 @@
+/* ============================================================================
+ * Copyright (c) 2019-2019 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include "NetgenVolMerger.h"
+
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <limits>
+#include <unordered_map>
+
+#include <QtCore/QFile>
+
+#include "SimulationIO/SimulationIOFilters/Utility/MappedTextReader.hpp"
+#include "SimulationIO/SimulationIOFilters/Utility/NumberFormatter.hpp"
+#include "SimulationIO/SimulationIOFilters/Utility/SlabWriter.hpp"
+#include "SimulationIO/SimulationIOFilters/Utility/TaskPool.hpp"
+
+namespace
+{
+// Coincident points of neighbouring features come from the same STL vertex and are written by Netgen with 16
+// decimals, so they agree far more closely than this
+constexpr double k_RelativeWeldTolerance = 1.0e-8;
+constexpr size_t k_ItemsPerSlab = 100000;
+
+enum class Section
+{
+  SurfaceElements,
+  VolumeElements,
+  EdgeSegments
+};
+
+enum class SlabContent
+{
+  Header,
+  Elements,
+  PointsHeader,
+  Points,
+  End
+};
+
+/**
+ * @brief One piece of the merged file: a section header, the elements of meshes [begin, end) or points [begin, end)
+ */
+struct Slab
+{
+  SlabContent content;
+  Section section;
+  size_t begin;
+  size_t end;
+};
+
+/**
+ * @brief Returns the next line that is neither blank nor a '#' comment, or an empty view at the end of the text
+ * @param reader
+ * @param lineNumber
+ * @return
+ */
+std::string_view nextDataLine(MappedTextReader::LineReader& reader, size_t& lineNumber)
+{
+  while(!reader.atEnd())
+  {
+    std::string_view line = reader.readLine();
+    lineNumber++;
+    std::string_view rest = line;
+    std::string_view token = MappedTextReader::nextToken(rest);
+    if(!token.empty() && token.front() != '#')
+    {
+      return line;
+    }
+  }
+  return {};
+}
+
+/**
+ * @brief Reads the element count that follows a section keyword
+ * @param reader
+ * @param lineNumber
+ * @param count
+ * @return
+ */
+bool readCount(MappedTextReader::LineReader& reader, size_t& lineNumber, size_t& count)
+{
+  std::string_view line = nextDataLine(reader, lineNumber);
+  std::string_view token = MappedTextReader::nextToken(line);
+  return MappedTextReader::parseInteger(token, count) && MappedTextReader::nextToken(line).empty();
+}
+
+/**
+ * @brief Reads count element lines. Each line holds block.numAttributes integers that are kept, skipAfterAttributes
+ * integers that are not, the number of nodes (or fixedNodeCount nodes when it is not 0) and the node numbers. Anything
+ * after the nodes is geometry information and is ignored.
+ * @param reader
+ * @param lineNumber
+ * @param count
+ * @param skipAfterAttributes
+ * @param fixedNodeCount
+ * @param block
+ * @return
+ */
+bool readElements(MappedTextReader::LineReader& reader, size_t& lineNumber, size_t count, size_t skipAfterAttributes, int32_t fixedNodeCount, NetgenVolMerger::ElementBlock& block)
+{
+  block.attributes.reserve(block.attributes.size() + count * block.numAttributes);
+  block.nodeCounts.reserve(block.nodeCounts.size() + count);
+  for(size_t i = 0; i < count; i++)
+  {
+    std::string_view line = nextDataLine(reader, lineNumber);
+    for(size_t a = 0; a < block.numAttributes; a++)
+    {
+      int32_t value = 0;
+      if(!MappedTextReader::parseInteger(MappedTextReader::nextToken(line), value))
+      {
+        return false;
+      }
+      block.attributes.push_back(value);
+    }
+    for(size_t a = 0; a < skipAfterAttributes; a++)
+    {
+      int32_t value = 0;
+      if(!MappedTextReader::parseInteger(MappedTextReader::nextToken(line), value))
+      {
+        return false;
+      }
+    }
+    int32_t numNodes = fixedNodeCount;
+    if(numNodes == 0 && (!MappedTextReader::parseInteger(MappedTextReader::nextToken(line), numNodes) || numNodes <= 0))
+    {
+      return false;
+    }
+    for(int32_t n = 0; n < numNodes; n++)
+    {
+      int64_t node = 0;
+      if(!MappedTextReader::parseInteger(MappedTextReader::nextToken(line), node))
+      {
+        return false;
+      }
+      block.nodes.push_back(node);
+    }
+    block.nodeCounts.push_back(numNodes);
+  }
+  return true;
+}
+
+/**
+ * @brief Returns true if every node of block is one of the numPoints points
+ * @param block
+ * @param numPoints
+ * @return
+ */
+bool nodesInRange(const NetgenVolMerger::ElementBlock& block, size_t numPoints)
+{
+  return std::all_of(block.nodes.begin(), block.nodes.end(), [numPoints](int64_t node) { return node >= 1 && static_cast<size_t>(node) <= numPoints; });
+}
+
+/**
+ * @brief Returns the elements of mesh in section
+ * @param mesh
+ * @param section
+ * @return
+ */
+const NetgenVolMerger::ElementBlock& elementsOf(const NetgenVolMerger::Mesh& mesh, Section section)
+{
+  switch(section)
+  {
+  case Section::SurfaceElements:
+    return mesh.surfaceElements;
+  case Section::VolumeElements:
+    return mesh.volumeElements;
+  default:
+    return mesh.edgeSegments;
+  }
+}
+
+/**
+ * @brief Appends value right aligned in a field of width characters, as Netgen writes its integers
+ * @param buffer
+ * @param value
+ * @param width
+ */
+template <typename T>
+void appendPadded(std::string& buffer, T value, size_t width)
+{
+  char digits[24];
+  auto result = std::to_chars(digits, digits + sizeof(digits), value);
+  size_t length = static_cast<size_t>(result.ptr - digits);
+  if(length < width)
+  {
+    buffer.append(width - length, ' ');
+  }
+  buffer.append(digits, result.ptr);
+}
+
+/**
+ * @brief Appends a coordinate with 16 decimals in a field of 22 characters, as Netgen writes its points
+ * @param buffer
+ * @param value
+ */
+void appendCoordinate(std::string& buffer, double value)
+{
+  char digits[400];
+  auto result = std::to_chars(digits, digits + sizeof(digits), value, std::chars_format::fixed, 16);
+  size_t length = static_cast<size_t>(result.ptr - digits);
+  if(length < 22)
+  {
+    buffer.append(22 - length, ' ');
+  }
+  buffer.append(digits, result.ptr);
+}
+
+/**
+ * @brief Appends the elements of one mesh with their domains, surfaces and points renumbered
+ * @param buffer
+ * @param block
+ * @param mergeMap
+ * @param mesh
+ * @param section
+ */
+void appendElements(std::string& buffer, const NetgenVolMerger::ElementBlock& block, const NetgenVolMerger::MergeMap& mergeMap, size_t mesh, Section section)
+{
+  const std::vector<int64_t>& pointIds = mergeMap.pointIds[mesh];
+  const int32_t domainOffset = mergeMap.domainOffsets[mesh];
+  const int32_t surfaceOffset = mergeMap.surfaceOffsets[mesh];
+
+  size_t node = 0;
+  for(size_t i = 0; i < block.nodeCounts.size(); i++)
+  {
+    const int32_t* attributes = block.attributes.data() + i * block.numAttributes;
+    if(section == Section::SurfaceElements)
+    {
+      // Domain 0 is the outside and stays 0
+      appendPadded(buffer, attributes[0] + surfaceOffset, 8);
+      appendPadded(buffer, attributes[1], 8);
+      appendPadded(buffer, attributes[2] > 0 ? attributes[2] + domainOffset : 0, 8);
+      appendPadded(buffer, attributes[3] > 0 ? attributes[3] + domainOffset : 0, 8);
+      appendPadded(buffer, block.nodeCounts[i], 8);
+    }
+    else if(section == Section::VolumeElements)
+    {
+      // Netgen reads a material of 0 as 1
+      appendPadded(buffer, std::max(attributes[0], 1) + domainOffset, 8);
+      appendPadded(buffer, block.nodeCounts[i], 8);
+    }
+    else
+    {
+      appendPadded(buffer, attributes[0] + surfaceOffset, 8);
+      appendPadded(buffer, 0, 8);
+    }
+    for(int32_t n = 0; n < block.nodeCounts[i]; n++)
+    {
+      appendPadded(buffer, pointIds[static_cast<size_t>(block.nodes[node++] - 1)], 8);
+    }
+    buffer += '\n';
+  }
+}
+} // namespace
+
+namespace NetgenVolMerger
+{
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool parse(std::string_view text, Mesh& mesh, size_t& errorLine)
+{
+  MappedTextReader::LineReader reader(text);
+  size_t lineNumber = 0;
+  bool hasPoints = false;
+
+  while(true)
+  {
+    std::string_view line = nextDataLine(reader, lineNumber);
+    if(line.empty())
+    {
+      break;
+    }
+    std::string_view keyword = MappedTextReader::nextToken(line);
+    errorLine = lineNumber;
+
+    size_t count = 0;
+    bool valid = true;
+    if(keyword == "endmesh")
+    {
+      break;
+    }
+    if(keyword == "dimension" || keyword == "geomtype")
+    {
+      std::string_view valueLine = nextDataLine(reader, lineNumber);
+      valid = MappedTextReader::parseInteger(MappedTextReader::nextToken(valueLine), keyword == "dimension" ? mesh.dimension : mesh.geomType);
+    }
+    else if(keyword == "surfaceelements" || keyword == "surfaceelementsgi" || keyword == "surfaceelementsuv")
+    {
+      // surfnr bcnr domin domout np p1 ... pnp [geometry information]
+      valid = readCount(reader, lineNumber, count) && readElements(reader, lineNumber, count, 0, 0, mesh.surfaceElements);
+    }
+    else if(keyword == "volumeelements")
+    {
+      // matnr np p1 ... pnp
+      valid = readCount(reader, lineNumber, count) && readElements(reader, lineNumber, count, 0, 0, mesh.volumeElements);
+    }
+    else if(keyword == "edgesegments" || keyword == "edgesegmentsgi" || keyword == "edgesegmentsgi2")
+    {
+      // surfid 0 p1 p2 [geometry information]
+      valid = readCount(reader, lineNumber, count) && readElements(reader, lineNumber, count, 1, 2, mesh.edgeSegments);
+    }
+    else if(keyword == "points")
+    {
+      valid = readCount(reader, lineNumber, count);
+      mesh.points.reserve(mesh.points.size() + count * 3);
+      for(size_t i = 0; valid && i < count; i++)
+      {
+        std::string_view pointLine = nextDataLine(reader, lineNumber);
+        for(size_t c = 0; c < 3; c++)
+        {
+          std::string_view token = MappedTextReader::nextToken(pointLine);
+          double value = 0.0;
+          auto result = std::from_chars(token.data(), token.data() + token.size(), value);
+          if(token.empty() || result.ec != std::errc() || result.ptr != token.data() + token.size())
+          {
+            valid = false;
+            break;
+          }
+          mesh.points.push_back(value);
+        }
+      }
+      hasPoints = true;
+    }
+    // Every other section (materials, bcnames, face_colours, ...) is skipped line by line
+
+    if(!valid)
+    {
+      errorLine = lineNumber;
+      return false;
+    }
+  }
+
+  errorLine = lineNumber;
+  size_t numPoints = mesh.points.size() / 3;
+  return hasPoints && nodesInRange(mesh.surfaceElements, numPoints) && nodesInRange(mesh.volumeElements, numPoints) && nodesInRange(mesh.edgeSegments, numPoints);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+MergeMap weld(const std::vector<Mesh>& meshes, double relativeTolerance)
+{
+  MergeMap mergeMap;
+  mergeMap.domainOffsets.resize(meshes.size(), 0);
+  mergeMap.surfaceOffsets.resize(meshes.size(), 0);
+  mergeMap.pointIds.resize(meshes.size());
+
+  // Every mesh gets its own block of domain and surface numbers
+  int32_t domainOffset = 0;
+  int32_t surfaceOffset = 0;
+  size_t totalPoints = 0;
+  double minCoord[3] = {std::numeric_limits<double>::max(), std::numeric_limits<double>::max(), std::numeric_limits<double>::max()};
+  double maxCoord[3] = {std::numeric_limits<double>::lowest(), std::numeric_limits<double>::lowest(), std::numeric_limits<double>::lowest()};
+  for(size_t i = 0; i < meshes.size(); i++)
+  {
+    const Mesh& mesh = meshes[i];
+    mergeMap.domainOffsets[i] = domainOffset;
+    mergeMap.surfaceOffsets[i] = surfaceOffset;
+
+    int32_t numDomains = 1;
+    int32_t numSurfaces = 0;
+    const ElementBlock& surfaces = mesh.surfaceElements;
+    for(size_t e = 0; e < surfaces.nodeCounts.size(); e++)
+    {
+      numSurfaces = std::max(numSurfaces, surfaces.attributes[e * 4]);
+      numDomains = std::max({numDomains, surfaces.attributes[e * 4 + 2], surfaces.attributes[e * 4 + 3]});
+    }
+    for(int32_t material : mesh.volumeElements.attributes)
+    {
+      numDomains = std::max(numDomains, material);
+    }
+    for(int32_t surface : mesh.edgeSegments.attributes)
+    {
+      numSurfaces = std::max(numSurfaces, surface);
+    }
+    domainOffset += numDomains;
+    surfaceOffset += numSurfaces;
+
+    for(size_t p = 0; p < mesh.points.size(); p++)
+    {
+      minCoord[p % 3] = std::min(minCoord[p % 3], mesh.points[p]);
+      maxCoord[p % 3] = std::max(maxCoord[p % 3], mesh.points[p]);
+    }
+    totalPoints += mesh.points.size() / 3;
+  }
+  if(totalPoints == 0)
+  {
+    return mergeMap;
+  }
+
+  double diagonal = std::sqrt((maxCoord[0] - minCoord[0]) * (maxCoord[0] - minCoord[0]) + (maxCoord[1] - minCoord[1]) * (maxCoord[1] - minCoord[1]) +
+                              (maxCoord[2] - minCoord[2]) * (maxCoord[2] - minCoord[2]));
+  double tolerance = relativeTolerance * diagonal;
+  if(tolerance <= 0.0)
+  {
+    tolerance = relativeTolerance;
+  }
+  const double toleranceSquared = tolerance * tolerance;
+
+  // Spatial hash of the merged points: cells of the tolerance size, each the head of a linked list through nextInCell.
+  // Distinct cells that hash to the same key only lengthen a list, as candidates are always compared by distance.
+  auto cellOf = [tolerance, &minCoord](const double* point, int64_t* cell) {
+    for(size_t c = 0; c < 3; c++)
+    {
+      cell[c] = static_cast<int64_t>(std::floor((point[c] - minCoord[c]) / tolerance));
+    }
+  };
+  auto cellKey = [](int64_t x, int64_t y, int64_t z) {
+    return static_cast<uint64_t>(x) * 73856093ULL ^ static_cast<uint64_t>(y) * 19349663ULL ^ static_cast<uint64_t>(z) * 83492791ULL;
+  };
+  const int64_t k_CellOffsets[3] = {0, -1, 1};
+  std::unordered_map<uint64_t, int64_t> cellHeads;
+  cellHeads.reserve(totalPoints);
+  std::vector<int64_t> nextInCell;
+  nextInCell.reserve(totalPoints);
+  mergeMap.points.reserve(totalPoints * 3);
+
+  for(size_t i = 0; i < meshes.size(); i++)
+  {
+    const std::vector<double>& points = meshes[i].points;
+    std::vector<int64_t>& pointIds = mergeMap.pointIds[i];
+    pointIds.resize(points.size() / 3);
+    for(size_t p = 0; p < pointIds.size(); p++)
+    {
+      const double* point = points.data() + p * 3;
+      int64_t cell[3];
+      cellOf(point, cell);
+
+      // The point's own cell is searched first as coincident points almost always share it
+      int64_t match = -1;
+      for(int64_t dx : k_CellOffsets)
+      {
+        for(int64_t dy : k_CellOffsets)
+        {
+          for(int64_t dz : k_CellOffsets)
+          {
+            if(match >= 0)
+            {
+              break;
+            }
+            auto head = cellHeads.find(cellKey(cell[0] + dx, cell[1] + dy, cell[2] + dz));
+            for(int64_t candidate = (head == cellHeads.end() ? -1 : head->second); candidate >= 0; candidate = nextInCell[candidate])
+            {
+              const double* other = mergeMap.points.data() + candidate * 3;
+              double distanceSquared = (point[0] - other[0]) * (point[0] - other[0]) + (point[1] - other[1]) * (point[1] - other[1]) + (point[2] - other[2]) * (point[2] - other[2]);
+              if(distanceSquared <= toleranceSquared)
+              {
+                match = candidate;
+                break;
+              }
+            }
+          }
+        }
+      }
+
+      if(match >= 0)
+      {
+        pointIds[p] = match + 1;
+        mergeMap.numWeldedPoints++;
+        continue;
+      }
+
+      int64_t id = static_cast<int64_t>(nextInCell.size());
+      auto inserted = cellHeads.emplace(cellKey(cell[0], cell[1], cell[2]), id);
+      nextInCell.push_back(inserted.second ? -1 : inserted.first->second);
+      inserted.first->second = id;
+      mergeMap.points.insert(mergeMap.points.end(), point, point + 3);
+      pointIds[p] = id + 1;
+    }
+  }
+
+  return mergeMap;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool write(const std::vector<Mesh>& meshes, const MergeMap& mergeMap, size_t numThreads, const std::function<bool(const std::string&)>& writeChunk)
+{
+  // Each element section is a header slab followed by slabs of consecutive meshes holding about k_ItemsPerSlab
+  // elements; the points follow in slabs of k_ItemsPerSlab points
+  const size_t numPoints = mergeMap.points.size() / 3;
+  const Section sections[3] = {Section::SurfaceElements, Section::VolumeElements, Section::EdgeSegments};
+  size_t numElements[3] = {0, 0, 0};
+  std::vector<Slab> slabs;
+  for(Section section : sections)
+  {
+    const size_t s = static_cast<size_t>(section);
+    slabs.push_back({SlabContent::Header, section, 0, 0});
+    size_t begin = 0;
+    size_t slabElements = 0;
+    for(size_t mesh = 0; mesh < meshes.size(); mesh++)
+    {
+      size_t count = elementsOf(meshes[mesh], section).nodeCounts.size();
+      numElements[s] += count;
+      slabElements += count;
+      if(slabElements >= k_ItemsPerSlab || mesh + 1 == meshes.size())
+      {
+        slabs.push_back({SlabContent::Elements, section, begin, mesh + 1});
+        begin = mesh + 1;
+        slabElements = 0;
+      }
+    }
+  }
+  slabs.push_back({SlabContent::PointsHeader, Section::SurfaceElements, 0, 0});
+  for(size_t begin = 0; begin < numPoints; begin += k_ItemsPerSlab)
+  {
+    slabs.push_back({SlabContent::Points, Section::SurfaceElements, begin, std::min(begin + k_ItemsPerSlab, numPoints)});
+  }
+  slabs.push_back({SlabContent::End, Section::SurfaceElements, 0, 0});
+
+  const int32_t dimension = meshes.empty() ? 3 : meshes.front().dimension;
+  const int32_t geomType = meshes.empty() ? 0 : meshes.front().geomType;
+
+  auto formatSlab = [&](size_t index, std::string& buffer) {
+    const Slab& slab = slabs[index];
+    switch(slab.content)
+    {
+    case SlabContent::Header:
+      if(slab.section == Section::SurfaceElements)
+      {
+        buffer += "mesh3d\ndimension\n";
+        NumberFormatter::appendInteger(buffer, dimension);
+        buffer += "\ngeomtype\n";
+        NumberFormatter::appendInteger(buffer, geomType);
+        buffer += "\n\n# surfnr    bcnr   domin  domout      np      p1      p2      p3\nsurfaceelements\n";
+      }
+      else if(slab.section == Section::VolumeElements)
+      {
+        buffer += "\n#  matnr      np      p1      p2      p3      p4\nvolumeelements\n";
+      }
+      else
+      {
+        buffer += "\n# surfid       0      p1      p2\nedgesegments\n";
+      }
+      NumberFormatter::appendInteger(buffer, numElements[static_cast<size_t>(slab.section)]);
+      buffer += '\n';
+      break;
+    case SlabContent::Elements:
+      for(size_t mesh = slab.begin; mesh < slab.end; mesh++)
+      {
+        appendElements(buffer, elementsOf(meshes[mesh], slab.section), mergeMap, mesh, slab.section);
+      }
+      break;
+    case SlabContent::PointsHeader:
+      buffer += "\n#          X             Y             Z\npoints\n";
+      NumberFormatter::appendInteger(buffer, numPoints);
+      buffer += '\n';
+      break;
+    case SlabContent::Points:
+      for(size_t p = slab.begin; p < slab.end; p++)
+      {
+        appendCoordinate(buffer, mergeMap.points[p * 3]);
+        buffer += ' ';
+        appendCoordinate(buffer, mergeMap.points[p * 3 + 1]);
+        buffer += ' ';
+        appendCoordinate(buffer, mergeMap.points[p * 3 + 2]);
+        buffer += '\n';
+      }
+      break;
+    case SlabContent::End:
+      buffer += "\nendmesh\n";
+      break;
+    }
+  };
+
+  return SlabWriter::write(slabs.size(), numThreads, formatSlab, [&writeChunk](size_t, const std::string& buffer) { return writeChunk(buffer); });
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool merge(AbstractFilter* filter, const QStringList& meshFiles, const QString& mergedFile, int32_t numThreads)
+{
+  const size_t numMeshes = static_cast<size_t>(meshFiles.size());
+  const size_t threads = SlabWriter::resolveThreadCount(numThreads);
+
+  // Reading and parsing the feature meshes is most of the work and every mesh is independent
+  std::vector<Mesh> meshes(numMeshes);
+  std::vector<int8_t> opened(numMeshes, 0);
+  std::vector<int8_t> parsed(numMeshes, 0);
+  std::vector<size_t> errorLines(numMeshes, 0);
+  auto readTask = [&](size_t i) {
+    MappedTextReader::MappedFile file;
+    opened[i] = file.open(meshFiles[static_cast<int>(i)]) ? 1 : 0;
+    parsed[i] = opened[i] != 0 && parse(file.text(), meshes[i], errorLines[i]) ? 1 : 0;
+  };
+  auto reportProgress = [filter, numMeshes](size_t numRead) { filter->notifyStatusMessage(QObject::tr("Read %1/%2 feature meshes").arg(numRead).arg(numMeshes)); };
+  TaskPool::run(numMeshes, threads, 0, std::vector<size_t>(numMeshes, 0), readTask, reportProgress, [filter]() { return filter->getCancel(); });
+
+  if(filter->getCancel())
+  {
+    return false;
+  }
+  for(size_t i = 0; i < numMeshes; i++)
+  {
+    if(opened[i] == 0)
+    {
+      filter->setErrorCondition(-4013, QObject::tr("Could not open the Netgen volume mesh '%1'").arg(meshFiles[static_cast<int>(i)]));
+      return false;
+    }
+    if(parsed[i] == 0)
+    {
+      filter->setErrorCondition(-4014, QObject::tr("Invalid Netgen volume mesh at line %1 of '%2'").arg(errorLines[i]).arg(meshFiles[static_cast<int>(i)]));
+      return false;
+    }
+  }
+
+  filter->notifyStatusMessage(QObject::tr("Welding the points shared by %1 feature meshes").arg(numMeshes));
+  MergeMap mergeMap = weld(meshes, k_RelativeWeldTolerance);
+
+  QFile outFile(mergedFile);
+  if(!outFile.open(QIODevice::WriteOnly))
+  {
+    filter->setErrorCondition(-4015, QObject::tr("Could not open the merged mesh '%1' for writing").arg(mergedFile));
+    return false;
+  }
+
+  filter->notifyStatusMessage(QObject::tr("Writing the merged mesh '%1'").arg(mergedFile));
+  bool writeError = false;
+  bool written = write(meshes, mergeMap, threads, [filter, &outFile, &writeError](const std::string& chunk) {
+    if(filter->getCancel())
+    {
+      return false;
+    }
+    writeError = outFile.write(chunk.data(), static_cast<qint64>(chunk.size())) != static_cast<qint64>(chunk.size());
+    return !writeError;
+  });
+  outFile.close();
+
+  if(writeError)
+  {
+    filter->setErrorCondition(-4016, QObject::tr("Could not write the merged mesh '%1'").arg(mergedFile));
+  }
+  if(!written)
+  {
+    return false;
+  }
+
+  filter->notifyStatusMessage(QObject::tr("Merged %1 feature meshes: %2 points (%3 welded on feature boundaries)").arg(numMeshes).arg(mergeMap.points.size() / 3).arg(mergeMap.numWeldedPoints));
+  return true;
+}
+} // namespace NetgenVolMerger
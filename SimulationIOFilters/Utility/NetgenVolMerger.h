@@ -0,0 +1,138 @@
+/* ============================================================================
+ * Copyright (c) 2019-2019 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <QtCore/QString>
+#include <QtCore/QStringList>
+
+#include "SIMPLib/Filtering/AbstractFilter.h"
+
+namespace NetgenVolMerger
+{
+/**
+ * @brief The elements of one section of a Netgen volume mesh. Element i has numAttributes integers in attributes
+ * (e.g. the surface number, boundary condition and domains of a surface element) and nodeCounts[i] 1-based point
+ * numbers in nodes.
+ */
+struct ElementBlock
+{
+  explicit ElementBlock(size_t attributesPerElement = 0)
+  : numAttributes(attributesPerElement)
+  {
+  }
+
+  size_t numAttributes = 0;
+  std::vector<int32_t> attributes;
+  std::vector<int32_t> nodeCounts;
+  std::vector<int64_t> nodes;
+};
+
+/**
+ * @brief The parts of an ASCII Netgen .vol file that survive a merge. Geometry information attached to surface
+ * elements and edge segments refers to the STL file of a single feature and is dropped, as Netgen's own merge does.
+ */
+struct Mesh
+{
+  int32_t dimension = 3;
+  int32_t geomType = 0;
+  ElementBlock surfaceElements = ElementBlock(4); // surfnr, bcnr, domin, domout
+  ElementBlock volumeElements = ElementBlock(1);  // matnr
+  ElementBlock edgeSegments = ElementBlock(1);    // surfid
+  std::vector<double> points;         // x, y, z of each point
+};
+
+/**
+ * @brief How the meshes are combined: the domain and surface numbers of mesh i are shifted by domainOffsets[i] and
+ * surfaceOffsets[i], and its point p becomes merged point pointIds[i][p] (1-based).
+ */
+struct MergeMap
+{
+  std::vector<int32_t> domainOffsets;
+  std::vector<int32_t> surfaceOffsets;
+  std::vector<std::vector<int64_t>> pointIds;
+  std::vector<double> points;
+  size_t numWeldedPoints = 0;
+};
+
+/**
+ * @brief Parses the text of an ASCII Netgen .vol file. Sections other than the surface and volume elements, edge
+ * segments and points are skipped.
+ * @param text
+ * @param mesh
+ * @param errorLine Set to the 1-based line that could not be parsed
+ * @return false if the text is not a valid volume mesh
+ */
+bool parse(std::string_view text, Mesh& mesh, size_t& errorLine);
+
+/**
+ * @brief Numbers the domains and surfaces of the meshes consecutively and welds their coincident points. Points
+ * closer than relativeTolerance times the diagonal of the bounding box of all points are found through a spatial
+ * hash with cells of that size, so only the 27 cells around a point are searched. Points keep the order of the
+ * meshes and the first of a group of coincident points is the one kept.
+ * @param meshes
+ * @param relativeTolerance
+ * @return
+ */
+MergeMap weld(const std::vector<Mesh>& meshes, double relativeTolerance);
+
+/**
+ * @brief Formats the merged mesh as an ASCII .vol file in a single pass. The text is generated in slabs on numThreads
+ * threads and handed to writeChunk in file order.
+ * @param meshes
+ * @param mergeMap
+ * @param numThreads
+ * @param writeChunk Returns false to stop writing
+ * @return false if writeChunk stopped the writing
+ */
+bool write(const std::vector<Mesh>& meshes, const MergeMap& mergeMap, size_t numThreads, const std::function<bool(const std::string&)>& writeChunk);
+
+/**
+ * @brief Merges the Netgen volume meshes of the features into mergedFile, replacing one 'netgen -mergefile' run
+ * per feature. The meshes are read in parallel, the points they share on feature boundaries are welded, and every
+ * feature keeps its own domain. Errors are reported through filter.
+ * @param filter
+ * @param meshFiles
+ * @param mergedFile
+ * @param numThreads 0 uses all cores
+ * @return false if a mesh could not be read, the merged mesh could not be written or the filter was canceled
+ */
+bool merge(AbstractFilter* filter, const QStringList& meshFiles, const QString& mergedFile, int32_t numThreads = 0);
+} // namespace NetgenVolMerger
@@ -0,0 +1,227 @@
+/* ============================================================================
+ * Copyright (c) 2019-2019 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstdlib>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <type_traits>
+
+namespace NumberFormatter
+{
+/**
+ * @brief Appends the decimal representation of an integer to the buffer.
+ * @param buffer
+ * @param value
+ */
+template <typename T>
+inline void appendInteger(std::string& buffer, T value)
+{
+  static_assert(std::is_integral<T>::value, "appendInteger requires an integral type");
+  char digits[24];
+  auto result = std::to_chars(digits, digits + sizeof(digits), value);
+  buffer.append(digits, result.ptr);
+}
+
+/**
+ * @brief Appends the decimal representation of an integer right aligned in a field of at least width
+ * characters, matching printf("%<width>d").
+ * @param buffer
+ * @param value
+ * @param width
+ */
+template <typename T>
+inline void appendInteger(std::string& buffer, T value, size_t width)
+{
+  static_assert(std::is_integral<T>::value, "appendInteger requires an integral type");
+  char digits[24];
+  auto result = std::to_chars(digits, digits + sizeof(digits), value);
+  size_t length = static_cast<size_t>(result.ptr - digits);
+  if(length < width)
+  {
+    buffer.append(width - length, ' ');
+  }
+  buffer.append(digits, result.ptr);
+}
+
+/**
+ * @brief Appends a float in fixed notation with Precision decimals. The output is identical to
+ * printf("%.<Precision>f") and std::fixed << std::setprecision(Precision): a float scaled by 10^Precision
+ * is exact in a double for Precision <= 12, so rounding that product to the nearest integer (ties to even)
+ * rounds the exact decimal value the same way the C library does.
+ * @param buffer
+ * @param value
+ */
+template <int Precision>
+inline void appendFixed(std::string& buffer, float value)
+{
+  static_assert(Precision >= 0 && Precision <= 12, "appendFixed supports 0 to 12 decimals");
+  constexpr uint64_t k_Scale = [] {
+    uint64_t scale = 1;
+    for(int i = 0; i < Precision; i++)
+    {
+      scale *= 10;
+    }
+    return scale;
+  }();
+
+  double scaled = static_cast<double>(value) * static_cast<double>(k_Scale);
+  if(!std::isfinite(scaled) || std::fabs(scaled) >= 9.0e18)
+  {
+    char text[512];
+    int count = std::snprintf(text, sizeof(text), "%.*f", Precision, static_cast<double>(value));
+    buffer.append(text, static_cast<size_t>(count));
+    return;
+  }
+
+  if(std::signbit(value))
+  {
+    buffer += '-';
+    scaled = -scaled;
+  }
+  uint64_t rounded = static_cast<uint64_t>(std::nearbyint(scaled));
+  appendInteger(buffer, rounded / k_Scale);
+  if constexpr(Precision > 0)
+  {
+    buffer += '.';
+    uint64_t fraction = rounded % k_Scale;
+    char digits[Precision];
+    for(int i = Precision - 1; i >= 0; i--)
+    {
+      digits[i] = static_cast<char>('0' + fraction % 10);
+      fraction /= 10;
+    }
+    buffer.append(digits, Precision);
+  }
+}
+
+/**
+ * @brief Appends a double in fixed notation with Precision decimals. std::to_chars rounds the exact
+ * binary value like printf("%.<Precision>f") does, so the output is identical.
+ * @param buffer
+ * @param value
+ */
+template <int Precision>
+inline void appendFixed(std::string& buffer, double value)
+{
+  static_assert(Precision >= 0 && Precision <= 12, "appendFixed supports 0 to 12 decimals");
+  char text[512];
+  char* textEnd = std::to_chars(text, text + sizeof(text), value, std::chars_format::fixed, Precision).ptr;
+  buffer.append(text, textEnd);
+}
+
+/**
+ * @brief Appends a value in scientific notation with Precision decimals and an upper case exponent,
+ * matching QString::number(value, 'E', Precision): digits are correctly rounded with exact ties rounded
+ * away from zero (std::to_chars and printf round those to even, so they are fixed up here), and -0 is
+ * written as 0.
+ * @param buffer
+ * @param value
+ */
+template <int Precision>
+inline void appendScientific(std::string& buffer, double value)
+{
+  static_assert(Precision >= 1 && Precision <= 16, "appendScientific supports 1 to 16 decimals");
+
+  // QString::number drops the sign of zero
+  if(value == 0.0)
+  {
+    value = 0.0;
+  }
+
+  char text[32];
+  char* textEnd = std::to_chars(text, text + sizeof(text), value, std::chars_format::scientific, Precision).ptr;
+
+  if(std::isfinite(value))
+  {
+    // A tie can only exist when one more digit rounds to a trailing 5. Only then is the exact
+    // expansion (at most 767 significant digits for a double) generated to check the remainder.
+    char nextDigits[32];
+    char* nextEnd = std::to_chars(nextDigits, nextDigits + sizeof(nextDigits), value, std::chars_format::scientific, Precision + 1).ptr;
+    char* nextExponent = std::find(nextDigits, nextEnd, 'e');
+    if(*(nextExponent - 1) == '5')
+    {
+      char exact[800];
+      char* exactEnd = std::to_chars(exact, exact + sizeof(exact), value, std::chars_format::scientific, 770).ptr;
+      char* exactExponent = std::find(exact, exactEnd, 'e');
+      size_t mantissaLength = static_cast<size_t>(nextExponent - nextDigits);
+      bool isTie = std::all_of(exact + mantissaLength, exactExponent, [](char c) { return c == '0'; });
+      if(isTie && std::equal(nextDigits, nextExponent, exact))
+      {
+        // Round the magnitude up, carrying into the exponent when every digit is a 9
+        std::string digits(nextDigits, nextExponent - 1);
+        size_t firstDigit = (digits[0] == '-') ? 1 : 0;
+        bool carry = true;
+        for(size_t i = digits.size(); i-- > firstDigit && carry;)
+        {
+          if(digits[i] == '.')
+          {
+            continue;
+          }
+          carry = (digits[i] == '9');
+          digits[i] = carry ? '0' : static_cast<char>(digits[i] + 1);
+        }
+        int exponent = 0;
+        std::from_chars(nextExponent + 2, nextEnd, exponent);
+        exponent = (nextExponent[1] == '-') ? -exponent : exponent;
+        if(carry)
+        {
+          digits[firstDigit] = '1';
+          exponent++;
+        }
+        buffer.append(digits);
+        buffer += (exponent < 0) ? "E-" : "E+";
+        exponent = std::abs(exponent);
+        if(exponent < 10)
+        {
+          buffer += '0';
+        }
+        appendInteger(buffer, exponent);
+        return;
+      }
+    }
+  }
+
+  char* exponent = std::find(text, textEnd, 'e');
+  if(exponent != textEnd)
+  {
+    *exponent = 'E';
+  }
+  buffer.append(text, textEnd);
+}
+} // namespace NumberFormatter
@@ -33,24 +33,27 @@
 
 #include "OnScaleTableFileWriter.h"
 
+#include "SimulationIO/SimulationIOFilters/Utility/NumberFormatter.hpp"
+
 void OnScaleTableFileWriter::writeCoords(QTextStream& stream, const QString& text, size_t maxIndex, float origin, float spacing)
 {
   stream << QString("%1 %2\n").arg(text).arg(maxIndex);
 
-  auto func = [origin, spacing](size_t i) { return QString::number(origin + (i * spacing), 'E', 8); };
+  auto func = [origin, spacing](size_t i, std::string& buffer) { NumberFormatter::appendScientific<8>(buffer, origin + (i * spacing)); };
 
-  EntriesHelper::writeEntries(stream, func, maxIndex, 6);
+  EntriesHelper::writeEntriesBuffered(stream, func, maxIndex, 6);
 
   stream << "\n";
 }
 
-void OnScaleTableFileWriter::writeCoords(QTextStream& stream, const QString& text, const FloatArrayType& bounds)
+void OnScaleTableFileWriter::writeCoords(QTextStream& stream, const QString& text, const FloatArrayType& bounds, bool reversed)
 {
   stream << QString("%1 %2\n").arg(text).arg(bounds.size());
 
-  auto func = [&bounds](size_t i) { return QString::number(bounds[i], 'E', 8); };
+  size_t lastIndex = bounds.size() - 1;
+  auto func = [&bounds, reversed, lastIndex](size_t i, std::string& buffer) { NumberFormatter::appendScientific<8>(buffer, reversed ? -bounds[lastIndex - i] : bounds[i]); };
 
-  EntriesHelper::writeEntries(stream, func, bounds.size(), 6);
+  EntriesHelper::writeEntriesBuffered(stream, func, bounds.size(), 6);
 
   stream << "\n";
 }
@@ -33,6 +33,10 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <functional>
+
 #include <QtCore/QDir>
 #include <QtCore/QFile>
 #include <QtCore/QString>
@@ -45,25 +49,191 @@
 #include "SIMPLib/Geometry/RectGridGeom.h"
 
 #include "SimulationIO/SimulationIOFilters/Utility/EntriesHelper.h"
+#include "SimulationIO/SimulationIOFilters/Utility/NumberFormatter.hpp"
+#include "SimulationIO/SimulationIOFilters/Utility/SlabWriter.hpp"
 
 namespace OnScaleTableFileWriter
 {
+/**
+ * @brief Read-only view of the cells of a grid rotated by multiples of 90 degrees, so rotated data can be read
+ * straight from the source array without copying it. Axis a of the view runs along source axis axes[a], in
+ * reverse when reversed[a] is set. A default constructed view of sourceDims is the source grid itself.
+ */
+struct PermutedGridView
+{
+  std::array<size_t, 3> sourceDims = {0, 0, 0};
+  std::array<size_t, 3> axes = {0, 1, 2};
+  std::array<bool, 3> reversed = {false, false, false};
+
+  size_t dim(size_t axis) const
+  {
+    return sourceDims[axes[axis]];
+  }
+
+  size_t size() const
+  {
+    return sourceDims[0] * sourceDims[1] * sourceDims[2];
+  }
+
+  bool isIdentity() const
+  {
+    return axes == std::array<size_t, 3>{0, 1, 2} && reversed == std::array<bool, 3>{false, false, false};
+  }
+
+  /**
+   * @brief Calls func(sourceIndex) for the view cells [begin, end) in view order (x fastest), stepping
+   * through the source array with fixed strides.
+   * @param begin
+   * @param end
+   * @param func
+   */
+  template <typename Func>
+  void forEach(size_t begin, size_t end, Func&& func) const
+  {
+    if(isIdentity())
+    {
+      for(size_t n = begin; n < end; n++)
+      {
+        func(n);
+      }
+      return;
+    }
+
+    const std::array<int64_t, 3> sourceStrides = {1, static_cast<int64_t>(sourceDims[0]), static_cast<int64_t>(sourceDims[0] * sourceDims[1])};
+    std::array<int64_t, 3> steps = {0, 0, 0};
+    int64_t offset = 0;
+    for(size_t axis = 0; axis < 3; axis++)
+    {
+      int64_t stride = sourceStrides[axes[axis]];
+      steps[axis] = reversed[axis] ? -stride : stride;
+      offset += reversed[axis] ? static_cast<int64_t>(dim(axis) - 1) * stride : 0;
+    }
+
+    const size_t nx = dim(0);
+    const size_t ny = dim(1);
+    size_t i = begin % nx;
+    size_t j = (begin / nx) % ny;
+    size_t k = begin / (nx * ny);
+    offset += static_cast<int64_t>(i) * steps[0] + static_cast<int64_t>(j) * steps[1] + static_cast<int64_t>(k) * steps[2];
+
+    for(size_t n = begin; n < end; n++)
+    {
+      func(static_cast<size_t>(offset));
+      offset += steps[0];
+      if(++i == nx)
+      {
+        i = 0;
+        offset += steps[1] - static_cast<int64_t>(nx) * steps[0];
+        if(++j == ny)
+        {
+          j = 0;
+          offset += steps[2] - static_cast<int64_t>(ny) * steps[1];
+        }
+      }
+    }
+  }
+};
+
 void writeCoords(QTextStream& stream, const QString& text, size_t maxIndex, float origin, float spacing);
-void writeCoords(QTextStream& stream, const QString& text, const FloatArrayType& bounds);
+void writeCoords(QTextStream& stream, const QString& text, const FloatArrayType& bounds, bool reversed = false);
+
+constexpr size_t k_EntriesPerLine = 40;
+constexpr size_t k_EntriesPerChunk = k_EntriesPerLine * 4096;
+
+/**
+ * @brief Returns an upper bound in bytes for the chunk buffers writeMaterials holds while writing count values
+ * on numThreads threads (0 uses all cores). Each entry takes at most 20 digits, a sign and a separator.
+ * @param count
+ * @param numThreads
+ * @return
+ */
+inline size_t estimateMaterialBufferSize(size_t count, int32_t numThreads)
+{
+  constexpr size_t k_MaxEntryBytes = 22;
+  size_t numChunks = (count + k_EntriesPerChunk - 1) / k_EntriesPerChunk;
+  size_t numBuffers = std::min(numChunks, 2 * SlabWriter::resolveThreadCount(numThreads));
+  return numBuffers * k_EntriesPerChunk * k_MaxEntryBytes;
+}
+
+/**
+ * @brief Streams the values of the matr block, 40 per line and in view order, directly to the file. The values
+ * are formatted in line-aligned chunks on numThreads threads (0 uses all cores) and written in order, so memory
+ * use stays at a few chunks per thread regardless of the grid size. Returns false if a write fails or shouldStop
+ * returned true before a chunk was written.
+ * @param file
+ * @param featureIds
+ * @param view
+ * @param numThreads
+ * @param shouldStop Polled before each chunk is written, may be empty
+ * @return
+ */
+template <class T>
+bool writeMaterials(QFile& file, const T* featureIds, const PermutedGridView& view, int32_t numThreads = 0, const std::function<bool()>& shouldStop = {})
+{
+
+  size_t count = view.size();
+  size_t numChunks = (count + k_EntriesPerChunk - 1) / k_EntriesPerChunk;
+
+  auto formatChunk = [featureIds, count, &view](size_t chunk, std::string& buffer) {
+    size_t begin = chunk * k_EntriesPerChunk;
+    size_t end = std::min(begin + k_EntriesPerChunk, count);
+    size_t i = begin;
+    view.forEach(begin, end, [featureIds, &buffer, &i](size_t sourceIndex) {
+      if(i != 0)
+      {
+        buffer += ((i % k_EntriesPerLine) != 0) ? ' ' : '\n';
+      }
+      NumberFormatter::appendInteger(buffer, featureIds[sourceIndex]);
+      i++;
+    });
+  };
+
+  auto writeChunk = [&file, &shouldStop](size_t, const std::string& buffer) {
+    if(shouldStop && shouldStop())
+    {
+      return false;
+    }
+    return file.write(buffer.data(), static_cast<qint64>(buffer.size())) == static_cast<qint64>(buffer.size());
+  };
+
+  return SlabWriter::write(numChunks, SlabWriter::resolveThreadCount(numThreads), formatChunk, writeChunk);
+}
+
+/**
+ * @brief Streams count values of the matr block in array order. See writeMaterials above.
+ * @param file
+ * @param featureIds
+ * @param count
+ * @param numThreads
+ * @param shouldStop
+ * @return
+ */
+template <class T>
+bool writeMaterials(QFile& file, const T* featureIds, size_t count, int32_t numThreads = 0, const std::function<bool()>& shouldStop = {})
+{
+  PermutedGridView view;
+  view.sourceDims = {count, 1, 1};
+  return writeMaterials(file, featureIds, view, numThreads, shouldStop);
+}
 
 /**
  * @brief Writes a OnScale table file. All elements of featureIds must be >=0. Returns true on success.
- * @param imageGeom
+ * The coordinates and materials are written as seen through the view, which must have the dimensions of geom.
+ * When shouldStop returns true while the materials are written, the partial file is removed and 0 is returned.
+ * @param geom
  * @param phaseNames
  * @param featureIds
  * @param outputPath
  * @param filePrefix
  * @param numKeypoints
+ * @param view
+ * @param numThreads
+ * @param shouldStop
  * @return
  */
 template <class T>
 std::pair<int, QString> write(IGeometryGrid::Pointer geom, const StringDataArray& phaseNames, const DataArray<T>& featureIds, const QString& outputPath, const QString& filePrefix,
-                              const IntVec3Type& numKeypoints)
+                              const IntVec3Type& numKeypoints, const PermutedGridView& view, int32_t numThreads = 0, const std::function<bool()>& shouldStop = {})
 {
   size_t numTuples = phaseNames.getNumberOfTuples();
 
@@ -79,8 +249,6 @@ std::pair<int, QString> write(IGeometryGrid::Pointer geom, const StringDataArray
 
   size_t maxGrainId = static_cast<size_t>(*maxElement);
 
-  size_t totalPoints = geom->getNumberOfElements();
-
   QString masterFilePath = outputPath + QDir::separator() + filePrefix + ".flxtbl";
 
   QFile masterFile(masterFilePath);
@@ -99,32 +267,33 @@ std::pair<int, QString> write(IGeometryGrid::Pointer geom, const StringDataArray
   masterStream << "hedr 0\n";
   masterStream << "info 1\n";
 
-  SizeVec3Type dims = geom->getDimensions();
-
-  ImageGeom::Pointer imageGeomRotated = std::dynamic_pointer_cast<ImageGeom>(geom);
-  RectGridGeom::Pointer rectGridGeomRotated = std::dynamic_pointer_cast<RectGridGeom>(geom);
-  std::pair<int, QString> result;
-  size_t ne_x = dims[0];
-  size_t ne_y = dims[1];
-  size_t ne_z = dims[2];
-  if(imageGeomRotated != nullptr)
+  ImageGeom::Pointer imageGeom = std::dynamic_pointer_cast<ImageGeom>(geom);
+  RectGridGeom::Pointer rectGridGeom = std::dynamic_pointer_cast<RectGridGeom>(geom);
+  size_t ne_x = view.dim(0);
+  size_t ne_y = view.dim(1);
+  size_t ne_z = view.dim(2);
+  const std::array<QString, 3> coordNames = {"xcrd", "ycrd", "zcrd"};
+  if(imageGeom != nullptr)
   {
-    FloatVec3Type spacing = imageGeomRotated->getSpacing();
-    FloatVec3Type origin = imageGeomRotated->getOrigin();
-
-    size_t nnode_x = ne_x + 1;
-    size_t nnode_y = ne_y + 1;
-    size_t nnode_z = ne_z + 1;
+    FloatVec3Type spacing = imageGeom->getSpacing();
+    FloatVec3Type origin = imageGeom->getOrigin();
 
-    writeCoords(masterStream, "xcrd", nnode_x, origin[0], spacing[0]);
-    writeCoords(masterStream, "ycrd", nnode_y, origin[1], spacing[1]);
-    writeCoords(masterStream, "zcrd", nnode_z, origin[2], spacing[2]);
+    for(size_t axis = 0; axis < 3; axis++)
+    {
+      size_t sourceAxis = view.axes[axis];
+      size_t numNodes = view.dim(axis) + 1;
+      // A reversed axis mirrors the node coordinates, so the first node is the negated far end of the source axis
+      float axisOrigin = view.reversed[axis] ? -(origin[sourceAxis] + view.dim(axis) * spacing[sourceAxis]) : origin[sourceAxis];
+      writeCoords(masterStream, coordNames[axis], numNodes, axisOrigin, spacing[sourceAxis]);
+    }
   }
-  else if(rectGridGeomRotated != nullptr)
+  else if(rectGridGeom != nullptr)
   {
-    writeCoords(masterStream, "xcrd", *rectGridGeomRotated->getXBounds());
-    writeCoords(masterStream, "ycrd", *rectGridGeomRotated->getYBounds());
-    writeCoords(masterStream, "zcrd", *rectGridGeomRotated->getZBounds());
+    const std::array<FloatArrayType::Pointer, 3> bounds = {rectGridGeom->getXBounds(), rectGridGeom->getYBounds(), rectGridGeom->getZBounds()};
+    for(size_t axis = 0; axis < 3; axis++)
+    {
+      writeCoords(masterStream, coordNames[axis], *bounds[view.axes[axis]], view.reversed[axis]);
+    }
   }
   else
   {
@@ -162,9 +331,18 @@ std::pair<int, QString> write(IGeometryGrid::Pointer geom, const StringDataArray
   masterStream << "\n";
   masterStream << QString("matr %1\n").arg(ne_x * ne_y * ne_z);
 
-  auto func = [&featureIds](size_t i) { return QString::number(featureIds.at(i)); };
+  masterStream.flush();
 
-  EntriesHelper::writeEntries(masterStream, func, totalPoints, 40);
+  if(!writeMaterials(masterFile, featureIds.getPointer(0), view, numThreads, shouldStop))
+  {
+    if(shouldStop && shouldStop())
+    {
+      masterFile.remove();
+      return {0, QObject::tr("")};
+    }
+    QString ss = QObject::tr("Error writing material table to '%1'").arg(masterFilePath);
+    return {-3, ss};
+  }
 
   return {0, QObject::tr("")};
 }
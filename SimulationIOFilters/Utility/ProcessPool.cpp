@@ -0,0 +1,184 @@
+/* ============================================================================
+ * Copyright (c) 2019-2019 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include "ProcessPool.h"
+
+#include <algorithm>
+#include <memory>
+
+#include <QtCore/QEventLoop>
+#include <QtCore/QTimer>
+
+#include "SimulationIO/SimulationIOFilters/Utility/SlabWriter.hpp"
+
+namespace ProcessPool
+{
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString describe(const Result& result)
+{
+  switch(result.status)
+  {
+  case Status::NotStarted:
+    return QObject::tr("not started");
+  case Status::Succeeded:
+    return QObject::tr("succeeded");
+  case Status::Failed:
+    return QObject::tr("exit code %1").arg(result.exitCode);
+  case Status::FailedToStart:
+    return QObject::tr("failed to start: %1").arg(result.errorString);
+  case Status::Crashed:
+    return QObject::tr("crashed: %1").arg(result.errorString);
+  case Status::Canceled:
+    return QObject::tr("canceled");
+  }
+  return QString();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::vector<Result> run(const std::vector<Job>& jobs, int32_t maxProcesses, const std::function<void(size_t, const QString&)>& reportOutput, const std::function<void(size_t)>& reportProgress,
+                        const std::function<bool()>& shouldStop)
+{
+  std::vector<Result> results(jobs.size());
+  if(jobs.empty() || shouldStop())
+  {
+    return results;
+  }
+
+  const size_t maxRunning = std::min(SlabWriter::resolveThreadCount(maxProcesses), jobs.size());
+  std::vector<std::unique_ptr<QProcess>> processes(jobs.size());
+  size_t nextJob = 0;
+  size_t numRunning = 0;
+  size_t numEnded = 0;
+  bool stopping = false;
+
+  // Every signal is queued so nothing re-enters startJobs(), even when a process fails inside QProcess::start()
+  qRegisterMetaType<QProcess::ExitStatus>("QProcess::ExitStatus");
+  qRegisterMetaType<QProcess::ProcessError>("QProcess::ProcessError");
+  QEventLoop loop;
+
+  std::function<void()> startJobs;
+  auto endJob = [&](size_t job, Status status) {
+    if(results[job].status != Status::NotStarted)
+    {
+      return;
+    }
+    results[job].status = status;
+    numRunning--;
+    numEnded++;
+    reportProgress(numEnded);
+    startJobs();
+    if(numRunning == 0)
+    {
+      loop.quit();
+    }
+  };
+
+  startJobs = [&]() {
+    while(!stopping && numRunning < maxRunning && nextJob < jobs.size())
+    {
+      size_t job = nextJob++;
+      const Job& description = jobs[job];
+      processes[job] = std::make_unique<QProcess>();
+      QProcess* process = processes[job].get();
+      process->setProcessEnvironment(description.environment);
+      process->setWorkingDirectory(description.workingDirectory);
+
+      QObject::connect(process, &QProcess::readyReadStandardOutput, &loop, [&reportOutput, process, job]() { reportOutput(job, QString::fromLocal8Bit(process->readAllStandardOutput())); },
+                       Qt::QueuedConnection);
+      QObject::connect(process, &QProcess::readyReadStandardError, &loop, [&reportOutput, process, job]() { reportOutput(job, QString::fromLocal8Bit(process->readAllStandardError())); },
+                       Qt::QueuedConnection);
+      QObject::connect(process, QOverload<int, QProcess::ExitStatus>::of(&QProcess::finished), &loop,
+                       [&, process, job](int exitCode, QProcess::ExitStatus exitStatus) {
+                         results[job].exitCode = exitCode;
+                         results[job].errorString = process->errorString();
+                         if(stopping && exitStatus == QProcess::CrashExit)
+                         {
+                           endJob(job, Status::Canceled);
+                         }
+                         else if(exitStatus == QProcess::CrashExit)
+                         {
+                           endJob(job, Status::Crashed);
+                         }
+                         else
+                         {
+                           endJob(job, exitCode == 0 ? Status::Succeeded : Status::Failed);
+                         }
+                       },
+                       Qt::QueuedConnection);
+      // A process that fails to start never emits finished()
+      QObject::connect(process, &QProcess::errorOccurred, &loop,
+                       [&, process, job](QProcess::ProcessError error) {
+                         if(error == QProcess::FailedToStart)
+                         {
+                           results[job].errorString = process->errorString();
+                           endJob(job, Status::FailedToStart);
+                         }
+                       },
+                       Qt::QueuedConnection);
+
+      numRunning++;
+      process->start(description.program, description.arguments);
+    }
+  };
+
+  QTimer stopTimer;
+  QObject::connect(&stopTimer, &QTimer::timeout, &loop, [&]() {
+    if(stopping || !shouldStop())
+    {
+      return;
+    }
+    stopping = true;
+    for(auto& process : processes)
+    {
+      if(process && process->state() != QProcess::NotRunning)
+      {
+        process->kill();
+      }
+    }
+  });
+  stopTimer.start(100);
+
+  startJobs();
+  loop.exec();
+  stopTimer.stop();
+
+  // Every started process has ended, so they can be destroyed without waiting
+  processes.clear();
+  return results;
+}
+} // namespace ProcessPool
@@ -0,0 +1,101 @@
+/* ============================================================================
+ * Copyright (c) 2019-2019 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include <QtCore/QProcess>
+#include <QtCore/QProcessEnvironment>
+#include <QtCore/QString>
+#include <QtCore/QStringList>
+
+namespace ProcessPool
+{
+/**
+ * @brief One external program to run
+ */
+struct Job
+{
+  QString program;
+  QStringList arguments;
+  QString workingDirectory;
+  QProcessEnvironment environment = QProcessEnvironment::systemEnvironment();
+};
+
+/**
+ * @brief How a job ended
+ */
+enum class Status
+{
+  NotStarted,    // The pool was stopped before the job was started
+  Succeeded,     // The program exited normally with exit code 0
+  Failed,        // The program exited normally with a non zero exit code
+  FailedToStart, // The program could not be started
+  Crashed,       // The program crashed or was killed by someone else
+  Canceled       // The program was killed because the pool was stopped
+};
+
+struct Result
+{
+  Status status = Status::NotStarted;
+  int exitCode = 0;
+  QString errorString;
+};
+
+/**
+ * @brief Returns a short human readable description of result, e.g. "exit code 3"
+ * @param result
+ * @return
+ */
+QString describe(const Result& result);
+
+/**
+ * @brief Runs every job as a separate process with at most maxProcesses (0 uses all cores) running at once, starting
+ * them in index order. The calling thread runs a local event loop until every started job has ended, so all callbacks
+ * are made on the calling thread: reportOutput(job, text) with whatever the job wrote to its standard output or error,
+ * reportProgress(numEnded) after each job ends, and shouldStop() every 100 ms. Once shouldStop() returns true no
+ * further jobs are started and the running ones are killed.
+ * @param jobs
+ * @param maxProcesses
+ * @param reportOutput
+ * @param reportProgress
+ * @param shouldStop
+ * @return The result of each job
+ */
+std::vector<Result> run(const std::vector<Job>& jobs, int32_t maxProcesses, const std::function<void(size_t, const QString&)>& reportOutput, const std::function<void(size_t)>& reportProgress,
+                        const std::function<bool()>& shouldStop);
+} // namespace ProcessPool
@@ -0,0 +1,174 @@
+/* ============================================================================
+ * Copyright (c) 2019-2019 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace SlabWriter
+{
+/**
+ * @brief Returns the number of threads to use for a requested thread count, where 0 or less
+ * means "use every available core".
+ * @param requestedThreads
+ * @return
+ */
+inline size_t resolveThreadCount(int32_t requestedThreads)
+{
+  if(requestedThreads > 0)
+  {
+    return static_cast<size_t>(requestedThreads);
+  }
+  return std::max<size_t>(std::thread::hardware_concurrency(), 1);
+}
+
+/**
+ * @brief Generates the text of numSlabs independent slabs and hands it to writeSlab in slab order.
+ *
+ * formatSlab(slab, buffer) appends the text of one slab to an empty buffer and is called concurrently
+ * from numThreads worker threads, each filling its own buffer. writeSlab(slab, buffer) is only ever
+ * called from the calling thread, strictly in order, so it may write to a QFile and report progress.
+ * At most two slabs per worker are held in memory at once. With numThreads <= 1 everything runs on
+ * the calling thread.
+ * @param numSlabs
+ * @param numThreads
+ * @param formatSlab
+ * @param writeSlab Returns false to stop (e.g. canceled or a write error)
+ * @return false if writeSlab stopped the pipeline
+ */
+template <typename FormatFunc, typename WriteFunc>
+bool write(size_t numSlabs, size_t numThreads, FormatFunc&& formatSlab, WriteFunc&& writeSlab)
+{
+  numThreads = std::min(numThreads, numSlabs);
+  if(numThreads <= 1)
+  {
+    std::string buffer;
+    for(size_t slab = 0; slab < numSlabs; slab++)
+    {
+      buffer.clear();
+      formatSlab(slab, buffer);
+      if(!writeSlab(slab, static_cast<const std::string&>(buffer)))
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  const size_t numBuffers = numThreads * 2;
+  constexpr size_t k_Empty = static_cast<size_t>(-1);
+
+  std::vector<std::string> buffers(numBuffers);
+  std::vector<size_t> readySlab(numBuffers, k_Empty);
+  std::mutex mutex;
+  std::condition_variable condition;
+  size_t nextSlab = 0;
+  size_t writtenSlabs = 0;
+  bool stop = false;
+
+  auto worker = [&]() {
+    while(true)
+    {
+      size_t slab = 0;
+      {
+        std::unique_lock<std::mutex> lock(mutex);
+        if(stop || nextSlab >= numSlabs)
+        {
+          return;
+        }
+        slab = nextSlab++;
+        // The buffer is free once the slab that last used it has been written
+        condition.wait(lock, [&] { return stop || slab < writtenSlabs + numBuffers; });
+        if(stop)
+        {
+          return;
+        }
+      }
+
+      std::string& buffer = buffers[slab % numBuffers];
+      buffer.clear();
+      formatSlab(slab, buffer);
+
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        readySlab[slab % numBuffers] = slab;
+      }
+      condition.notify_all();
+    }
+  };
+
+  std::vector<std::thread> workers;
+  workers.reserve(numThreads);
+  for(size_t i = 0; i < numThreads; i++)
+  {
+    workers.emplace_back(worker);
+  }
+
+  bool success = true;
+  for(size_t slab = 0; slab < numSlabs; slab++)
+  {
+    size_t index = slab % numBuffers;
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      condition.wait(lock, [&] { return readySlab[index] == slab; });
+    }
+
+    success = writeSlab(slab, static_cast<const std::string&>(buffers[index]));
+
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      readySlab[index] = k_Empty;
+      writtenSlabs++;
+      stop = !success;
+    }
+    condition.notify_all();
+
+    if(!success)
+    {
+      break;
+    }
+  }
+
+  for(auto& thread : workers)
+  {
+    thread.join();
+  }
+  return success;
+}
+} // namespace SlabWriter
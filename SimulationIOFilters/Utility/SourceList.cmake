@@ -1,17 +1,50 @@
 set(${PLUGIN_NAME}_UTILITY_HDRS
+  ${${PLUGIN_NAME}_SOURCE_DIR}/${PLUGIN_NAME}Filters/Utility/AbaqusBulkDataReader.h
+  ${${PLUGIN_NAME}_SOURCE_DIR}/${PLUGIN_NAME}Filters/Utility/AbaqusDatReader.h
+  ${${PLUGIN_NAME}_SOURCE_DIR}/${PLUGIN_NAME}Filters/Utility/AbaqusFilReader.h
+  ${${PLUGIN_NAME}_SOURCE_DIR}/${PLUGIN_NAME}Filters/Utility/AbaqusMesh.h
+  ${${PLUGIN_NAME}_SOURCE_DIR}/${PLUGIN_NAME}Filters/Utility/AbaqusResultCache.h
   ${${PLUGIN_NAME}_SOURCE_DIR}/${PLUGIN_NAME}Filters/Utility/AbaqusFileWriter.h
+  ${${PLUGIN_NAME}_SOURCE_DIR}/${PLUGIN_NAME}Filters/Utility/DeformPointTrackIndex.h
   ${${PLUGIN_NAME}_SOURCE_DIR}/${PLUGIN_NAME}Filters/Utility/BsamFileWriter.h
   ${${PLUGIN_NAME}_SOURCE_DIR}/${PLUGIN_NAME}Filters/Utility/OnScaleTableFileWriter.h
+  ${${PLUGIN_NAME}_SOURCE_DIR}/${PLUGIN_NAME}Filters/Utility/ProcessPool.h
+  ${${PLUGIN_NAME}_SOURCE_DIR}/${PLUGIN_NAME}Filters/Utility/TetGenFileReader.h
+  ${${PLUGIN_NAME}_SOURCE_DIR}/${PLUGIN_NAME}Filters/Utility/TetGenMesher.h
+  ${${PLUGIN_NAME}_SOURCE_DIR}/${PLUGIN_NAME}Filters/Utility/DamaskFileWriter.h
+  ${${PLUGIN_NAME}_SOURCE_DIR}/${PLUGIN_NAME}Filters/Utility/FeatureAggregator.h
+  ${${PLUGIN_NAME}_SOURCE_DIR}/${PLUGIN_NAME}Filters/Utility/FeatureStlWriter.h
+  ${${PLUGIN_NAME}_SOURCE_DIR}/${PLUGIN_NAME}Filters/Utility/GmshMesher.h
   ${${PLUGIN_NAME}_SOURCE_DIR}/${PLUGIN_NAME}Filters/Utility/EntriesHelper.h
+  ${${PLUGIN_NAME}_SOURCE_DIR}/${PLUGIN_NAME}Filters/Utility/NetgenVolMerger.h
   ${${PLUGIN_NAME}_SOURCE_DIR}/${PLUGIN_NAME}Filters/Utility/DeformDataParser.hpp
+  ${${PLUGIN_NAME}_SOURCE_DIR}/${PLUGIN_NAME}Filters/Utility/DeformColumnPlan.hpp
   ${${PLUGIN_NAME}_SOURCE_DIR}/${PLUGIN_NAME}Filters/Utility/OnScaleTableFileUtils.hpp
+  ${${PLUGIN_NAME}_SOURCE_DIR}/${PLUGIN_NAME}Filters/Utility/NumberFormatter.hpp
+  ${${PLUGIN_NAME}_SOURCE_DIR}/${PLUGIN_NAME}Filters/Utility/SlabWriter.hpp
+  ${${PLUGIN_NAME}_SOURCE_DIR}/${PLUGIN_NAME}Filters/Utility/TaskPool.hpp
+  ${${PLUGIN_NAME}_SOURCE_DIR}/${PLUGIN_NAME}Filters/Utility/MappedTextReader.hpp
 )
 
 set(${PLUGIN_NAME}_UTILITY_SRCS
+  ${${PLUGIN_NAME}_SOURCE_DIR}/${PLUGIN_NAME}Filters/Utility/AbaqusBulkDataReader.cpp
+  ${${PLUGIN_NAME}_SOURCE_DIR}/${PLUGIN_NAME}Filters/Utility/AbaqusDatReader.cpp
+  ${${PLUGIN_NAME}_SOURCE_DIR}/${PLUGIN_NAME}Filters/Utility/AbaqusFilReader.cpp
+  ${${PLUGIN_NAME}_SOURCE_DIR}/${PLUGIN_NAME}Filters/Utility/AbaqusMesh.cpp
+  ${${PLUGIN_NAME}_SOURCE_DIR}/${PLUGIN_NAME}Filters/Utility/AbaqusResultCache.cpp
   ${${PLUGIN_NAME}_SOURCE_DIR}/${PLUGIN_NAME}Filters/Utility/AbaqusFileWriter.cpp
   ${${PLUGIN_NAME}_SOURCE_DIR}/${PLUGIN_NAME}Filters/Utility/BsamFileWriter.cpp
+  ${${PLUGIN_NAME}_SOURCE_DIR}/${PLUGIN_NAME}Filters/Utility/DeformPointTrackIndex.cpp
   ${${PLUGIN_NAME}_SOURCE_DIR}/${PLUGIN_NAME}Filters/Utility/OnScaleTableFileWriter.cpp
+  ${${PLUGIN_NAME}_SOURCE_DIR}/${PLUGIN_NAME}Filters/Utility/ProcessPool.cpp
+  ${${PLUGIN_NAME}_SOURCE_DIR}/${PLUGIN_NAME}Filters/Utility/TetGenFileReader.cpp
+  ${${PLUGIN_NAME}_SOURCE_DIR}/${PLUGIN_NAME}Filters/Utility/TetGenMesher.cpp
+  ${${PLUGIN_NAME}_SOURCE_DIR}/${PLUGIN_NAME}Filters/Utility/DamaskFileWriter.cpp
+  ${${PLUGIN_NAME}_SOURCE_DIR}/${PLUGIN_NAME}Filters/Utility/FeatureAggregator.cpp
+  ${${PLUGIN_NAME}_SOURCE_DIR}/${PLUGIN_NAME}Filters/Utility/FeatureStlWriter.cpp
+  ${${PLUGIN_NAME}_SOURCE_DIR}/${PLUGIN_NAME}Filters/Utility/GmshMesher.cpp
   ${${PLUGIN_NAME}_SOURCE_DIR}/${PLUGIN_NAME}Filters/Utility/EntriesHelper.cpp
+  ${${PLUGIN_NAME}_SOURCE_DIR}/${PLUGIN_NAME}Filters/Utility/NetgenVolMerger.cpp
 )
 
 cmp_IDE_SOURCE_PROPERTIES("${PLUGIN_NAME}Filters/Utility" "${${PLUGIN_NAME}_UTILITY_HDRS}" "${${PLUGIN_NAME}_UTILITY_SRCS}" "0")
@@ -0,0 +1,150 @@
+/* ============================================================================
+ * Copyright (c) 2019-2019 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace TaskPool
+{
+/**
+ * @brief Runs numTasks independent tasks on at most numWorkers threads while keeping the summed memory cost of the
+ * running tasks within memoryBudget bytes (0 means no limit).
+ *
+ * Tasks are started in index order. A task whose cost does not fit next to the running tasks waits until enough of
+ * them have finished; a task that exceeds the whole budget runs on its own. runTask(task) is called from the worker
+ * threads. reportProgress(numFinished) and shouldStop() are only called from the calling thread, which polls
+ * shouldStop() while waiting; once it returns true no further tasks are started and the running ones are waited for.
+ * @param numTasks
+ * @param numWorkers
+ * @param memoryBudget
+ * @param taskCosts Memory cost in bytes of each task
+ * @param runTask
+ * @param reportProgress
+ * @param shouldStop
+ * @return The number of tasks that were run
+ */
+template <typename TaskFunc, typename ProgressFunc, typename StopFunc>
+size_t run(size_t numTasks, size_t numWorkers, size_t memoryBudget, const std::vector<size_t>& taskCosts, TaskFunc&& runTask, ProgressFunc&& reportProgress, StopFunc&& shouldStop)
+{
+  numWorkers = std::max<size_t>(std::min(numWorkers, numTasks), 1);
+
+  std::mutex mutex;
+  std::condition_variable workerCondition;
+  std::condition_variable callerCondition;
+  size_t nextTask = 0;
+  size_t runningTasks = 0;
+  size_t finishedTasks = 0;
+  size_t memoryInUse = 0;
+  bool stop = false;
+
+  auto fitsBudget = [&](size_t task) { return memoryBudget == 0 || runningTasks == 0 || memoryInUse + taskCosts[task] <= memoryBudget; };
+
+  auto worker = [&]() {
+    std::unique_lock<std::mutex> lock(mutex);
+    while(true)
+    {
+      workerCondition.wait(lock, [&] { return stop || nextTask >= numTasks || fitsBudget(nextTask); });
+      if(stop || nextTask >= numTasks)
+      {
+        return;
+      }
+      size_t task = nextTask++;
+      runningTasks++;
+      memoryInUse += taskCosts[task];
+
+      lock.unlock();
+      runTask(task);
+      lock.lock();
+
+      runningTasks--;
+      memoryInUse -= taskCosts[task];
+      finishedTasks++;
+      workerCondition.notify_all();
+      callerCondition.notify_one();
+    }
+  };
+
+  std::vector<std::thread> workers;
+  workers.reserve(numWorkers);
+  for(size_t i = 0; i < numWorkers; i++)
+  {
+    workers.emplace_back(worker);
+  }
+
+  size_t reportedTasks = 0;
+  std::unique_lock<std::mutex> lock(mutex);
+  while(true)
+  {
+    bool done = (stop || nextTask >= numTasks) && runningTasks == 0;
+    if(finishedTasks != reportedTasks)
+    {
+      reportedTasks = finishedTasks;
+      lock.unlock();
+      reportProgress(reportedTasks);
+      lock.lock();
+    }
+    if(done)
+    {
+      break;
+    }
+    if(!stop)
+    {
+      lock.unlock();
+      bool stopRequested = shouldStop();
+      lock.lock();
+      if(stopRequested)
+      {
+        stop = true;
+        workerCondition.notify_all();
+      }
+    }
+    callerCondition.wait_for(lock, std::chrono::milliseconds(100), [&] { return finishedTasks != reportedTasks; });
+  }
+  size_t startedTasks = nextTask;
+  lock.unlock();
+
+  for(auto& thread : workers)
+  {
+    thread.join();
+  }
+  return startedTasks;
+}
+} // namespace TaskPool
@@ -0,0 +1,409 @@
+/* ============================================================================
+ * Copyright (c) 2019-2019 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include "TetGenFileReader.h"
+
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <string_view>
+#include <vector>
+
+#include "SimulationIO/SimulationIOFilters/Utility/SlabWriter.hpp"
+#include "SimulationIO/SimulationIOFilters/Utility/TaskPool.hpp"
+
+namespace
+{
+constexpr size_t k_ChunkSize = 4 * 1024 * 1024;
+
+/**
+ * @brief What one worker found in its chunk. errorOffset is the offset in the file of the first line that could not
+ * be parsed; if that line names a feature that does not exist, invalidFeature is set and featureId is that feature.
+ */
+struct ChunkResult
+{
+  size_t numLines = 0;
+  size_t errorOffset = std::string_view::npos;
+  bool invalidFeature = false;
+  int64_t featureId = 0;
+};
+
+/**
+ * @brief Splits text from dataOffset to its end into chunks of about k_ChunkSize bytes that end at a line feed
+ * @param text
+ * @param dataOffset
+ * @return
+ */
+std::vector<std::string_view> splitChunks(std::string_view text, size_t dataOffset)
+{
+  std::vector<std::string_view> chunks;
+  size_t begin = dataOffset;
+  while(begin < text.size())
+  {
+    size_t end = text.size();
+    if(text.size() - begin > k_ChunkSize)
+    {
+      end = text.find('\n', begin + k_ChunkSize);
+      end = (end == std::string_view::npos ? text.size() : end + 1);
+    }
+    chunks.push_back(text.substr(begin, end - begin));
+    begin = end;
+  }
+  return chunks;
+}
+
+/**
+ * @brief Parses a 'firstNumber' based index and checks it against count
+ * @param token
+ * @param firstNumber
+ * @param count
+ * @param index
+ * @return
+ */
+bool parseIndex(std::string_view token, int64_t firstNumber, size_t count, size_t& index)
+{
+  int64_t value = 0;
+  if(!MappedTextReader::parseInteger(token, value) || value < firstNumber || static_cast<uint64_t>(value - firstNumber) >= count)
+  {
+    return false;
+  }
+  index = static_cast<size_t>(value - firstNumber);
+  return true;
+}
+
+/**
+ * @brief Parses a region attribute. TetGen writes them with %g, so whole numbers normally have no decimals.
+ * @param token
+ * @param value
+ * @return
+ */
+bool parseAttribute(std::string_view token, int64_t& value)
+{
+  if(MappedTextReader::parseInteger(token, value))
+  {
+    return true;
+  }
+  double number = 0.0;
+  const char* end = token.data() + token.size();
+  std::from_chars_result result = std::from_chars(token.data(), end, number);
+  if(token.empty() || result.ec != std::errc() || result.ptr != end)
+  {
+    return false;
+  }
+  value = std::llround(number);
+  return true;
+}
+
+/**
+ * @brief Parses the 'index x y z ...' lines of a chunk of a .node file into vertices
+ * @param chunk
+ * @param fileBegin
+ * @param firstNumber
+ * @param numVertices
+ * @param vertices
+ * @param result
+ */
+void parseNodeChunk(std::string_view chunk, const char* fileBegin, int64_t firstNumber, size_t numVertices, float* vertices, ChunkResult& result)
+{
+  MappedTextReader::LineReader reader(chunk);
+  while(!reader.atEnd())
+  {
+    std::string_view line = reader.readLine();
+    const size_t lineOffset = static_cast<size_t>(line.data() - fileBegin);
+    std::string_view token = MappedTextReader::nextToken(line);
+    if(token.empty() || token.front() == '#')
+    {
+      continue;
+    }
+
+    size_t vertex = 0;
+    if(!parseIndex(token, firstNumber, numVertices, vertex))
+    {
+      result.errorOffset = lineOffset;
+      return;
+    }
+    for(size_t c = 0; c < 3; c++)
+    {
+      if(!MappedTextReader::parseFloat(MappedTextReader::nextToken(line), vertices[vertex * 3 + c]))
+      {
+        result.errorOffset = lineOffset;
+        return;
+      }
+    }
+    result.numLines++;
+  }
+}
+
+/**
+ * @brief Parses the 'index n1 ... nk attribute ...' lines of a chunk of a .ele file. The first four nodes are the
+ * corners of the tetrahedron and the first attribute is its region, i.e. its feature id.
+ * @param chunk
+ * @param fileBegin
+ * @param firstNumber
+ * @param numTets
+ * @param nodesPerTet
+ * @param nodeFirstNumber
+ * @param numVertices
+ * @param tets
+ * @param featureData
+ * @param result
+ */
+void parseEleChunk(std::string_view chunk, const char* fileBegin, int64_t firstNumber, size_t numTets, size_t nodesPerTet, int64_t nodeFirstNumber, size_t numVertices, MeshIndexType* tets,
+                   const TetGenFileReader::FeatureData& featureData, ChunkResult& result)
+{
+  MappedTextReader::LineReader reader(chunk);
+  while(!reader.atEnd())
+  {
+    std::string_view line = reader.readLine();
+    const size_t lineOffset = static_cast<size_t>(line.data() - fileBegin);
+    std::string_view token = MappedTextReader::nextToken(line);
+    if(token.empty() || token.front() == '#')
+    {
+      continue;
+    }
+
+    size_t tet = 0;
+    if(!parseIndex(token, firstNumber, numTets, tet))
+    {
+      result.errorOffset = lineOffset;
+      return;
+    }
+    for(size_t n = 0; n < nodesPerTet; n++)
+    {
+      size_t node = 0;
+      if(!parseIndex(MappedTextReader::nextToken(line), nodeFirstNumber, numVertices, node))
+      {
+        result.errorOffset = lineOffset;
+        return;
+      }
+      if(n < 4)
+      {
+        tets[tet * 4 + n] = static_cast<MeshIndexType>(node);
+      }
+    }
+
+    int64_t featureId = 0;
+    if(!parseAttribute(MappedTextReader::nextToken(line), featureId))
+    {
+      result.errorOffset = lineOffset;
+      return;
+    }
+    if(!featureData.assign(tet, featureId))
+    {
+      result.errorOffset = lineOffset;
+      result.invalidFeature = true;
+      result.featureId = featureId;
+      return;
+    }
+    result.numLines++;
+  }
+}
+
+/**
+ * @brief Returns the 1-based number of the line starting at offset
+ * @param text
+ * @param offset
+ * @return
+ */
+size_t lineNumber(std::string_view text, size_t offset)
+{
+  return 1 + static_cast<size_t>(std::count(text.begin(), text.begin() + static_cast<std::ptrdiff_t>(offset), '\n'));
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool TetGenFileReader::open(AbstractFilter* filter, const QString& nodeFile, const QString& eleFile)
+{
+  if(!readHeader(filter, eleFile, m_EleFile, m_EleHeader) || !readHeader(filter, nodeFile, m_NodeFile, m_NodeHeader))
+  {
+    return false;
+  }
+
+  // .node: <# of points> <dimension (3)> <# of attributes> <boundary markers (0 or 1)>
+  if(m_NodeHeader.valuesPerLine != 3)
+  {
+    filter->setErrorCondition(-4019, QObject::tr("'%1' holds %2 dimensional points instead of 3 dimensional ones").arg(nodeFile).arg(m_NodeHeader.valuesPerLine));
+    return false;
+  }
+  // .ele: <# of tetrahedra> <nodes per tet. (4 or 10)> <region attribute (0 or 1)>
+  if(m_EleHeader.valuesPerLine != 4 && m_EleHeader.valuesPerLine != 10)
+  {
+    filter->setErrorCondition(-4019, QObject::tr("'%1' holds elements with %2 nodes instead of tetrahedra").arg(eleFile).arg(m_EleHeader.valuesPerLine));
+    return false;
+  }
+  if(m_EleHeader.numAttributes < 1)
+  {
+    filter->setErrorCondition(-4019, QObject::tr("'%1' holds no region attributes, so its tetrahedra cannot be assigned to features").arg(eleFile));
+    return false;
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t TetGenFileReader::getNumVertices() const
+{
+  return m_NodeHeader.count;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t TetGenFileReader::getNumTets() const
+{
+  return m_EleHeader.count;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool TetGenFileReader::readHeader(AbstractFilter* filter, const QString& filePath, MappedTextReader::MappedFile& file, Header& header)
+{
+  header = Header();
+  header.filePath = filePath;
+  if(!file.open(filePath))
+  {
+    QString ss = QObject::tr("Input file could not be opened: %1").arg(filePath);
+    filter->setErrorCondition(-100, ss);
+    return false;
+  }
+
+  // The first line that is not a comment is the header; the first number of the line after it tells whether the
+  // file is numbered from 0 or 1
+  MappedTextReader::LineReader reader(file.text());
+  std::vector<std::string_view> tokens;
+  while(!reader.atEnd() && (MappedTextReader::tokenize(reader.readLine(), tokens) == 0 || tokens.front().front() == '#'))
+  {
+    tokens.clear();
+  }
+  bool valid = tokens.size() >= 3 && MappedTextReader::parseInteger(tokens[0], header.count) && MappedTextReader::parseInteger(tokens[1], header.valuesPerLine) &&
+               MappedTextReader::parseInteger(tokens[2], header.numAttributes);
+  header.dataOffset = reader.pos();
+
+  while(valid && header.count > 0 && !reader.atEnd())
+  {
+    std::string_view line = reader.readLine();
+    std::string_view token = MappedTextReader::nextToken(line);
+    if(!token.empty() && token.front() != '#')
+    {
+      valid = MappedTextReader::parseInteger(token, header.firstNumber);
+      break;
+    }
+  }
+
+  if(!valid)
+  {
+    filter->setErrorCondition(-4019, QObject::tr("Invalid TetGen header in '%1'").arg(filePath));
+    return false;
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool TetGenFileReader::read(AbstractFilter* filter, float* vertices, MeshIndexType* tets, const FeatureData& featureData, int32_t numThreads)
+{
+  const std::string_view nodeText = m_NodeFile.text();
+  const std::string_view eleText = m_EleFile.text();
+
+  // The chunks of both files go to the same workers, so the two files are parsed at the same time
+  std::vector<std::string_view> chunks = splitChunks(nodeText, m_NodeHeader.dataOffset);
+  const size_t numNodeChunks = chunks.size();
+  std::vector<std::string_view> eleChunks = splitChunks(eleText, m_EleHeader.dataOffset);
+  chunks.insert(chunks.end(), eleChunks.begin(), eleChunks.end());
+
+  std::vector<ChunkResult> results(chunks.size());
+  auto parseTask = [&](size_t chunk) {
+    if(chunk < numNodeChunks)
+    {
+      parseNodeChunk(chunks[chunk], nodeText.data(), m_NodeHeader.firstNumber, m_NodeHeader.count, vertices, results[chunk]);
+    }
+    else
+    {
+      parseEleChunk(chunks[chunk], eleText.data(), m_EleHeader.firstNumber, m_EleHeader.count, m_EleHeader.valuesPerLine, m_NodeHeader.firstNumber, m_NodeHeader.count, tets, featureData,
+                    results[chunk]);
+    }
+  };
+  int32_t lastPercent = -1;
+  auto reportProgress = [filter, &chunks, &lastPercent](size_t numFinished) {
+    int32_t percent = static_cast<int32_t>(numFinished * 100 / chunks.size());
+    if(percent != lastPercent)
+    {
+      lastPercent = percent;
+      filter->notifyStatusMessage(QObject::tr("Reading TetGen mesh: %1%").arg(percent));
+    }
+  };
+  TaskPool::run(chunks.size(), SlabWriter::resolveThreadCount(numThreads), 0, std::vector<size_t>(chunks.size(), 0), parseTask, reportProgress, [filter]() { return filter->getCancel(); });
+
+  if(filter->getCancel())
+  {
+    return false;
+  }
+
+  size_t numNodeLines = 0;
+  size_t numEleLines = 0;
+  for(size_t chunk = 0; chunk < chunks.size(); chunk++)
+  {
+    const bool isNodeChunk = chunk < numNodeChunks;
+    const ChunkResult& result = results[chunk];
+    if(result.errorOffset != std::string_view::npos)
+    {
+      const Header& header = isNodeChunk ? m_NodeHeader : m_EleHeader;
+      size_t line = lineNumber(isNodeChunk ? nodeText : eleText, result.errorOffset);
+      if(result.invalidFeature)
+      {
+        filter->setErrorCondition(-4021, QObject::tr("The tetrahedron on line %1 of '%2' belongs to feature %3, which does not exist").arg(line).arg(header.filePath).arg(result.featureId));
+      }
+      else
+      {
+        filter->setErrorCondition(-4020, QObject::tr("Invalid or out of range values on line %1 of '%2'").arg(line).arg(header.filePath));
+      }
+      return false;
+    }
+    (isNodeChunk ? numNodeLines : numEleLines) += result.numLines;
+  }
+
+  if(numNodeLines != m_NodeHeader.count || numEleLines != m_EleHeader.count)
+  {
+    const Header& header = numNodeLines != m_NodeHeader.count ? m_NodeHeader : m_EleHeader;
+    size_t numLines = numNodeLines != m_NodeHeader.count ? numNodeLines : numEleLines;
+    filter->setErrorCondition(-4020, QObject::tr("'%1' holds %2 lines instead of the %3 its header announces").arg(header.filePath).arg(numLines).arg(header.count));
+    return false;
+  }
+  return true;
+}
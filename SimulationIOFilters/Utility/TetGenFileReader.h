@@ -0,0 +1,149 @@
+/* ============================================================================
+ * Copyright (c) 2019-2019 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+
+#include <QtCore/QString>
+
+#include "SIMPLib/Filtering/AbstractFilter.h"
+#include "SIMPLib/Geometry/TetrahedralGeom.h"
+
+#include "SimulationIO/SimulationIOFilters/Utility/MappedTextReader.hpp"
+
+/**
+ * @brief Reads the .node and .ele files the tetgen executable writes. Both files are memory mapped, split into
+ * newline aligned chunks and parsed concurrently by worker threads straight into the vertex and tetrahedron lists and
+ * the per tetrahedron feature arrays. Every line starts with its own index, so a chunk knows where its lines go
+ * without counting the lines before it.
+ */
+class TetGenFileReader
+{
+public:
+  /**
+   * @brief Where the per tetrahedron feature data goes. The region attribute of a tetrahedron is the id of its
+   * feature, whose phase and Euler angles are copied to the tetrahedron.
+   */
+  struct FeatureData
+  {
+    const int32_t* featurePhases = nullptr;
+    const float* featureEulerAngles = nullptr;
+    size_t numFeatures = 0;
+    int32_t* featureIds = nullptr;
+    int32_t* phases = nullptr;
+    float* eulerAngles = nullptr;
+
+    /**
+     * @brief Assigns feature featureId to tetrahedron tet. Returns false if there is no such feature.
+     * @param tet
+     * @param featureId
+     * @return
+     */
+    bool assign(size_t tet, int64_t featureId) const
+    {
+      if(featureId < 0 || static_cast<size_t>(featureId) >= numFeatures)
+      {
+        return false;
+      }
+      featureIds[tet] = static_cast<int32_t>(featureId);
+      phases[tet] = featurePhases[featureId];
+      std::copy(featureEulerAngles + featureId * 3, featureEulerAngles + featureId * 3 + 3, eulerAngles + tet * 3);
+      return true;
+    }
+  };
+
+  TetGenFileReader() = default;
+  ~TetGenFileReader() = default;
+
+  TetGenFileReader(const TetGenFileReader&) = delete;
+  TetGenFileReader(TetGenFileReader&&) = delete;
+  TetGenFileReader& operator=(const TetGenFileReader&) = delete;
+  TetGenFileReader& operator=(TetGenFileReader&&) = delete;
+
+  /**
+   * @brief Maps both files and reads their headers. Errors are reported through filter.
+   * @param filter
+   * @param nodeFile
+   * @param eleFile
+   * @return
+   */
+  bool open(AbstractFilter* filter, const QString& nodeFile, const QString& eleFile);
+
+  /**
+   * @brief Returns the number of points in the .node file
+   * @return
+   */
+  size_t getNumVertices() const;
+
+  /**
+   * @brief Returns the number of tetrahedra in the .ele file
+   * @return
+   */
+  size_t getNumTets() const;
+
+  /**
+   * @brief Parses both files on numThreads threads (0 uses all cores). vertices must hold getNumVertices() points,
+   * tets and the arrays of featureData getNumTets() tetrahedra. Errors are reported through filter.
+   * @param filter
+   * @param vertices
+   * @param tets
+   * @param featureData
+   * @param numThreads
+   * @return false if a line could not be parsed, lines were missing or the filter was canceled
+   */
+  bool read(AbstractFilter* filter, float* vertices, MeshIndexType* tets, const FeatureData& featureData, int32_t numThreads = 0);
+
+private:
+  /**
+   * @brief What the header of a file and its first data line say about the rest of it
+   */
+  struct Header
+  {
+    QString filePath;
+    size_t count = 0;
+    size_t valuesPerLine = 0;
+    size_t numAttributes = 0;
+    int64_t firstNumber = 0;
+    size_t dataOffset = 0;
+  };
+
+  bool readHeader(AbstractFilter* filter, const QString& filePath, MappedTextReader::MappedFile& file, Header& header);
+
+  MappedTextReader::MappedFile m_NodeFile;
+  MappedTextReader::MappedFile m_EleFile;
+  Header m_NodeHeader;
+  Header m_EleHeader;
+};
@@ -0,0 +1,212 @@
+/* ============================================================================
+ * Copyright (c) 2019-2019 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include "TetGenMesher.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include <QtCore/QByteArray>
+
+#ifdef SimulationIO_USE_TETGEN_LIBRARY
+#ifndef TETLIBRARY
+#define TETLIBRARY
+#endif
+#include <tetgen.h>
+#endif
+
+#ifdef SimulationIO_USE_TETGEN_LIBRARY
+namespace
+{
+/**
+ * @brief Returns a description of the code TetGen throws when it gives up
+ * @param code
+ * @return
+ */
+QString describeTetGenError(int code)
+{
+  switch(code)
+  {
+  case 1:
+    return QObject::tr("out of memory");
+  case 2:
+    return QObject::tr("internal error");
+  case 3:
+    return QObject::tr("the surface mesh intersects itself");
+  case 4:
+    return QObject::tr("a feature of the surface mesh is too small");
+  case 5:
+    return QObject::tr("two facets of the surface mesh are too close together");
+  case 10:
+    return QObject::tr("invalid input");
+  default:
+    return QObject::tr("error code %1").arg(code);
+  }
+}
+} // namespace
+#endif
+
+namespace TetGenMesher
+{
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool isAvailable()
+{
+#ifdef SimulationIO_USE_TETGEN_LIBRARY
+  return true;
+#else
+  return false;
+#endif
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool tetrahedralize(AbstractFilter* filter, TriangleGeom& surfaceMesh, const std::vector<float>& holes, const std::vector<float>& regions, const QString& switches, TetrahedralGeom& tetGeom,
+                    AttributeMatrix& vertexAttrMat, AttributeMatrix& cellAttrMat, std::vector<int32_t>& tetRegions)
+{
+#ifdef SimulationIO_USE_TETGEN_LIBRARY
+  const MeshIndexType numVerts = surfaceMesh.getNumberOfVertices();
+  const MeshIndexType numTris = surfaceMesh.getNumberOfTris();
+  if(numVerts > static_cast<MeshIndexType>(std::numeric_limits<int>::max()) || numTris > static_cast<MeshIndexType>(std::numeric_limits<int>::max()))
+  {
+    filter->setErrorCondition(-4018, QObject::tr("The surface mesh has too many vertices or triangles for TetGen (%1 and %2)").arg(numVerts).arg(numTris));
+    return false;
+  }
+
+  // tetgenio frees every list it holds, so they are allocated with new[] as TetGen expects
+  tetgenio in;
+  tetgenio out;
+  in.firstnumber = 0;
+
+  const float* vertices = surfaceMesh.getVertexPointer(0);
+  in.numberofpoints = static_cast<int>(numVerts);
+  in.pointlist = new REAL[numVerts * 3];
+  std::copy(vertices, vertices + numVerts * 3, in.pointlist);
+
+  const MeshIndexType* triangles = surfaceMesh.getTriPointer(0);
+  in.numberoffacets = static_cast<int>(numTris);
+  in.facetlist = new tetgenio::facet[numTris];
+  for(MeshIndexType i = 0; i < numTris; i++)
+  {
+    tetgenio::facet& facet = in.facetlist[i];
+    tetgenio::init(&facet);
+    facet.numberofpolygons = 1;
+    facet.polygonlist = new tetgenio::polygon[1];
+    tetgenio::polygon& polygon = facet.polygonlist[0];
+    tetgenio::init(&polygon);
+    polygon.numberofvertices = 3;
+    polygon.vertexlist = new int[3];
+    for(size_t j = 0; j < 3; j++)
+    {
+      polygon.vertexlist[j] = static_cast<int>(triangles[i * 3 + j]);
+    }
+  }
+
+  in.numberofholes = static_cast<int>(holes.size() / 3);
+  if(in.numberofholes > 0)
+  {
+    in.holelist = new REAL[holes.size()];
+    std::copy(holes.begin(), holes.end(), in.holelist);
+  }
+
+  // Regions are x, y, z, attribute and a volume constraint; a negative constraint leaves it to the 'a' switch
+  in.numberofregions = static_cast<int>(regions.size() / 4);
+  if(in.numberofregions > 0)
+  {
+    in.regionlist = new REAL[in.numberofregions * 5];
+    for(int i = 0; i < in.numberofregions; i++)
+    {
+      std::copy(regions.begin() + i * 4, regions.begin() + i * 4 + 4, in.regionlist + i * 5);
+      in.regionlist[i * 5 + 4] = -1.0;
+    }
+  }
+
+  // 'z' numbers the output from zero like the input and 'Q' keeps TetGen from printing to stdout
+  QByteArray commandLine = (switches + "zQ").toLatin1();
+  filter->notifyStatusMessage(QObject::tr("Running TetGen with switches -%1").arg(switches));
+  try
+  {
+    ::tetrahedralize(commandLine.data(), &in, &out);
+  } catch(int code)
+  {
+    filter->setErrorCondition(-4017, QObject::tr("TetGen failed: %1").arg(describeTetGenError(code)));
+    return false;
+  }
+
+  if(out.numberofcorners != 4 || out.numberoftetrahedronattributes < 1)
+  {
+    filter->setErrorCondition(-4017, QObject::tr("TetGen did not create linear tetrahedra with region attributes"));
+    return false;
+  }
+
+  const size_t numPoints = static_cast<size_t>(out.numberofpoints);
+  const size_t numTets = static_cast<size_t>(out.numberoftetrahedra);
+  vertexAttrMat.resizeAttributeArrays(std::vector<size_t>(1, numPoints));
+  cellAttrMat.resizeAttributeArrays(std::vector<size_t>(1, numTets));
+  tetGeom.resizeVertexList(numPoints);
+  tetGeom.resizeTetList(numTets);
+
+  float* tetVertices = tetGeom.getVertexPointer(0);
+  for(size_t i = 0; i < numPoints * 3; i++)
+  {
+    tetVertices[i] = static_cast<float>(out.pointlist[i]);
+  }
+
+  MeshIndexType* tets = tetGeom.getTetPointer(0);
+  std::copy(out.tetrahedronlist, out.tetrahedronlist + numTets * 4, tets);
+
+  const size_t numAttributes = static_cast<size_t>(out.numberoftetrahedronattributes);
+  tetRegions.resize(numTets);
+  for(size_t i = 0; i < numTets; i++)
+  {
+    tetRegions[i] = static_cast<int32_t>(std::lround(out.tetrahedronattributelist[i * numAttributes]));
+  }
+  return true;
+#else
+  Q_UNUSED(surfaceMesh);
+  Q_UNUSED(holes);
+  Q_UNUSED(regions);
+  Q_UNUSED(switches);
+  Q_UNUSED(tetGeom);
+  Q_UNUSED(vertexAttrMat);
+  Q_UNUSED(cellAttrMat);
+  Q_UNUSED(tetRegions);
+  filter->setErrorCondition(-4017, QObject::tr("The SimulationIO plugin was built without the TetGen library (SimulationIO_USE_TETGEN_LIBRARY)"));
+  return false;
+#endif
+}
+} // namespace TetGenMesher
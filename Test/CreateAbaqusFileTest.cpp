@@ -0,0 +1,400 @@
+// -----------------------------------------------------------------------------
+// Insert your license & copyright information here
+// -----------------------------------------------------------------------------
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <vector>
+
+#include <QtCore/QFile>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/Filtering/FilterManager.h"
+#include "SIMPLib/Geometry/ImageGeom.h"
+
+#include "SimulationIO/SimulationIOFilters/CreateAbaqusFile.h"
+#include "SimulationIO/SimulationIOFilters/Utility/FeatureAggregator.h"
+
+#include "UnitTestSupport.hpp"
+
+#include "SimulationIOTestHelpers.hpp"
+
+#include "SimulationIOTestFileLocations.h"
+
+class CreateAbaqusFileTest
+{
+  const QString k_DataContainerName = {"ImageDataContainer"};
+  const QString k_CellAMName = {"CellData"};
+  const QString k_FeatureIdsName = {"FeatureIds"};
+  const QString k_PhasesName = {"Phases"};
+  const QString k_EulersName = {"EulerAngles"};
+  const QString k_FilePrefix = {"AbaqusTest"};
+  const QString k_ElsetFile = UnitTest::TestTempDir + "/AbaqusTest_elset.inp";
+  const QString k_NodesFile = UnitTest::TestTempDir + "/AbaqusTest_nodes.inp";
+  const QString k_ElemsFile = UnitTest::TestTempDir + "/AbaqusTest_elems.inp";
+
+public:
+  CreateAbaqusFileTest() = default;
+  ~CreateAbaqusFileTest() = default;
+  CreateAbaqusFileTest(const CreateAbaqusFileTest&) = delete;            // Copy Constructor
+  CreateAbaqusFileTest(CreateAbaqusFileTest&&) = delete;                 // Move Constructor
+  CreateAbaqusFileTest& operator=(const CreateAbaqusFileTest&) = delete; // Copy Assignment
+  CreateAbaqusFileTest& operator=(CreateAbaqusFileTest&&) = delete;      // Move Assignment
+
+  // -----------------------------------------------------------------------------
+  void RemoveTestFiles()
+  {
+#if REMOVE_TEST_FILES
+    for(const QString& suffix : {".inp", "_nodes.inp", "_elems.inp", "_sects.inp", "_elset.inp"})
+    {
+      QFile::remove(UnitTest::TestTempDir + "/" + k_FilePrefix + suffix);
+    }
+#endif
+  }
+
+  // -----------------------------------------------------------------------------
+  int TestFilterAvailability()
+  {
+    // Now instantiate the CreateAbaqusFileTest Filter from the FilterManager
+    QString filtName = "CreateAbaqusFile";
+    FilterManager* fm = FilterManager::Instance();
+    IFilterFactory::Pointer filterFactory = fm->getFactoryFromClassName(filtName);
+    if(nullptr == filterFactory)
+    {
+      std::stringstream ss;
+      ss << "The CreateAbaqusFileTest Requires the use of the " << filtName.toStdString() << " filter which is found in the SimulationIO Plugin";
+      DREAM3D_TEST_THROW_EXCEPTION(ss.str())
+    }
+    return 0;
+  }
+
+  // -----------------------------------------------------------------------------
+  DataContainerArray::Pointer CreateDataContainerArray(size_t xDim, size_t yDim, size_t zDim, int32_t numGrains)
+  {
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    AttributeMatrix::Pointer cellAM =
+        SimulationIOTestHelpers::CreateImageDataContainer(dca, k_DataContainerName, k_CellAMName, SizeVec3Type(xDim, yDim, zDim), FloatVec3Type(0.5f, 0.5f, 0.5f), FloatVec3Type(0.0f, 0.0f, 0.0f));
+
+    size_t totalPoints = xDim * yDim * zDim;
+    Int32ArrayType::Pointer featureIds = Int32ArrayType::CreateArray(totalPoints, std::vector<size_t>{1}, k_FeatureIdsName, true);
+    Int32ArrayType::Pointer phases = Int32ArrayType::CreateArray(totalPoints, std::vector<size_t>{1}, k_PhasesName, true);
+    FloatArrayType::Pointer eulers = FloatArrayType::CreateArray(totalPoints, std::vector<size_t>{3}, k_EulersName, true);
+
+    // Grain 0 and a few empty grains are included on purpose since neither may appear in any element set
+    std::mt19937 generator(5489u);
+    std::uniform_int_distribution<int32_t> grainDistribution(0, numGrains);
+    std::uniform_real_distribution<float> angleDistribution(0.0f, 3.14159f);
+    for(size_t i = 0; i < totalPoints; i++)
+    {
+      int32_t grainId = grainDistribution(generator);
+      if(grainId % 7 == 3)
+      {
+        grainId = 0;
+      }
+      featureIds->setValue(i, grainId);
+      phases->setValue(i, grainId % 3 + 1);
+      eulers->setComponent(i, 0, angleDistribution(generator));
+      eulers->setComponent(i, 1, angleDistribution(generator));
+      eulers->setComponent(i, 2, angleDistribution(generator));
+    }
+    featureIds->setValue(totalPoints - 1, numGrains);
+
+    cellAM->insertOrAssign(featureIds);
+    cellAM->insertOrAssign(phases);
+    cellAM->insertOrAssign(eulers);
+
+    return dca;
+  }
+
+  // -----------------------------------------------------------------------------
+  CreateAbaqusFile::Pointer CreateFilter(const DataContainerArray::Pointer& dca)
+  {
+    CreateAbaqusFile::Pointer filter = CreateAbaqusFile::New();
+    filter->setDataContainerArray(dca);
+    filter->setOutputPath(UnitTest::TestTempDir);
+    filter->setOutputFilePrefix(k_FilePrefix);
+    filter->setJobName("AbaqusTestJob");
+    filter->setAbqFeatureIdsArrayPath(DataArrayPath(k_DataContainerName, k_CellAMName, k_FeatureIdsName));
+    filter->setCellPhasesArrayPath(DataArrayPath(k_DataContainerName, k_CellAMName, k_PhasesName));
+    filter->setCellEulerAnglesArrayPath(DataArrayPath(k_DataContainerName, k_CellAMName, k_EulersName));
+    return filter;
+  }
+
+  // -----------------------------------------------------------------------------
+  // Reference ELSET output using the original per-grain scan of every voxel
+  // -----------------------------------------------------------------------------
+  std::string CreateReferenceElset(const Int32ArrayType& featureIds, const Int32ArrayType& phases)
+  {
+    int32_t maxGrainId = *std::max_element(featureIds.begin(), featureIds.end());
+    int32_t totalPoints = static_cast<int32_t>(featureIds.getNumberOfTuples());
+
+    std::vector<int32_t> phaseId(maxGrainId, 0);
+    for(int32_t i = 0; i < totalPoints; i++)
+    {
+      if(featureIds.getValue(i) > 0)
+      {
+        phaseId[featureIds.getValue(i) - 1] = phases.getValue(i);
+      }
+    }
+
+    std::stringstream ss;
+    for(int32_t voxelId = 1; voxelId <= maxGrainId; voxelId++)
+    {
+      size_t elementPerLine = 0;
+      ss << "*Elset, elset=Grain" << voxelId << "_Phase" << phaseId[voxelId - 1] << "_set\n";
+
+      for(int32_t i = 0; i < totalPoints; i++)
+      {
+        if(featureIds.getValue(i) == voxelId)
+        {
+          if(elementPerLine != 0)
+          {
+            if((elementPerLine % 16) != 0u)
+            {
+              ss << ", ";
+            }
+            else
+            {
+              ss << ",\n";
+            }
+          }
+          ss << static_cast<uint64_t>(i + 1);
+          elementPerLine++;
+        }
+      }
+      ss << "\n";
+    }
+    return ss.str();
+  }
+
+  // -----------------------------------------------------------------------------
+  // Reference nodes and elements output using the original std::stringstream formatting
+  // -----------------------------------------------------------------------------
+  std::string CreateReferenceNodes(const ImageGeom& imageGeom)
+  {
+    SizeVec3Type dims = imageGeom.getDimensions();
+    FloatVec3Type spacing = imageGeom.getSpacing();
+    FloatVec3Type origin = imageGeom.getOrigin();
+    int32_t nnode_x = dims[0] + 1;
+    int32_t nnode_y = dims[1] + 1;
+    int32_t nnode_z = dims[2] + 1;
+
+    std::stringstream ss;
+    ss << "*NODE, NSET=ALLNODES\n";
+    for(int32_t k = 0; k < nnode_z; k++)
+    {
+      for(int32_t j = 0; j < nnode_y; j++)
+      {
+        for(int32_t i = 0; i < nnode_x; i++)
+        {
+          int32_t index = k * nnode_x * nnode_y + j * nnode_x + i;
+          float value1 = origin[0] + (i * spacing[0]);
+          float value2 = origin[1] + (j * spacing[1]);
+          float value3 = origin[2] + (k * spacing[2]);
+          ss << std::fixed << std::setprecision(3) << index + 1 << ", " << value1 << ", " << value2 << ", " << value3 << "\n";
+        }
+      }
+    }
+    return ss.str();
+  }
+
+  // -----------------------------------------------------------------------------
+  std::string CreateReferenceElems(const ImageGeom& imageGeom)
+  {
+    SizeVec3Type dims = imageGeom.getDimensions();
+    int32_t ne_x = dims[0];
+    int32_t ne_y = dims[1];
+    int32_t ne_z = dims[2];
+    int32_t nnode_x = ne_x + 1;
+    int32_t nnode_y = ne_y + 1;
+
+    std::stringstream ss;
+    ss << "*ELEMENT, TYPE=C3D8R, ELSET=ALLELEMENTS\n";
+    for(int32_t k = 0; k < ne_z; k++)
+    {
+      for(int32_t j = 0; j < ne_y; j++)
+      {
+        for(int32_t i = 0; i < ne_x; i++)
+        {
+          int32_t eindex = k * ne_x * ne_y + j * ne_x + i;
+          int32_t index = k * nnode_x * nnode_y + j * nnode_x + i + 1;
+          ss << eindex + 1 << ", " << index << ", " << index + 1 << ", " << index + nnode_x + 1 << ", " << index + nnode_x << ", " << index + nnode_x * nnode_y << ", "
+             << index + 1 + nnode_x * nnode_y << ", " << index + nnode_x + nnode_x * nnode_y + 1 << ", " << index + nnode_x + nnode_x * nnode_y << "\n";
+        }
+      }
+    }
+    return ss.str();
+  }
+
+  // -----------------------------------------------------------------------------
+  int TestElsetOutput()
+  {
+    DataContainerArray::Pointer dca = CreateDataContainerArray(23, 17, 11, 150);
+    CreateAbaqusFile::Pointer filter = CreateFilter(dca);
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCode(), >=, 0)
+
+    AttributeMatrix::Pointer cellAM = dca->getAttributeMatrix(DataArrayPath(k_DataContainerName, k_CellAMName, ""));
+    DREAM3D_REQUIRE_VALID_POINTER(cellAM)
+    Int32ArrayType::Pointer featureIds = cellAM->getAttributeArrayAs<Int32ArrayType>(k_FeatureIdsName);
+    Int32ArrayType::Pointer phases = cellAM->getAttributeArrayAs<Int32ArrayType>(k_PhasesName);
+    DREAM3D_REQUIRE_VALID_POINTER(featureIds)
+    DREAM3D_REQUIRE_VALID_POINTER(phases)
+
+    std::string expected = CreateReferenceElset(*featureIds, *phases);
+    std::string actual = SimulationIOTestHelpers::ReadFile(k_ElsetFile);
+    DREAM3D_REQUIRE_EQUAL(actual.size(), expected.size())
+    DREAM3D_REQUIRE(actual == expected)
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  int TestNodesAndElemsOutput()
+  {
+    DataContainerArray::Pointer dca = CreateDataContainerArray(13, 9, 21, 40);
+    ImageGeom::Pointer imageGeom = dca->getDataContainer(k_DataContainerName)->getGeometryAs<ImageGeom>();
+    DREAM3D_REQUIRE_VALID_POINTER(imageGeom)
+    imageGeom->setOrigin(FloatVec3Type(-1.0625f, 0.3f, 2.0f));
+    imageGeom->setSpacing(FloatVec3Type(0.125f, 0.0005f, 0.1f));
+
+    std::string expectedNodes = CreateReferenceNodes(*imageGeom);
+    std::string expectedElems = CreateReferenceElems(*imageGeom);
+
+    for(int numThreads : {1, 4, 0})
+    {
+      CreateAbaqusFile::Pointer filter = CreateFilter(dca);
+      filter->setNumThreads(numThreads);
+      filter->execute();
+      DREAM3D_REQUIRED(filter->getErrorCode(), >=, 0)
+
+      DREAM3D_REQUIRE(SimulationIOTestHelpers::ReadFile(k_NodesFile) == expectedNodes)
+      DREAM3D_REQUIRE(SimulationIOTestHelpers::ReadFile(k_ElemsFile) == expectedElems)
+    }
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  int TestElsetBenchmark()
+  {
+    DataContainerArray::Pointer dca = CreateDataContainerArray(100, 100, 100, 5000);
+
+    for(int numThreads : {1, 0})
+    {
+      CreateAbaqusFile::Pointer filter = CreateFilter(dca);
+      filter->setNumThreads(numThreads);
+
+      auto start = std::chrono::steady_clock::now();
+      filter->execute();
+      auto end = std::chrono::steady_clock::now();
+      DREAM3D_REQUIRED(filter->getErrorCode(), >=, 0)
+
+      std::cout << "CreateAbaqusFile 100x100x100 / 5000 grains / " << numThreads << " writer threads: " << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << " ms"
+                << std::endl;
+    }
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  int TestFeatureAggregator()
+  {
+    DataContainerArray::Pointer dca = CreateDataContainerArray(31, 17, 13, 300);
+    AttributeMatrix::Pointer cellAM = dca->getAttributeMatrix(DataArrayPath(k_DataContainerName, k_CellAMName, ""));
+    DREAM3D_REQUIRE_VALID_POINTER(cellAM)
+    Int32ArrayType::Pointer featureIds = cellAM->getAttributeArrayAs<Int32ArrayType>(k_FeatureIdsName);
+    Int32ArrayType::Pointer phases = cellAM->getAttributeArrayAs<Int32ArrayType>(k_PhasesName);
+    FloatArrayType::Pointer eulers = cellAM->getAttributeArrayAs<FloatArrayType>(k_EulersName);
+    const size_t totalPoints = featureIds->getNumberOfTuples();
+
+    // The last voxel of each grain wins, as in the grain loops the aggregator replaced
+    const int32_t maxGrainId = *std::max_element(featureIds->begin(), featureIds->end());
+    std::vector<int32_t> expectedPhases(maxGrainId + 1, 0);
+    std::vector<float> expectedEulers((maxGrainId + 1) * 3, 0.0f);
+    std::vector<size_t> expectedCounts(maxGrainId + 1, 0);
+    for(size_t i = 0; i < totalPoints; i++)
+    {
+      int32_t grainId = featureIds->getValue(i);
+      if(grainId > 0)
+      {
+        expectedPhases[grainId] = phases->getValue(i);
+        expectedCounts[grainId]++;
+        for(size_t c = 0; c < 3; c++)
+        {
+          expectedEulers[grainId * 3 + c] = eulers->getComponent(i, c);
+        }
+      }
+    }
+
+    FeatureAggregator::FeatureData reference =
+        FeatureAggregator::aggregate(featureIds->getPointer(0), phases->getPointer(0), eulers->getPointer(0), totalPoints, FeatureAggregator::Orientation::Mean, 1);
+    for(int numThreads : {1, 3, 0})
+    {
+      FeatureAggregator::FeatureData grains =
+          FeatureAggregator::aggregate(featureIds->getPointer(0), phases->getPointer(0), eulers->getPointer(0), totalPoints, FeatureAggregator::Orientation::LastVoxel, numThreads);
+      DREAM3D_REQUIRE_EQUAL(grains.maxFeatureId, maxGrainId)
+      DREAM3D_REQUIRE(grains.phases == expectedPhases)
+      DREAM3D_REQUIRE(grains.eulerAngles == expectedEulers)
+      DREAM3D_REQUIRE(grains.voxelCounts == expectedCounts)
+
+      // The voxels are split over the threads, so the mean is only summed in a different order
+      grains = FeatureAggregator::aggregate(featureIds->getPointer(0), phases->getPointer(0), eulers->getPointer(0), totalPoints, FeatureAggregator::Orientation::Mean, numThreads);
+      DREAM3D_REQUIRE_EQUAL(grains.eulerAngles.size(), reference.eulerAngles.size())
+      for(size_t i = 0; i < grains.eulerAngles.size(); i++)
+      {
+        DREAM3D_REQUIRED(std::abs(std::remainder(grains.eulerAngles[i] - reference.eulerAngles[i], 6.2831853f)), <, 1.0e-5f)
+      }
+      DREAM3D_REQUIRE(grains.phases == expectedPhases)
+      DREAM3D_REQUIRE(grains.voxelCounts == expectedCounts)
+    }
+
+    // Orientations scattered around one orientation average back to it, also across the phi1 = 0 / 2pi seam
+    const std::vector<float> center = {0.0f, 0.7f, 2.0f};
+    std::vector<int32_t> grainIds(200, 1);
+    std::vector<int32_t> grainPhases(200, 2);
+    std::vector<float> grainEulers(600);
+    for(size_t i = 0; i < 200; i++)
+    {
+      const float offset = (i % 2 == 0 ? 1.0f : -1.0f) * 0.01f * static_cast<float>(i % 5);
+      grainEulers[i * 3] = offset < 0.0f ? offset + 6.2831853f : offset;
+      grainEulers[i * 3 + 1] = center[1];
+      grainEulers[i * 3 + 2] = center[2];
+    }
+    FeatureAggregator::FeatureData grain = FeatureAggregator::aggregate(grainIds.data(), grainPhases.data(), grainEulers.data(), 200, FeatureAggregator::Orientation::Mean, 2);
+    DREAM3D_REQUIRE_EQUAL(grain.voxelCounts[1], 200)
+    DREAM3D_REQUIRE_EQUAL(grain.phases[1], 2)
+    DREAM3D_REQUIRED(std::abs(std::remainder(grain.eulerAngles[3] - center[0], 6.2831853f)), <, 1.0e-4f)
+    DREAM3D_REQUIRED(std::abs(grain.eulerAngles[4] - center[1]), <, 1.0e-4f)
+    DREAM3D_REQUIRED(std::abs(grain.eulerAngles[5] - center[2]), <, 1.0e-4f)
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    int err = EXIT_SUCCESS;
+    std::cout << "############ Starting CreateAbaqusFileTest  ##############" << std::endl;
+
+    DREAM3D_REGISTER_TEST(TestFilterAvailability());
+
+    DREAM3D_REGISTER_TEST(TestElsetOutput())
+    DREAM3D_REGISTER_TEST(TestNodesAndElemsOutput())
+    DREAM3D_REGISTER_TEST(TestFeatureAggregator())
+#ifdef SimulationIO_ENABLE_BENCHMARKS
+    DREAM3D_REGISTER_TEST(TestElsetBenchmark())
+#endif
+
+    DREAM3D_REGISTER_TEST(RemoveTestFiles())
+  }
+};
@@ -3,7 +3,15 @@
 // -----------------------------------------------------------------------------
 #pragma once
 
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <vector>
+
 #include <QtCore/QFile>
+#include <QtCore/QTextStream>
 
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/DataArrays/DataArray.hpp"
@@ -14,6 +22,17 @@
 #include "SIMPLib/Plugin/ISIMPLibPlugin.h"
 #include "SIMPLib/Plugin/SIMPLibPluginLoader.h"
 
+#include "SIMPLib/Geometry/TetrahedralGeom.h"
+#include "SIMPLib/Geometry/TriangleGeom.h"
+
+#include "SimulationIO/SimulationIOFilters/Export3dSolidMesh.h"
+#include "SimulationIO/SimulationIOFilters/Utility/FeatureStlWriter.h"
+#include "SimulationIO/SimulationIOFilters/Utility/GmshMesher.h"
+#include "SimulationIO/SimulationIOFilters/Utility/MappedTextReader.hpp"
+#include "SimulationIO/SimulationIOFilters/Utility/NetgenVolMerger.h"
+#include "SimulationIO/SimulationIOFilters/Utility/ProcessPool.h"
+#include "SimulationIO/SimulationIOFilters/Utility/TetGenFileReader.h"
+
 #include "UnitTestSupport.hpp"
 
 #include "SimulationIOTestFileLocations.h"
@@ -29,6 +48,15 @@ public:
   Export3dSolidMeshTest& operator=(const Export3dSolidMeshTest&) = delete; // Copy Assignment
   Export3dSolidMeshTest& operator=(Export3dSolidMeshTest&&) = delete;      // Move Assignment
 
+  const QString k_FeatureMesh1 = UnitTest::TestTempDir + "/Export3dSolidMeshTest_Feature_1.vol";
+  const QString k_FeatureMesh2 = UnitTest::TestTempDir + "/Export3dSolidMeshTest_Feature_2.vol";
+  const QString k_InvalidMesh = UnitTest::TestTempDir + "/Export3dSolidMeshTest_Invalid.vol";
+  const QString k_MergedMesh = UnitTest::TestTempDir + "/Export3dSolidMeshTest_MergedMesh.vol";
+  const QString k_TetGenNodeFile = UnitTest::TestTempDir + "/Export3dSolidMeshTest_tetgen.1.node";
+  const QString k_TetGenEleFile = UnitTest::TestTempDir + "/Export3dSolidMeshTest_tetgen.1.ele";
+  const QString k_InvalidEleFile = UnitTest::TestTempDir + "/Export3dSolidMeshTest_invalid.1.ele";
+  const QString k_FeatureStlPrefix = UnitTest::TestTempDir + "/Export3dSolidMeshTest_Feature_";
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -37,6 +65,15 @@ public:
 #if REMOVE_TEST_FILES
     QFile::remove(UnitTest::Export3dSolidMeshTest::TestFile1);
     QFile::remove(UnitTest::Export3dSolidMeshTest::TestFile2);
+    QFile::remove(k_FeatureMesh1);
+    QFile::remove(k_FeatureMesh2);
+    QFile::remove(k_InvalidMesh);
+    QFile::remove(k_MergedMesh);
+    QFile::remove(k_TetGenNodeFile);
+    QFile::remove(k_TetGenEleFile);
+    QFile::remove(k_InvalidEleFile);
+    QFile::remove(k_FeatureStlPrefix + "1.stlb");
+    QFile::remove(k_FeatureStlPrefix + "2.stlb");
 #endif
   }
 
@@ -88,6 +125,495 @@ public:
     return EXIT_SUCCESS;
   }
 
+  // -----------------------------------------------------------------------------
+  // The pool is exercised with shell commands standing in for Netgen
+  // -----------------------------------------------------------------------------
+  int TestProcessPool()
+  {
+#if !defined(_WIN32)
+    std::vector<ProcessPool::Job> jobs;
+    for(int i = 0; i < 16; i++)
+    {
+      ProcessPool::Job job;
+      job.program = "/bin/sh";
+      job.arguments << "-c" << QString("echo feature %1; sleep 0.2; exit %2").arg(i).arg(i % 5 == 3 ? 1 : 0);
+      job.workingDirectory = UnitTest::TestTempDir;
+      jobs.push_back(job);
+    }
+    ProcessPool::Job missingJob;
+    missingJob.program = UnitTest::TestTempDir + "/Export3dSolidMeshTest_missing_netgen";
+    jobs.push_back(missingJob);
+
+    std::vector<QString> output(jobs.size());
+    size_t numEnded = 0;
+    auto start = std::chrono::steady_clock::now();
+    std::vector<ProcessPool::Result> results = ProcessPool::run(
+        jobs, 8, [&output](size_t job, const QString& text) { output[job] += text; }, [&numEnded](size_t value) { numEnded = value; }, []() { return false; });
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    DREAM3D_REQUIRE_EQUAL(results.size(), jobs.size())
+    DREAM3D_REQUIRE_EQUAL(numEnded, jobs.size())
+    for(int i = 0; i < 16; i++)
+    {
+      DREAM3D_REQUIRE(output[i].trimmed() == QString("feature %1").arg(i))
+      if(i % 5 == 3)
+      {
+        DREAM3D_REQUIRE(results[i].status == ProcessPool::Status::Failed)
+        DREAM3D_REQUIRE_EQUAL(results[i].exitCode, 1)
+      }
+      else
+      {
+        DREAM3D_REQUIRE(results[i].status == ProcessPool::Status::Succeeded)
+      }
+    }
+    DREAM3D_REQUIRE(results.back().status == ProcessPool::Status::FailedToStart)
+
+#ifdef SimulationIO_ENABLE_BENCHMARKS
+    // 16 jobs of 0.2 s each on 8 processes take about 0.4 s rather than 3.2 s
+    DREAM3D_REQUIRED(elapsed.count(), <, 2.0)
+#endif
+
+    // Stopping kills the running jobs and starts no further ones
+    jobs.clear();
+    for(int i = 0; i < 6; i++)
+    {
+      ProcessPool::Job job;
+      job.program = "/bin/sh";
+      job.arguments << "-c"
+                    << "exec sleep 30";
+      jobs.push_back(job);
+    }
+    start = std::chrono::steady_clock::now();
+    results = ProcessPool::run(
+        jobs, 2, [](size_t, const QString&) {}, [](size_t) {}, [&start]() { return std::chrono::steady_clock::now() - start > std::chrono::milliseconds(300); });
+    elapsed = std::chrono::steady_clock::now() - start;
+
+    DREAM3D_REQUIRED(elapsed.count(), <, 10.0)
+    DREAM3D_REQUIRE(results[0].status == ProcessPool::Status::Canceled)
+    DREAM3D_REQUIRE(results[1].status == ProcessPool::Status::Canceled)
+    for(size_t i = 2; i < results.size(); i++)
+    {
+      DREAM3D_REQUIRE(results[i].status == ProcessPool::Status::NotStarted)
+    }
+#endif
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  void WriteTextFile(const QString& filePath, const QString& text)
+  {
+    QFile file(filePath);
+    file.open(QIODevice::WriteOnly);
+    QTextStream out(&file);
+    out << text;
+  }
+
+  // -----------------------------------------------------------------------------
+  // Two tetrahedra sharing the face (1,0,0) (0,1,0) (0,0,1), written the way Netgen writes feature meshes
+  // -----------------------------------------------------------------------------
+  int TestNetgenVolMerger()
+  {
+    WriteTextFile(k_FeatureMesh1, "mesh3d\r\ndimension\r\n3\r\ngeomtype\r\n11\r\n\r\n"
+                                  "# surfnr    bcnr   domin  domout      np      p1      p2      p3\r\n"
+                                  "surfaceelementsgi\r\n4\r\n"
+                                  "       1       1       1       0       3       1       3       2       5       5       5\r\n"
+                                  "       1       1       1       0       3       1       2       4       6       6       6\r\n"
+                                  "       2       1       1       0       3       1       4       3       7       7       7\r\n"
+                                  "       2       2       1       0       3       2       3       4       8       8       8\r\n\r\n"
+                                  "#  matnr      np      p1      p2      p3      p4\r\nvolumeelements\r\n1\r\n       1       4       1       2       3       4\r\n\r\n"
+                                  "edgesegmentsgi2\r\n1\r\n       2       0       2       3       5       6       1       2       1  0.0000000000000000       1  1.0000000000000000\r\n\r\n"
+                                  "#          X             Y             Z\r\npoints\r\n4\r\n"
+                                  "    0.0000000000000000     0.0000000000000000     0.0000000000000000\r\n"
+                                  "    1.0000000000000000     0.0000000000000000     0.0000000000000000\r\n"
+                                  "    0.0000000000000000     1.0000000000000000     0.0000000000000000\r\n"
+                                  "    0.0000000000000000     0.0000000000000000     1.0000000000000000\r\n\r\n"
+                                  "materials\r\n1\r\n1 domain1\r\n\r\nendmesh\r\n");
+    // Listed in a different order, with the shared points off by less than the tolerance
+    WriteTextFile(k_FeatureMesh2, "mesh3d\ndimension\n3\ngeomtype\n11\n\n"
+                                  "surfaceelements\n2\n 1 1 1 0 3 1 2 3\n 1 1 1 0 3 1 2 4\n\n"
+                                  "volumeelements\n1\n 0 4 4 3 2 1\n\n"
+                                  "edgesegments\n0\n\n"
+                                  "points\n4\n 1 1 1\n 0 0 1.000000000001\n 0 1 0\n 0.999999999999 0 0\n\nendmesh\n");
+
+    Export3dSolidMesh::Pointer filter = Export3dSolidMesh::New();
+    QStringList meshFiles = {k_FeatureMesh1, k_FeatureMesh2};
+    DREAM3D_REQUIRE(NetgenVolMerger::merge(filter.get(), meshFiles, k_MergedMesh, 2))
+    DREAM3D_REQUIRED(filter->getErrorCode(), >=, 0)
+
+    MappedTextReader::MappedFile mergedFile;
+    DREAM3D_REQUIRE(mergedFile.open(k_MergedMesh))
+    NetgenVolMerger::Mesh merged;
+    size_t errorLine = 0;
+    DREAM3D_REQUIRE(NetgenVolMerger::parse(mergedFile.text(), merged, errorLine))
+
+    // The three points of the shared face are welded
+    DREAM3D_REQUIRE_EQUAL(merged.geomType, 11)
+    DREAM3D_REQUIRE_EQUAL(merged.points.size(), 15)
+    DREAM3D_REQUIRE_EQUAL(merged.points[12], 1.0)
+    DREAM3D_REQUIRE_EQUAL(merged.points[13], 1.0)
+    DREAM3D_REQUIRE_EQUAL(merged.points[14], 1.0)
+
+    // Each feature is its own domain and the second tetrahedron uses the points of the first
+    const std::vector<int32_t> expectedMaterials = {1, 2};
+    const std::vector<int64_t> expectedTets = {1, 2, 3, 4, 2, 3, 4, 5};
+    DREAM3D_REQUIRE(merged.volumeElements.attributes == expectedMaterials)
+    DREAM3D_REQUIRE(merged.volumeElements.nodes == expectedTets)
+
+    // Surfaces of the second feature are numbered after those of the first and face the second domain
+    DREAM3D_REQUIRE_EQUAL(merged.surfaceElements.nodeCounts.size(), 6)
+    const std::vector<int32_t> expectedSurfaces = {1, 1, 1, 0, 1, 1, 1, 0, 2, 1, 1, 0, 2, 2, 1, 0, 3, 1, 2, 0, 3, 1, 2, 0};
+    const std::vector<int64_t> expectedTriangles = {1, 3, 2, 1, 2, 4, 1, 4, 3, 2, 3, 4, 5, 4, 3, 5, 4, 2};
+    DREAM3D_REQUIRE(merged.surfaceElements.attributes == expectedSurfaces)
+    DREAM3D_REQUIRE(merged.surfaceElements.nodes == expectedTriangles)
+
+    const std::vector<int64_t> expectedSegments = {2, 3};
+    DREAM3D_REQUIRE_EQUAL(merged.edgeSegments.attributes.size(), 1)
+    DREAM3D_REQUIRE_EQUAL(merged.edgeSegments.attributes[0], 2)
+    DREAM3D_REQUIRE(merged.edgeSegments.nodes == expectedSegments)
+
+    // Element nodes must refer to existing points
+    WriteTextFile(k_InvalidMesh, "mesh3d\nvolumeelements\n1\n 1 4 1 2 3 9\npoints\n1\n 0 0 0\nendmesh\n");
+    filter = Export3dSolidMesh::New();
+    meshFiles = QStringList({k_FeatureMesh1, k_InvalidMesh});
+    DREAM3D_REQUIRE(!NetgenVolMerger::merge(filter.get(), meshFiles, k_MergedMesh, 2))
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCode(), -4014)
+
+    filter = Export3dSolidMesh::New();
+    meshFiles = QStringList({k_FeatureMesh1, UnitTest::TestTempDir + "/Export3dSolidMeshTest_Missing.vol"});
+    DREAM3D_REQUIRE(!NetgenVolMerger::merge(filter.get(), meshFiles, k_MergedMesh, 2))
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCode(), -4013)
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  // Per tetrahedron output of TetGenFileReader
+  // -----------------------------------------------------------------------------
+  struct TetGenMesh
+  {
+    std::vector<float> vertices;
+    std::vector<MeshIndexType> tets;
+    std::vector<int32_t> featureIds;
+    std::vector<int32_t> phases;
+    std::vector<float> eulerAngles;
+  };
+
+  // -----------------------------------------------------------------------------
+  bool ReadTetGenFiles(const QString& nodeFile, const QString& eleFile, AbstractFilter* filter, const std::vector<int32_t>& featurePhases, const std::vector<float>& featureEulerAngles,
+                       int32_t numThreads, TetGenMesh& mesh)
+  {
+    TetGenFileReader reader;
+    if(!reader.open(filter, nodeFile, eleFile))
+    {
+      return false;
+    }
+    mesh.vertices.assign(reader.getNumVertices() * 3, 0.0f);
+    mesh.tets.assign(reader.getNumTets() * 4, 0);
+    mesh.featureIds.assign(reader.getNumTets(), 0);
+    mesh.phases.assign(reader.getNumTets(), 0);
+    mesh.eulerAngles.assign(reader.getNumTets() * 3, 0.0f);
+
+    TetGenFileReader::FeatureData featureData;
+    featureData.featurePhases = featurePhases.data();
+    featureData.featureEulerAngles = featureEulerAngles.data();
+    featureData.numFeatures = featurePhases.size();
+    featureData.featureIds = mesh.featureIds.data();
+    featureData.phases = mesh.phases.data();
+    featureData.eulerAngles = mesh.eulerAngles.data();
+    return reader.read(filter, mesh.vertices.data(), mesh.tets.data(), featureData, numThreads);
+  }
+
+  // -----------------------------------------------------------------------------
+  int TestTetGenFileReader()
+  {
+    // TetGen numbers from 1 and ends its files with a comment
+    WriteTextFile(k_TetGenNodeFile, "5  3  0  1\n"
+                                    "   1    0.5  0  0    1\n"
+                                    "   2    1  0  0    1\n"
+                                    "   3    0  1  0    1\n"
+                                    "   4    0  0  1    1\n"
+                                    "   5    1  1  1    0\n"
+                                    "# Generated by tetgen -pYAO2 tetgenInp.smesh\n");
+    WriteTextFile(k_TetGenEleFile, "2  4  1\r\n"
+                                   "    1       1     2     3     4    1\r\n"
+                                   "    2       2     3     4     5    2\r\n"
+                                   "# Generated by tetgen -pYAO2 tetgenInp.smesh\r\n");
+    const std::vector<int32_t> featurePhases = {0, 1, 2};
+    const std::vector<float> featureEulerAngles = {0.0f, 0.0f, 0.0f, 0.1f, 0.2f, 0.3f, 1.1f, 1.2f, 1.3f};
+
+    Export3dSolidMesh::Pointer filter = Export3dSolidMesh::New();
+    TetGenMesh mesh;
+    DREAM3D_REQUIRE(ReadTetGenFiles(k_TetGenNodeFile, k_TetGenEleFile, filter.get(), featurePhases, featureEulerAngles, 2, mesh))
+    DREAM3D_REQUIRED(filter->getErrorCode(), >=, 0)
+
+    const std::vector<float> expectedVertices = {0.5f, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 1, 1, 1};
+    const std::vector<MeshIndexType> expectedTets = {0, 1, 2, 3, 1, 2, 3, 4};
+    const std::vector<int32_t> expectedFeatureIds = {1, 2};
+    const std::vector<float> expectedEulerAngles = {0.1f, 0.2f, 0.3f, 1.1f, 1.2f, 1.3f};
+    DREAM3D_REQUIRE(mesh.vertices == expectedVertices)
+    DREAM3D_REQUIRE(mesh.tets == expectedTets)
+    DREAM3D_REQUIRE(mesh.featureIds == expectedFeatureIds)
+    DREAM3D_REQUIRE(mesh.phases == expectedFeatureIds)
+    DREAM3D_REQUIRE(mesh.eulerAngles == expectedEulerAngles)
+
+    // A region attribute that is not a feature
+    WriteTextFile(k_InvalidEleFile, "2  4  1\n    1       1     2     3     4    1\n    2       2     3     4     5    7\n");
+    filter = Export3dSolidMesh::New();
+    DREAM3D_REQUIRE(!ReadTetGenFiles(k_TetGenNodeFile, k_InvalidEleFile, filter.get(), featurePhases, featureEulerAngles, 2, mesh))
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCode(), -4021)
+
+    // A node that does not exist
+    WriteTextFile(k_InvalidEleFile, "2  4  1\n    1       1     2     3     4    1\n    2       2     3     4     6    2\n");
+    filter = Export3dSolidMesh::New();
+    DREAM3D_REQUIRE(!ReadTetGenFiles(k_TetGenNodeFile, k_InvalidEleFile, filter.get(), featurePhases, featureEulerAngles, 2, mesh))
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCode(), -4020)
+
+    // Fewer tetrahedra than the header announces
+    WriteTextFile(k_InvalidEleFile, "3  4  1\n    1       1     2     3     4    1\n    2       2     3     4     5    2\n");
+    filter = Export3dSolidMesh::New();
+    DREAM3D_REQUIRE(!ReadTetGenFiles(k_TetGenNodeFile, k_InvalidEleFile, filter.get(), featurePhases, featureEulerAngles, 2, mesh))
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCode(), -4020)
+
+    // Without region attributes the tetrahedra cannot be assigned to features
+    WriteTextFile(k_InvalidEleFile, "1  4  0\n    1       1     2     3     4\n");
+    filter = Export3dSolidMesh::New();
+    DREAM3D_REQUIRE(!ReadTetGenFiles(k_TetGenNodeFile, k_InvalidEleFile, filter.get(), featurePhases, featureEulerAngles, 2, mesh))
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCode(), -4019)
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  // Compares the reader with the line by line QByteArray::split parsing it replaced
+  // -----------------------------------------------------------------------------
+  int TestTetGenFileReaderBenchmark()
+  {
+    const size_t numVerts = 500000;
+    const size_t numTets = 2500000;
+    const size_t numFeatures = 1000;
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<float> coordinate(0.0f, 100.0f);
+    {
+      QFile file(k_TetGenNodeFile);
+      file.open(QIODevice::WriteOnly);
+      QTextStream out(&file);
+      out << numVerts << "  3  0  0\n";
+      for(size_t i = 0; i < numVerts; i++)
+      {
+        out << i + 1 << "  " << coordinate(generator) << "  " << coordinate(generator) << "  " << coordinate(generator) << "\n";
+      }
+    }
+    {
+      QFile file(k_TetGenEleFile);
+      file.open(QIODevice::WriteOnly);
+      QTextStream out(&file);
+      out << numTets << "  4  1\n";
+      for(size_t i = 0; i < numTets; i++)
+      {
+        out << i + 1;
+        for(size_t n = 0; n < 4; n++)
+        {
+          out << "  " << generator() % numVerts + 1;
+        }
+        out << "  " << generator() % (numFeatures - 1) + 1 << "\n";
+      }
+    }
+    std::vector<int32_t> featurePhases(numFeatures);
+    std::vector<float> featureEulerAngles(numFeatures * 3);
+    for(size_t i = 0; i < numFeatures; i++)
+    {
+      featurePhases[i] = static_cast<int32_t>(i % 3);
+      featureEulerAngles[i * 3] = coordinate(generator);
+      featureEulerAngles[i * 3 + 1] = coordinate(generator);
+      featureEulerAngles[i * 3 + 2] = coordinate(generator);
+    }
+
+    TetGenMesh reference;
+    auto start = std::chrono::steady_clock::now();
+    {
+      QFile nodeFile(k_TetGenNodeFile);
+      nodeFile.open(QIODevice::ReadOnly | QIODevice::Text);
+      QList<QByteArray> tokens = nodeFile.readLine().simplified().split(' ');
+      reference.vertices.resize(tokens[0].toULongLong() * 3);
+      for(size_t i = 0; i < reference.vertices.size() / 3; i++)
+      {
+        tokens = nodeFile.readLine().trimmed().simplified().split(' ');
+        for(size_t c = 0; c < 3; c++)
+        {
+          reference.vertices[i * 3 + c] = tokens[static_cast<int>(c) + 1].toFloat();
+        }
+      }
+
+      QFile eleFile(k_TetGenEleFile);
+      eleFile.open(QIODevice::ReadOnly | QIODevice::Text);
+      tokens = eleFile.readLine().simplified().split(' ');
+      size_t count = tokens[0].toULongLong();
+      reference.tets.resize(count * 4);
+      reference.featureIds.resize(count);
+      reference.phases.resize(count);
+      reference.eulerAngles.resize(count * 3);
+      for(size_t i = 0; i < count; i++)
+      {
+        tokens = eleFile.readLine().trimmed().simplified().split(' ');
+        for(size_t n = 0; n < 4; n++)
+        {
+          reference.tets[i * 4 + n] = static_cast<MeshIndexType>(tokens[static_cast<int>(n) + 1].toInt() - 1);
+        }
+        int32_t featureId = tokens[5].toInt();
+        reference.featureIds[i] = featureId;
+        reference.phases[i] = featurePhases[featureId];
+        for(size_t c = 0; c < 3; c++)
+        {
+          reference.eulerAngles[i * 3 + c] = featureEulerAngles[featureId * 3 + c];
+        }
+      }
+    }
+    std::chrono::duration<double> referenceTime = std::chrono::steady_clock::now() - start;
+    std::cout << "TetGen .node/.ele (" << numTets << " tets) QByteArray::split: " << referenceTime.count() << " s" << std::endl;
+
+    for(int32_t numThreads : {1, 0})
+    {
+      Export3dSolidMesh::Pointer filter = Export3dSolidMesh::New();
+      TetGenMesh mesh;
+      start = std::chrono::steady_clock::now();
+      DREAM3D_REQUIRE(ReadTetGenFiles(k_TetGenNodeFile, k_TetGenEleFile, filter.get(), featurePhases, featureEulerAngles, numThreads, mesh))
+      std::chrono::duration<double> time = std::chrono::steady_clock::now() - start;
+      std::cout << "TetGen .node/.ele (" << numTets << " tets) TetGenFileReader, " << (numThreads == 0 ? QString("all cores") : QString("1 thread")).toStdString() << ": " << time.count() << " s"
+                << std::endl;
+
+      DREAM3D_REQUIRE(mesh.vertices == reference.vertices)
+      DREAM3D_REQUIRE(mesh.tets == reference.tets)
+      DREAM3D_REQUIRE(mesh.featureIds == reference.featureIds)
+      DREAM3D_REQUIRE(mesh.phases == reference.phases)
+      DREAM3D_REQUIRE(mesh.eulerAngles == reference.eulerAngles)
+    }
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  // Two tetrahedra sharing the face (1,0,0) (0,1,0) (0,0,1); -1 labels the outside of the sample
+  // -----------------------------------------------------------------------------
+  int TestFeatureStlWriter()
+  {
+    SharedVertexList::Pointer vertexList = TriangleGeom::CreateSharedVertexList(5);
+    TriangleGeom::Pointer triangleGeom = TriangleGeom::CreateGeometry(7, vertexList, SIMPL::Geometry::TriangleGeometry);
+    const std::vector<float> vertices = {0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 1, 1, 1};
+    const std::vector<MeshIndexType> tris = {0, 1, 2, 0, 1, 3, 0, 2, 3, 1, 2, 3, 1, 2, 4, 1, 3, 4, 2, 3, 4};
+    std::copy(vertices.begin(), vertices.end(), triangleGeom->getVertexPointer(0));
+    std::copy(tris.begin(), tris.end(), triangleGeom->getTriPointer(0));
+    std::vector<int32_t> faceLabels = {1, -1, 1, -1, 1, -1, 1, 2, 2, -1, 2, -1, 2, -1};
+
+    Export3dSolidMesh::Pointer filter = Export3dSolidMesh::New();
+    auto featureFile = [this](size_t feature) { return k_FeatureStlPrefix + QString::number(feature) + ".stlb"; };
+    DREAM3D_REQUIRE(FeatureStlWriter::writeBinary(filter.get(), *triangleGeom, faceLabels.data(), 3, featureFile, 2))
+
+    // Feature 1 owns the shared face on its first side, feature 2 on its second side, so it is reversed for feature 2
+    const std::vector<std::vector<MeshIndexType>> expectedTris = {{0, 1, 2, 0, 1, 3, 0, 2, 3, 1, 2, 3}, {1, 3, 2, 1, 2, 4, 1, 3, 4, 2, 3, 4}};
+    for(size_t feature = 1; feature <= 2; feature++)
+    {
+      QFile file(featureFile(feature));
+      DREAM3D_REQUIRE(file.open(QIODevice::ReadOnly))
+      QByteArray data = file.readAll();
+      const std::vector<MeshIndexType>& expected = expectedTris[feature - 1];
+      const size_t numTris = expected.size() / 3;
+      DREAM3D_REQUIRE_EQUAL(static_cast<size_t>(data.size()), 84 + numTris * 50)
+      DREAM3D_REQUIRE(data.startsWith(QString("DREAM3D Generated For Feature ID %1").arg(feature).toLatin1()))
+
+      uint32_t count = 0;
+      std::memcpy(&count, data.constData() + 80, sizeof(count));
+      DREAM3D_REQUIRE_EQUAL(count, numTris)
+      for(size_t i = 0; i < numTris; i++)
+      {
+        float values[12];
+        std::memcpy(values, data.constData() + 84 + i * 50, sizeof(values));
+        for(size_t j = 0; j < 3; j++)
+        {
+          const float* vertex = vertices.data() + expected[i * 3 + j] * 3;
+          DREAM3D_REQUIRE(values[3 + j * 3] == vertex[0] && values[4 + j * 3] == vertex[1] && values[5 + j * 3] == vertex[2])
+        }
+        // The normal follows the winding
+        const float* a = values + 3;
+        const float* b = values + 6;
+        const float* c = values + 9;
+        float cross[3] = {(b[1] - a[1]) * (c[2] - a[2]) - (b[2] - a[2]) * (c[1] - a[1]), (b[2] - a[2]) * (c[0] - a[0]) - (b[0] - a[0]) * (c[2] - a[2]),
+                          (b[0] - a[0]) * (c[1] - a[1]) - (b[1] - a[1]) * (c[0] - a[0])};
+        DREAM3D_REQUIRED(values[0] * cross[0] + values[1] * cross[1] + values[2] * cross[2], >, 0.0f)
+      }
+    }
+
+    // A label that is not a feature
+    faceLabels[6] = 3;
+    filter = Export3dSolidMesh::New();
+    DREAM3D_REQUIRE(!FeatureStlWriter::writeBinary(filter.get(), *triangleGeom, faceLabels.data(), 3, featureFile, 2))
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCode(), -4023)
+
+    return EXIT_SUCCESS;
+  }
+
+#ifdef SimulationIO_USE_GMSH_LIBRARY
+  // -----------------------------------------------------------------------------
+  // The two tetrahedra of TestFeatureStlWriter, meshed as two grains that share the face (1,0,0) (0,1,0) (0,0,1)
+  // -----------------------------------------------------------------------------
+  int TestGmshMesher()
+  {
+    SharedVertexList::Pointer vertexList = TriangleGeom::CreateSharedVertexList(5);
+    TriangleGeom::Pointer triangleGeom = TriangleGeom::CreateGeometry(7, vertexList, SIMPL::Geometry::TriangleGeometry);
+    const std::vector<float> vertices = {0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 1, 1, 1};
+    const std::vector<MeshIndexType> tris = {0, 1, 2, 0, 1, 3, 0, 2, 3, 1, 2, 3, 1, 2, 4, 1, 3, 4, 2, 3, 4};
+    std::copy(vertices.begin(), vertices.end(), triangleGeom->getVertexPointer(0));
+    std::copy(tris.begin(), tris.end(), triangleGeom->getTriPointer(0));
+    std::vector<int32_t> faceLabels = {1, -1, 1, -1, 1, -1, 1, 2, 2, -1, 2, -1, 2, -1};
+
+    Export3dSolidMesh::Pointer filter = Export3dSolidMesh::New();
+    TetrahedralGeom::Pointer tetGeom = TetrahedralGeom::CreateGeometry(0, TetrahedralGeom::CreateSharedVertexList(0), SIMPL::Geometry::TetrahedralGeometry);
+    AttributeMatrix::Pointer vertexAttrMat = AttributeMatrix::New(std::vector<size_t>(1, 0), "VertexData", AttributeMatrix::Type::Vertex);
+    AttributeMatrix::Pointer cellAttrMat = AttributeMatrix::New(std::vector<size_t>(1, 0), "CellData", AttributeMatrix::Type::Cell);
+    std::vector<int32_t> tetFeatures;
+    DREAM3D_REQUIRE(GmshMesher::tetrahedralize(filter.get(), *triangleGeom, faceLabels.data(), 3, 1, *tetGeom, *vertexAttrMat, *cellAttrMat, tetFeatures))
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCode(), 0)
+
+    const size_t numTets = tetGeom->getNumberOfTets();
+    DREAM3D_REQUIRED(numTets, >=, 2u)
+    DREAM3D_REQUIRE_EQUAL(tetFeatures.size(), numTets)
+    DREAM3D_REQUIRE_EQUAL(cellAttrMat->getNumberOfTuples(), numTets)
+    DREAM3D_REQUIRE_EQUAL(vertexAttrMat->getNumberOfTuples(), tetGeom->getNumberOfVertices())
+
+    // Every tetrahedron belongs to one of the grains, and the grains fill their volumes of 1/6 and 1/3
+    const float* tetVertices = tetGeom->getVertexPointer(0);
+    const MeshIndexType* tets = tetGeom->getTetPointer(0);
+    double volumes[3] = {0.0, 0.0, 0.0};
+    for(size_t i = 0; i < numTets; i++)
+    {
+      DREAM3D_REQUIRE(tetFeatures[i] == 1 || tetFeatures[i] == 2)
+      const float* a = tetVertices + tets[i * 4] * 3;
+      double edges[3][3];
+      for(size_t j = 0; j < 3; j++)
+      {
+        const float* b = tetVertices + tets[i * 4 + j + 1] * 3;
+        for(size_t c = 0; c < 3; c++)
+        {
+          edges[j][c] = static_cast<double>(b[c]) - a[c];
+        }
+      }
+      const double det = edges[0][0] * (edges[1][1] * edges[2][2] - edges[1][2] * edges[2][1]) - edges[0][1] * (edges[1][0] * edges[2][2] - edges[1][2] * edges[2][0]) +
+                         edges[0][2] * (edges[1][0] * edges[2][1] - edges[1][1] * edges[2][0]);
+      volumes[tetFeatures[i]] += std::abs(det) / 6.0;
+    }
+    DREAM3D_REQUIRED(std::abs(volumes[1] - 1.0 / 6.0), <, 1.0e-6)
+    DREAM3D_REQUIRED(std::abs(volumes[2] - 1.0 / 3.0), <, 1.0e-6)
+
+    // A surface mesh without any feature inside it
+    std::fill(faceLabels.begin(), faceLabels.end(), -1);
+    filter = Export3dSolidMesh::New();
+    DREAM3D_REQUIRE(!GmshMesher::tetrahedralize(filter.get(), *triangleGeom, faceLabels.data(), 3, 1, *tetGeom, *vertexAttrMat, *cellAttrMat, tetFeatures))
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCode(), -4025)
+
+    return EXIT_SUCCESS;
+  }
+#endif
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -98,6 +624,16 @@ public:
     DREAM3D_REGISTER_TEST(TestFilterAvailability());
 
     DREAM3D_REGISTER_TEST(TestExport3dSolidMeshTest())
+    DREAM3D_REGISTER_TEST(TestProcessPool())
+    DREAM3D_REGISTER_TEST(TestNetgenVolMerger())
+    DREAM3D_REGISTER_TEST(TestTetGenFileReader())
+    DREAM3D_REGISTER_TEST(TestFeatureStlWriter())
+#ifdef SimulationIO_USE_GMSH_LIBRARY
+    DREAM3D_REGISTER_TEST(TestGmshMesher())
+#endif
+#ifdef SimulationIO_ENABLE_BENCHMARKS
+    DREAM3D_REGISTER_TEST(TestTetGenFileReaderBenchmark())
+#endif
 
     DREAM3D_REGISTER_TEST(RemoveTestFiles())
   }
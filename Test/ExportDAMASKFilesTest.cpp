@@ -3,23 +3,55 @@
 // -----------------------------------------------------------------------------
 #pragma once
 
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <utility>
+
+#include <QtCore/QByteArray>
+#include <QtCore/QDir>
 #include <QtCore/QFile>
 
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
 #include "SIMPLib/Filtering/FilterFactory.hpp"
 #include "SIMPLib/Filtering/FilterManager.h"
 #include "SIMPLib/Filtering/FilterPipeline.h"
 #include "SIMPLib/Filtering/QMetaObjectUtilities.h"
 #include "SIMPLib/Plugin/ISIMPLibPlugin.h"
 #include "SIMPLib/Plugin/SIMPLibPluginLoader.h"
+#include "SIMPLib/Geometry/ImageGeom.h"
+#include "SIMPLib/Math/SIMPLibMath.h"
+
+#include "SimulationIO/SimulationIOFilters/ExportDAMASKFiles.h"
+#include "SimulationIO/SimulationIOFilters/Utility/DamaskFileWriter.h"
 
 #include "UnitTestSupport.hpp"
 
+#include "SimulationIOTestHelpers.hpp"
+
 #include "SimulationIOTestFileLocations.h"
 
 class ExportDAMASKFilesTest
 {
+  const QString k_DataContainerName = {"ImageDataContainer"};
+  const QString k_CellAMName = {"CellData"};
+  const QString k_FeatureIdsName = {"FeatureIds"};
+  const QString k_PhasesName = {"Phases"};
+  const QString k_EulersName = {"EulerAngles"};
+  const QString k_OutputPath = UnitTest::TestTempDir + "/ExportDAMASKFilesTest";
+  const QString k_GeometryFileName = {"DAMASKTest"};
+  const QString k_GeomFile = k_OutputPath + "/DAMASKTest.geom";
+  const QString k_MaterialFile = k_OutputPath + "/material.config";
+  const QString k_VtiFile = k_OutputPath + "/DAMASKTest.vti";
+  const QString k_MaterialYamlFile = k_OutputPath + "/material.yaml";
 
 public:
   ExportDAMASKFilesTest() = default;
@@ -37,6 +69,11 @@ public:
 #if REMOVE_TEST_FILES
     QFile::remove(UnitTest::ExportDAMASKFilesTest::TestFile1);
     QFile::remove(UnitTest::ExportDAMASKFilesTest::TestFile2);
+    QFile::remove(k_GeomFile);
+    QFile::remove(k_MaterialFile);
+    QFile::remove(k_VtiFile);
+    QFile::remove(k_MaterialYamlFile);
+    QDir().rmdir(k_OutputPath);
 #endif
   }
 
@@ -88,6 +125,455 @@ public:
     return EXIT_SUCCESS;
   }
 
+  // -----------------------------------------------------------------------------
+  DataContainerArray::Pointer CreateDataContainerArray(size_t xDim, size_t yDim, size_t zDim, int32_t numGrains)
+  {
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    AttributeMatrix::Pointer cellAM =
+        SimulationIOTestHelpers::CreateImageDataContainer(dca, k_DataContainerName, k_CellAMName, SizeVec3Type(xDim, yDim, zDim), FloatVec3Type(0.25f, 1.5f, 0.1f), FloatVec3Type(-1.0f, 2.5f, 0.0f));
+
+    size_t totalPoints = xDim * yDim * zDim;
+    Int32ArrayType::Pointer featureIds = Int32ArrayType::CreateArray(totalPoints, std::vector<size_t>{1}, k_FeatureIdsName, true);
+    Int32ArrayType::Pointer phases = Int32ArrayType::CreateArray(totalPoints, std::vector<size_t>{1}, k_PhasesName, true);
+    FloatArrayType::Pointer eulers = FloatArrayType::CreateArray(totalPoints, std::vector<size_t>{3}, k_EulersName, true);
+
+    // Negative angles and grain 0 are included on purpose, the formatting must match printf for both
+    std::mt19937 generator(5489u);
+    std::uniform_int_distribution<int32_t> grainDistribution(0, numGrains);
+    std::uniform_real_distribution<float> angleDistribution(-7.0f, 7.0f);
+    for(size_t i = 0; i < totalPoints; i++)
+    {
+      int32_t grainId = grainDistribution(generator);
+      featureIds->setValue(i, grainId);
+      phases->setValue(i, grainId % 3 + 1);
+      eulers->setComponent(i, 0, angleDistribution(generator));
+      eulers->setComponent(i, 1, angleDistribution(generator));
+      eulers->setComponent(i, 2, angleDistribution(generator));
+    }
+
+    cellAM->insertOrAssign(featureIds);
+    cellAM->insertOrAssign(phases);
+    cellAM->insertOrAssign(eulers);
+
+    return dca;
+  }
+
+  // -----------------------------------------------------------------------------
+  ExportDAMASKFiles::Pointer CreateFilter(const DataContainerArray::Pointer& dca, int32_t dataFormat, bool compress)
+  {
+    ExportDAMASKFiles::Pointer filter = ExportDAMASKFiles::New();
+    filter->setDataContainerArray(dca);
+    filter->setDataFormat(dataFormat);
+    filter->setOutputPath(k_OutputPath);
+    filter->setGeometryFileName(k_GeometryFileName);
+    filter->setHomogenizationIndex(3);
+    filter->setCompressGeomFile(compress);
+    filter->setFeatureIdsArrayPath(DataArrayPath(k_DataContainerName, k_CellAMName, k_FeatureIdsName));
+    filter->setCellPhasesArrayPath(DataArrayPath(k_DataContainerName, k_CellAMName, k_PhasesName));
+    filter->setCellEulerAnglesArrayPath(DataArrayPath(k_DataContainerName, k_CellAMName, k_EulersName));
+    return filter;
+  }
+
+  // -----------------------------------------------------------------------------
+  template <typename... Args>
+  void AppendFormatted(std::string& text, const char* format, Args... args)
+  {
+    char line[256];
+    int count = std::snprintf(line, sizeof(line), format, args...);
+    text.append(line, static_cast<size_t>(count));
+  }
+
+  /**
+   * @brief Builds the .geom and material.config text the way the filter wrote them with one fprintf per value
+   */
+  std::pair<std::string, std::string> CreateExpectedFiles(const DataContainerArray::Pointer& dca, int32_t dataFormat, bool compress)
+  {
+    ImageGeom::Pointer imageGeom = dca->getDataContainer(k_DataContainerName)->getGeometryAs<ImageGeom>();
+    AttributeMatrix::Pointer cellAM = dca->getAttributeMatrix(DataArrayPath(k_DataContainerName, k_CellAMName, ""));
+    Int32ArrayType::Pointer featureIds = cellAM->getAttributeArrayAs<Int32ArrayType>(k_FeatureIdsName);
+    Int32ArrayType::Pointer phases = cellAM->getAttributeArrayAs<Int32ArrayType>(k_PhasesName);
+    FloatArrayType::Pointer eulers = cellAM->getAttributeArrayAs<FloatArrayType>(k_EulersName);
+
+    SizeVec3Type dims = imageGeom->getDimensions();
+    FloatVec3Type spacing = imageGeom->getSpacing();
+    FloatVec3Type origin = imageGeom->getOrigin();
+    int32_t totalPoints = static_cast<int32_t>(imageGeom->getNumberOfElements());
+    float size[3] = {dims[0] * spacing[0], dims[1] * spacing[1], dims[2] * spacing[2]};
+
+    // The last voxel of a grain provides its phase and orientation, grains without voxels get zeros
+    int32_t maxGrainId = *std::max_element(featureIds->begin(), featureIds->end());
+    std::vector<int64_t> lastVoxel(maxGrainId + 1, -1);
+    for(int32_t i = 0; i < totalPoints; i++)
+    {
+      lastVoxel[featureIds->getValue(i)] = i;
+    }
+
+    std::string geom;
+    geom += "6       header\n# Generated by DREAM.3D\n";
+    AppendFormatted(geom, "grid    a %zu    b %zu    c %zu\n", dims[0], dims[1], dims[2]);
+    AppendFormatted(geom, "size    x %.3f    y %.3f    z %.3f\n", size[0], size[1], size[2]);
+    AppendFormatted(geom, "origin    x %.3f    y %.3f    z %.3f\n", origin[0], origin[1], origin[2]);
+    AppendFormatted(geom, "homogenization  %d\n", 3);
+    AppendFormatted(geom, "microstructures %d\n", dataFormat == 0 ? totalPoints : maxGrainId);
+    if(dataFormat == 0 && compress)
+    {
+      AppendFormatted(geom, "1 to %10d", totalPoints);
+    }
+    else
+    {
+      for(int32_t i = 0; i < totalPoints; i++)
+      {
+        if(i != 0)
+        {
+          geom += (i % dims[0] != 0) ? " " : "\n";
+        }
+        AppendFormatted(geom, "%10d", dataFormat == 0 ? i + 1 : featureIds->getValue(i));
+      }
+    }
+
+    std::string material;
+    material += "#############################################################################\n";
+    material += "# Generated by DREAM.3D\n";
+    material += "#############################################################################\n";
+    material += "# Add <homogenization>, <crystallite>, and <phase> for a complete definition\n";
+    material += "#############################################################################\n";
+    const char* label = dataFormat == 0 ? "point" : "grain";
+    int32_t numSections = dataFormat == 0 ? totalPoints : maxGrainId;
+    material += "<texture>\n";
+    for(int32_t i = 1; i <= numSections; i++)
+    {
+      int64_t voxel = dataFormat == 0 ? i - 1 : lastVoxel[i];
+      double angles[3] = {0.0, 0.0, 0.0};
+      for(size_t c = 0; c < 3 && voxel >= 0; c++)
+      {
+        double degrees = eulers->getComponent(voxel, c) * 180.0 * SIMPLib::Constants::k_1OverPiD;
+        angles[c] = dataFormat == 0 ? degrees : static_cast<float>(degrees);
+      }
+      AppendFormatted(material, "[%s%d]\n", label, i);
+      AppendFormatted(material, "(gauss) phi1 %.3f   Phi %.3f    phi2 %.3f   scatter 0.0   fraction 1.0 \n", angles[0], angles[1], angles[2]);
+    }
+    material += "<microstructure>\n";
+    for(int32_t i = 1; i <= numSections; i++)
+    {
+      int64_t voxel = dataFormat == 0 ? i - 1 : lastVoxel[i];
+      AppendFormatted(material, "[%s%d]\ncrystallite 1\n", label, i);
+      AppendFormatted(material, "(constituent)   phase %d texture %d fraction 1.0\n", voxel >= 0 ? phases->getValue(voxel) : 0, i);
+    }
+
+    return {geom, material};
+  }
+
+  // -----------------------------------------------------------------------------
+  int TestOutputMatchesPrintf()
+  {
+    // 2D and 3D grids, with rows that are longer than one formatting block
+    const std::vector<SizeVec3Type> gridSizes = {SizeVec3Type(7, 5, 4), SizeVec3Type(1, 1, 1), SizeVec3Type(300001, 2, 1), SizeVec3Type(600, 700, 1)};
+    for(const SizeVec3Type& dims : gridSizes)
+    {
+      DataContainerArray::Pointer dca = CreateDataContainerArray(dims[0], dims[1], dims[2], 50);
+      for(int32_t dataFormat : {0, 1})
+      {
+        for(bool compress : {false, true})
+        {
+          // Compressed grainwise grids are checked by TestCompressedGrainwiseRoundTrip
+          if(dataFormat == 1 && compress)
+          {
+            continue;
+          }
+          ExportDAMASKFiles::Pointer filter = CreateFilter(dca, dataFormat, compress);
+          filter->execute();
+          DREAM3D_REQUIRED(filter->getErrorCode(), >=, 0)
+
+          std::pair<std::string, std::string> expected = CreateExpectedFiles(dca, dataFormat, compress);
+          std::string geom = SimulationIOTestHelpers::ReadFile(k_GeomFile);
+          std::string material = SimulationIOTestHelpers::ReadFile(k_MaterialFile);
+          DREAM3D_REQUIRE_EQUAL(geom.size(), expected.first.size())
+          DREAM3D_REQUIRE(geom == expected.first)
+          DREAM3D_REQUIRE_EQUAL(material.size(), expected.second.size())
+          DREAM3D_REQUIRE(material == expected.second)
+        }
+      }
+    }
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  void SetBlockGrains(const DataContainerArray::Pointer& dca, size_t grainSize)
+  {
+    ImageGeom::Pointer imageGeom = dca->getDataContainer(k_DataContainerName)->getGeometryAs<ImageGeom>();
+    Int32ArrayType::Pointer featureIds = dca->getAttributeMatrix(DataArrayPath(k_DataContainerName, k_CellAMName, ""))->getAttributeArrayAs<Int32ArrayType>(k_FeatureIdsName);
+    SizeVec3Type dims = imageGeom->getDimensions();
+    size_t grainsX = (dims[0] + grainSize - 1) / grainSize;
+    size_t grainsY = (dims[1] + grainSize - 1) / grainSize;
+    for(size_t z = 0; z < dims[2]; z++)
+    {
+      for(size_t y = 0; y < dims[1]; y++)
+      {
+        for(size_t x = 0; x < dims[0]; x++)
+        {
+          size_t grainId = 1 + x / grainSize + (y / grainSize) * grainsX + (z / grainSize) * grainsX * grainsY;
+          featureIds->setValue((z * dims[1] + y) * dims[0] + x, static_cast<int32_t>(grainId));
+        }
+      }
+    }
+  }
+
+  /**
+   * @brief Expands the grid of a .geom file the way DAMASK reads it: "n of id" and "a to b" are only recognized
+   * in lines with three entries, every other line is a plain list of ids
+   */
+  std::vector<int32_t> DecodeGeomGrid(const std::string& geom)
+  {
+    std::vector<int32_t> ids;
+    std::istringstream stream(geom);
+    std::string line;
+    std::getline(stream, line);
+    size_t numHeaderLines = std::stoul(line);
+    for(size_t i = 0; i < numHeaderLines; i++)
+    {
+      std::getline(stream, line);
+    }
+    while(std::getline(stream, line))
+    {
+      std::istringstream lineStream(line);
+      std::vector<std::string> items;
+      std::string item;
+      while(lineStream >> item)
+      {
+        items.push_back(item);
+      }
+      if(items.size() == 3 && items[1] == "of")
+      {
+        ids.insert(ids.end(), std::stoul(items[0]), std::stoi(items[2]));
+      }
+      else if(items.size() == 3 && items[1] == "to")
+      {
+        for(int64_t id = std::stoll(items[0]); id <= std::stoll(items[2]); id++)
+        {
+          ids.push_back(static_cast<int32_t>(id));
+        }
+      }
+      else
+      {
+        for(const std::string& value : items)
+        {
+          ids.push_back(std::stoi(value));
+        }
+      }
+    }
+    return ids;
+  }
+
+  // -----------------------------------------------------------------------------
+  int TestCompressedGrainwiseRoundTrip()
+  {
+    // Short rows, runs, ranges, runs of two and ids at the ends of the int32_t range
+    const std::vector<std::vector<int32_t>> rows = {{},
+                                                    {4},
+                                                    {5, 5},
+                                                    {5, 5, 5, 5, 7, 8, 2, 2, 3, 4, 5, 9, 9, 9},
+                                                    {1, 2, 3, 3, 3, 2, 1, 0},
+                                                    {2147483645, 2147483646, 2147483647, -2147483647 - 1, -2147483647 - 1, -2147483647 - 1}};
+    for(const std::vector<int32_t>& row : rows)
+    {
+      std::string text = "0 header\n";
+      DamaskFileWriter::appendCompressedRow(text, row.data(), row.size());
+      DREAM3D_REQUIRE(DecodeGeomGrid(text) == row)
+    }
+
+    std::mt19937 generator(5489u);
+    for(size_t trial = 0; trial < 10000; trial++)
+    {
+      std::vector<int32_t> row(generator() % 64);
+      int32_t id = 1;
+      for(int32_t& value : row)
+      {
+        uint32_t step = generator() % 4;
+        id = (step == 0) ? static_cast<int32_t>(generator() % 20) : (step == 1) ? id + 1 : id;
+        value = id;
+      }
+      std::string text = "0 header\n";
+      DamaskFileWriter::appendCompressedRow(text, row.data(), row.size());
+      DREAM3D_REQUIRE(DecodeGeomGrid(text) == row)
+    }
+
+    // The whole file, for random ids and for grains spanning many rows
+    for(size_t grainSize : {0, 1, 13})
+    {
+      DataContainerArray::Pointer dca = CreateDataContainerArray(37, 11, 5, 50);
+      if(grainSize > 0)
+      {
+        SetBlockGrains(dca, grainSize);
+      }
+      ExportDAMASKFiles::Pointer filter = CreateFilter(dca, 1, true);
+      filter->execute();
+      DREAM3D_REQUIRED(filter->getErrorCode(), >=, 0)
+
+      Int32ArrayType::Pointer featureIds = dca->getAttributeMatrix(DataArrayPath(k_DataContainerName, k_CellAMName, ""))->getAttributeArrayAs<Int32ArrayType>(k_FeatureIdsName);
+      std::vector<int32_t> expected(featureIds->begin(), featureIds->end());
+      std::string geom = SimulationIOTestHelpers::ReadFile(k_GeomFile);
+      DREAM3D_REQUIRE(DecodeGeomGrid(geom) == expected)
+
+      // Only the grid differs from the uncompressed file
+      std::pair<std::string, std::string> uncompressed = CreateExpectedFiles(dca, 1, false);
+      size_t headerLength = uncompressed.first.find("microstructures");
+      headerLength = uncompressed.first.find('\n', headerLength) + 1;
+      DREAM3D_REQUIRE(geom.compare(0, headerLength, uncompressed.first, 0, headerLength) == 0)
+      DREAM3D_REQUIRE(SimulationIOTestHelpers::ReadFile(k_MaterialFile) == uncompressed.second)
+    }
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  int TestCompressedGeomBenchmark()
+  {
+    DataContainerArray::Pointer dca = CreateDataContainerArray(200, 200, 200, 1);
+    SetBlockGrains(dca, 20);
+
+    for(bool compress : {false, true})
+    {
+      ExportDAMASKFiles::Pointer filter = CreateFilter(dca, 1, compress);
+
+      auto start = std::chrono::steady_clock::now();
+      filter->execute();
+      auto end = std::chrono::steady_clock::now();
+      DREAM3D_REQUIRED(filter->getErrorCode(), >=, 0)
+
+      std::cout << "ExportDAMASKFiles grainwise 200x200x200 / 20^3 grains / compressed " << compress << ": " << QFile(k_GeomFile).size() << " bytes, "
+                << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << " ms" << std::endl;
+    }
+
+    return EXIT_SUCCESS;
+  }
+
+  /**
+   * @brief Reads the "material" array from the appended data of a .vti file, raw or zlib compressed
+   */
+  std::vector<int32_t> ReadVtiMaterial(const std::string& vti)
+  {
+    const std::string marker = "<AppendedData encoding=\"raw\">\n   _";
+    size_t start = vti.find(marker);
+    if(start == std::string::npos)
+    {
+      return {};
+    }
+    const char* data = vti.data() + start + marker.size();
+    auto readHeader = [data](size_t index) {
+      uint64_t value = 0;
+      std::memcpy(&value, data + index * sizeof(uint64_t), sizeof(uint64_t));
+      return value;
+    };
+
+    std::vector<int32_t> values;
+    if(vti.find("compressor=\"vtkZLibDataCompressor\"") == std::string::npos)
+    {
+      values.resize(readHeader(0) / sizeof(int32_t));
+      std::memcpy(values.data(), data + sizeof(uint64_t), values.size() * sizeof(int32_t));
+      return values;
+    }
+
+    uint64_t numBlocks = readHeader(0);
+    size_t offset = (3 + numBlocks) * sizeof(uint64_t);
+    for(uint64_t block = 0; block < numBlocks; block++)
+    {
+      uint64_t blockSize = (block + 1 == numBlocks && readHeader(2) != 0) ? readHeader(2) : readHeader(1);
+      uint64_t compressedSize = readHeader(3 + block);
+      // qUncompress expects the uncompressed size as a big endian prefix
+      QByteArray compressed(4, '\0');
+      compressed[0] = static_cast<char>((blockSize >> 24) & 0xFF);
+      compressed[1] = static_cast<char>((blockSize >> 16) & 0xFF);
+      compressed[2] = static_cast<char>((blockSize >> 8) & 0xFF);
+      compressed[3] = static_cast<char>(blockSize & 0xFF);
+      compressed.append(data + offset, static_cast<int>(compressedSize));
+      QByteArray uncompressed = qUncompress(compressed);
+      size_t previous = values.size();
+      values.resize(previous + uncompressed.size() / sizeof(int32_t));
+      std::memcpy(values.data() + previous, uncompressed.constData(), uncompressed.size());
+      offset += compressedSize;
+    }
+    return values;
+  }
+
+  // -----------------------------------------------------------------------------
+  int TestVtkOutput()
+  {
+    // More cells than one compressed block, and grain 0 which becomes material 0
+    DataContainerArray::Pointer dca = CreateDataContainerArray(300, 200, 7, 50);
+    AttributeMatrix::Pointer cellAM = dca->getAttributeMatrix(DataArrayPath(k_DataContainerName, k_CellAMName, ""));
+    Int32ArrayType::Pointer featureIds = cellAM->getAttributeArrayAs<Int32ArrayType>(k_FeatureIdsName);
+    Int32ArrayType::Pointer phases = cellAM->getAttributeArrayAs<Int32ArrayType>(k_PhasesName);
+    const size_t totalPoints = featureIds->getNumberOfTuples();
+    const int32_t maxGrainId = *std::max_element(featureIds->begin(), featureIds->end());
+
+    for(int32_t dataFormat : {0, 1})
+    {
+      std::vector<int32_t> expected(featureIds->begin(), featureIds->end());
+      if(dataFormat == 0)
+      {
+        for(size_t i = 0; i < totalPoints; i++)
+        {
+          expected[i] = static_cast<int32_t>(i);
+        }
+      }
+
+      for(bool compress : {false, true})
+      {
+        ExportDAMASKFiles::Pointer filter = CreateFilter(dca, dataFormat, compress);
+        filter->setFileFormat(1);
+        filter->execute();
+        DREAM3D_REQUIRED(filter->getErrorCode(), >=, 0)
+
+        std::string vti = SimulationIOTestHelpers::ReadFile(k_VtiFile);
+        DREAM3D_REQUIRE(vti.find("<ImageData WholeExtent=\"0 300 0 200 0 7\" Origin=\"-1 2.5 0\" Spacing=\"0.25 1.5 0.100000001\">") != std::string::npos)
+        DREAM3D_REQUIRE(ReadVtiMaterial(vti) == expected)
+        DREAM3D_REQUIRE_EQUAL(vti.compare(vti.size() - 29, 29, "\n  </AppendedData>\n</VTKFile>\n"), 0)
+
+        // One material per line, each referring to the phase of its cell or grain
+        std::string yaml = SimulationIOTestHelpers::ReadFile(k_MaterialYamlFile);
+        size_t numMaterials = 0;
+        for(size_t pos = yaml.find("\n  - {homogenization: "); pos != std::string::npos; pos = yaml.find("\n  - {homogenization: ", pos + 1))
+        {
+          numMaterials++;
+        }
+        DREAM3D_REQUIRE_EQUAL(numMaterials, dataFormat == 0 ? totalPoints : static_cast<size_t>(maxGrainId) + 1)
+        DREAM3D_REQUIRE(yaml.find("homogenization:\n  Homogenization_3: {N_constituents: 1}\n") != std::string::npos)
+        std::string phase = "  Phase_" + std::to_string(phases->getValue(0)) + ": {}\n";
+        DREAM3D_REQUIRE(yaml.find(phase) != std::string::npos)
+      }
+    }
+
+    // The quaternion follows the DAMASK convention, phi1 = 0.1, Phi = 0.2, phi2 = 0.3 is (0.975, 0.099, -0.010, 0.198)
+    FeatureAggregator::FeatureData grains;
+    grains.maxFeatureId = 1;
+    grains.phases = {0, 2};
+    grains.eulerAngles = {0.0f, 0.0f, 0.0f, 0.1f, 0.2f, 0.3f};
+    grains.voxelCounts = {0, 1};
+    DREAM3D_REQUIRE(DamaskFileWriter::writeGrainwiseMaterialYaml(nullptr, k_MaterialYamlFile, 1, grains, 1))
+    std::string yaml = SimulationIOTestHelpers::ReadFile(k_MaterialYamlFile);
+    DREAM3D_REQUIRE(yaml.find("  - {homogenization: Homogenization_1, constituents: [{phase: Phase_0, v: 1.0, O: [1.000000000, 0.000000000, 0.000000000, 0.000000000]}]}\n") != std::string::npos)
+    DREAM3D_REQUIRE(yaml.find("  - {homogenization: Homogenization_1, constituents: [{phase: Phase_2, v: 1.0, O: [0.975170326, 0.099334667, -0.009966712, 0.197676818]}]}\n") != std::string::npos)
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  int TestPointwiseBenchmark()
+  {
+    DataContainerArray::Pointer dca = CreateDataContainerArray(200, 200, 100, 5000);
+    ExportDAMASKFiles::Pointer filter = CreateFilter(dca, 0, false);
+
+    auto start = std::chrono::steady_clock::now();
+    filter->execute();
+    auto end = std::chrono::steady_clock::now();
+    DREAM3D_REQUIRED(filter->getErrorCode(), >=, 0)
+
+    std::cout << "ExportDAMASKFiles pointwise 200x200x100: " << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << " ms" << std::endl;
+
+    return EXIT_SUCCESS;
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -98,6 +584,13 @@ public:
     DREAM3D_REGISTER_TEST(TestFilterAvailability());
 
     DREAM3D_REGISTER_TEST(TestExportDAMASKFilesTest())
+    DREAM3D_REGISTER_TEST(TestOutputMatchesPrintf())
+    DREAM3D_REGISTER_TEST(TestCompressedGrainwiseRoundTrip())
+    DREAM3D_REGISTER_TEST(TestVtkOutput())
+#ifdef SimulationIO_ENABLE_BENCHMARKS
+    DREAM3D_REGISTER_TEST(TestPointwiseBenchmark())
+    DREAM3D_REGISTER_TEST(TestCompressedGeomBenchmark())
+#endif
 
     DREAM3D_REGISTER_TEST(RemoveTestFiles())
   }
@@ -0,0 +1,516 @@
+// -----------------------------------------------------------------------------
+// Insert your license & copyright information here
+// -----------------------------------------------------------------------------
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QTextStream>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataArrays/StringDataArray.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/FilterParameters/DynamicTableData.h"
+#include "SIMPLib/Filtering/FilterManager.h"
+#include "SIMPLib/Filtering/IFilterFactory.hpp"
+#include "SIMPLib/Geometry/ImageGeom.h"
+#include "SIMPLib/Math/SIMPLibMath.h"
+
+#include "SimulationIO/SimulationIOFilters/ExportMultiOnScaleTableFile.h"
+#include "SimulationIO/SimulationIOFilters/ExportOnScaleTableFile.h"
+#include "SimulationIO/SimulationIOFilters/Utility/NumberFormatter.hpp"
+#include "SimulationIO/SimulationIOFilters/Utility/OnScaleTableFileWriter.h"
+
+#include "UnitTestSupport.hpp"
+
+#include "SimulationIOTestHelpers.hpp"
+
+#include "SimulationIOTestFileLocations.h"
+
+class ExportOnScaleTableFileTest
+{
+  const QString k_DataContainerName = {"ImageDataContainer"};
+  const QString k_CellAMName = {"CellData"};
+  const QString k_EnsembleAMName = {"CellEnsembleData"};
+  const QString k_FeatureIdsName = {"FeatureIds"};
+  const QString k_PhaseNamesName = {"PhaseNames"};
+  const QString k_FilePrefix = {"OnScaleExportTest"};
+  const QString k_TestFile = UnitTest::TestTempDir + "/OnScaleExportTest.flxtbl";
+  const QString k_BenchmarkFile = UnitTest::TestTempDir + "/OnScaleBenchmark.txt";
+  const QString k_SweepPrefix = {"OnScaleSweep_"};
+  const QString k_MultiSerialDir = UnitTest::TestTempDir + "/OnScaleMultiSerial";
+  const QString k_MultiParallelDir = UnitTest::TestTempDir + "/OnScaleMultiParallel";
+  const QString k_RotatedDir = UnitTest::TestTempDir + "/OnScaleRotated";
+  const QString k_RotatedReferenceDir = UnitTest::TestTempDir + "/OnScaleRotatedReference";
+  const int32_t k_NumSweepContainers = 12;
+
+public:
+  ExportOnScaleTableFileTest() = default;
+  ~ExportOnScaleTableFileTest() = default;
+  ExportOnScaleTableFileTest(const ExportOnScaleTableFileTest&) = delete;            // Copy Constructor
+  ExportOnScaleTableFileTest(ExportOnScaleTableFileTest&&) = delete;                 // Move Constructor
+  ExportOnScaleTableFileTest& operator=(const ExportOnScaleTableFileTest&) = delete; // Copy Assignment
+  ExportOnScaleTableFileTest& operator=(ExportOnScaleTableFileTest&&) = delete;      // Move Assignment
+
+  // -----------------------------------------------------------------------------
+  void RemoveTestFiles()
+  {
+#if REMOVE_TEST_FILES
+    QFile::remove(k_TestFile);
+    QFile::remove(k_BenchmarkFile);
+    QDir(k_MultiSerialDir).removeRecursively();
+    QDir(k_MultiParallelDir).removeRecursively();
+    QDir(k_RotatedDir).removeRecursively();
+    QDir(k_RotatedReferenceDir).removeRecursively();
+#endif
+  }
+
+  // -----------------------------------------------------------------------------
+  int TestFilterAvailability()
+  {
+    // Now instantiate the ExportOnScaleTableFileTest Filter from the FilterManager
+    QString filtName = "ExportOnScaleTableFile";
+    FilterManager* fm = FilterManager::Instance();
+    IFilterFactory::Pointer filterFactory = fm->getFactoryFromClassName(filtName);
+    if(nullptr == filterFactory)
+    {
+      std::stringstream ss;
+      ss << "The ExportOnScaleTableFileTest Requires the use of the " << filtName.toStdString() << " filter which is found in the SimulationIO Plugin";
+      DREAM3D_TEST_THROW_EXCEPTION(ss.str())
+    }
+    return 0;
+  }
+
+  // -----------------------------------------------------------------------------
+  // Feature ids laid out as runs of random length so the material table resembles grain data
+  // -----------------------------------------------------------------------------
+  std::vector<int32_t> CreateFeatureIds(size_t totalPoints, int32_t numFeatures)
+  {
+    std::vector<int32_t> featureIds(totalPoints, 0);
+    std::mt19937 generator(5489u);
+    std::uniform_int_distribution<int32_t> featureDistribution(1, numFeatures);
+    std::uniform_int_distribution<size_t> runDistribution(1, 64);
+    size_t i = 0;
+    while(i < totalPoints)
+    {
+      int32_t featureId = featureDistribution(generator);
+      size_t end = std::min(totalPoints, i + runDistribution(generator));
+      for(; i < end; i++)
+      {
+        featureIds[i] = featureId;
+      }
+    }
+    return featureIds;
+  }
+
+  // -----------------------------------------------------------------------------
+  DataContainerArray::Pointer CreateDataContainerArray(size_t xDim, size_t yDim, size_t zDim, int32_t numFeatures)
+  {
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    AttributeMatrix::Pointer cellAM =
+        SimulationIOTestHelpers::CreateImageDataContainer(dca, k_DataContainerName, k_CellAMName, SizeVec3Type(xDim, yDim, zDim), FloatVec3Type(0.25f, 0.5f, 1.0f), FloatVec3Type(-1.0f, 0.0f, 2.0f));
+
+    std::vector<int32_t> values = CreateFeatureIds(xDim * yDim * zDim, numFeatures);
+    Int32ArrayType::Pointer featureIds = Int32ArrayType::CreateArray(values.size(), std::vector<size_t>{1}, k_FeatureIdsName, true);
+    std::copy(values.cbegin(), values.cend(), featureIds->begin());
+    cellAM->insertOrAssign(featureIds);
+
+    std::vector<size_t> ensembleDims = {static_cast<size_t>(numFeatures + 1)};
+    AttributeMatrix::Pointer ensembleAM = AttributeMatrix::New(ensembleDims, k_EnsembleAMName, AttributeMatrix::Type::CellEnsemble);
+    dca->getDataContainer(k_DataContainerName)->addOrReplaceAttributeMatrix(ensembleAM);
+
+    StringDataArray::Pointer phaseNames = StringDataArray::CreateArray(numFeatures + 1, k_PhaseNamesName, true);
+    for(int32_t i = 0; i <= numFeatures; i++)
+    {
+      phaseNames->setValue(i, QString("Material_%1").arg(i));
+    }
+    ensembleAM->insertOrAssign(phaseNames);
+
+    return dca;
+  }
+
+  // -----------------------------------------------------------------------------
+  // Adds image Data Containers of different sizes that share the prefix selected by ExportMultiOnScaleTableFile
+  // -----------------------------------------------------------------------------
+  void AddSweepDataContainers(const DataContainerArray::Pointer& dca, int32_t numFeatures)
+  {
+    for(int32_t i = 0; i < k_NumSweepContainers; i++)
+    {
+      SizeVec3Type dims(static_cast<size_t>(30 + i), 17, static_cast<size_t>(5 + (i % 4) * 9));
+      AttributeMatrix::Pointer cellAM = SimulationIOTestHelpers::CreateImageDataContainer(dca, k_SweepPrefix + QString::number(i), k_CellAMName, dims, FloatVec3Type(0.5f, 0.5f, 0.5f),
+                                                                                         FloatVec3Type(0.0f, 0.0f, 0.0f));
+
+      std::vector<int32_t> values = CreateFeatureIds(dims[0] * dims[1] * dims[2], numFeatures);
+      Int32ArrayType::Pointer featureIds = Int32ArrayType::CreateArray(values.size(), std::vector<size_t>{1}, k_FeatureIdsName, true);
+      std::copy(values.cbegin(), values.cend(), featureIds->begin());
+      cellAM->insertOrAssign(featureIds);
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  // Reference matr block using the original per-value QString formatting
+  // -----------------------------------------------------------------------------
+  void WriteReferenceMaterials(QTextStream& stream, const std::vector<int32_t>& featureIds)
+  {
+    for(size_t i = 0; i < featureIds.size(); i++)
+    {
+      if(i != 0)
+      {
+        stream << (((i % 40) != 0) ? " " : "\n");
+      }
+      stream << QString::number(featureIds[i]);
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  int TestMaterialTableOutput()
+  {
+    const int32_t numFeatures = 25;
+    DataContainerArray::Pointer dca = CreateDataContainerArray(41, 23, 7, numFeatures);
+
+    ExportOnScaleTableFile::Pointer filter = ExportOnScaleTableFile::New();
+    filter->setDataContainerArray(dca);
+    filter->setOutputPath(UnitTest::TestTempDir);
+    filter->setOutputFilePrefix(k_FilePrefix);
+    filter->setNumKeypoints(IntVec3Type(2, 2, 2));
+    filter->setPzflexFeatureIdsArrayPath(DataArrayPath(k_DataContainerName, k_CellAMName, k_FeatureIdsName));
+    filter->setPhaseNamesArrayPath(DataArrayPath(k_DataContainerName, k_EnsembleAMName, k_PhaseNamesName));
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCode(), >=, 0)
+
+    std::ifstream inFile(k_TestFile.toStdString(), std::ios_base::in | std::ios_base::binary);
+    std::stringstream contents;
+    contents << inFile.rdbuf();
+    std::string actual = contents.str();
+
+    size_t matrStart = actual.find("matr ");
+    DREAM3D_REQUIRE(matrStart != std::string::npos)
+    size_t tableStart = actual.find('\n', matrStart);
+    DREAM3D_REQUIRE(tableStart != std::string::npos)
+
+    QString expected;
+    QTextStream expectedStream(&expected);
+    WriteReferenceMaterials(expectedStream, CreateFeatureIds(41 * 23 * 7, numFeatures));
+    expectedStream.flush();
+
+    DREAM3D_REQUIRE(actual.substr(tableStart + 1) == expected.toStdString())
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  // The rotation writeOnScaleFile applied before it wrote through a grid view: 90 degree turns that sort the
+  // dimensions from largest to smallest, built and composed the same way
+  // -----------------------------------------------------------------------------
+  std::vector<std::vector<double>> ReferenceRotationTable(std::array<size_t, 3> dims)
+  {
+    using Matrix = std::array<std::array<float, 3>, 3>;
+    const float angle = static_cast<float>(SIMPLib::Constants::k_PiOver2D);
+    const float cosA = std::cos(angle);
+    const float sinA = std::sin(angle);
+    const Matrix aboutX = {{{1.0f, 0.0f, 0.0f}, {0.0f, cosA, -sinA}, {0.0f, sinA, cosA}}};
+    const Matrix aboutY = {{{cosA, 0.0f, sinA}, {0.0f, 1.0f, 0.0f}, {-sinA, 0.0f, cosA}}};
+    const Matrix aboutZ = {{{cosA, -sinA, 0.0f}, {sinA, cosA, 0.0f}, {0.0f, 0.0f, 1.0f}}};
+
+    Matrix rotation = {{{1.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f}, {0.0f, 0.0f, 1.0f}}};
+    auto applyRotation = [&rotation](const Matrix& turn) {
+      Matrix product = {};
+      for(size_t i = 0; i < 3; i++)
+      {
+        for(size_t j = 0; j < 3; j++)
+        {
+          for(size_t k = 0; k < 3; k++)
+          {
+            product[i][j] += turn[i][k] * rotation[k][j];
+          }
+        }
+      }
+      rotation = product;
+    };
+
+    std::array<size_t, 3> dimsSorted = dims;
+    std::sort(dimsSorted.begin(), dimsSorted.end(), std::greater<size_t>());
+    if(dims[0] != dimsSorted[0])
+    {
+      if(dims[1] == dimsSorted[0])
+      {
+        std::swap(dims[0], dims[1]);
+        applyRotation(aboutZ);
+      }
+      else
+      {
+        std::swap(dims[0], dims[2]);
+        applyRotation(aboutY);
+      }
+    }
+    if(dims[1] != dimsSorted[1])
+    {
+      std::swap(dims[1], dims[2]);
+      applyRotation(aboutX);
+    }
+
+    std::vector<std::vector<double>> table;
+    for(const std::array<float, 3>& row : rotation)
+    {
+      table.emplace_back(row.cbegin(), row.cend());
+    }
+    return table;
+  }
+
+  // -----------------------------------------------------------------------------
+  // Writes the table of the Data Container the way writeOnScaleFile did before it wrote through a grid view: deep
+  // copies of the geometry and the feature ids are rotated with RotateSampleRefFrame and written as they are
+  // -----------------------------------------------------------------------------
+  bool WriteReferenceRotatedFile(const DataContainerArray::Pointer& dca, const std::array<size_t, 3>& dims, const QString& outputPath)
+  {
+    DataContainer::Pointer dc = dca->getDataContainer(k_DataContainerName);
+    AttributeMatrix::Pointer matrix = dc->getAttributeMatrix(k_CellAMName);
+
+    DataContainerArray::Pointer dcaRotated = DataContainerArray::New();
+    DataContainer::Pointer dcRotated = DataContainer::New(dc->getName());
+    dcRotated->setGeometry(dc->getGeometry()->deepCopy());
+    AttributeMatrix::Pointer matrixRotated = AttributeMatrix::New(matrix->getTupleDimensions(), matrix->getName(), matrix->getType());
+    matrixRotated->addOrReplaceAttributeArray(matrix->getAttributeArray(k_FeatureIdsName)->deepCopy());
+    dcRotated->addOrReplaceAttributeMatrix(matrixRotated);
+    dcaRotated->addOrReplaceDataContainer(dcRotated);
+
+    if(!std::is_sorted(dims.cbegin(), dims.cend(), std::greater<size_t>()))
+    {
+      AbstractFilter::Pointer rotateFilter = FilterManager::Instance()->getFactoryFromClassName("RotateSampleRefFrame")->create();
+      rotateFilter->setDataContainerArray(dcaRotated);
+      QVariant value;
+      value.setValue(1);
+      rotateFilter->setProperty("RotationRepresentationChoice", value);
+      value.setValue(DynamicTableData(ReferenceRotationTable(dims)));
+      rotateFilter->setProperty("RotationTable", value);
+      value.setValue(DataArrayPath(k_DataContainerName, k_CellAMName, ""));
+      rotateFilter->setProperty("CellAttributeMatrixPath", value);
+      rotateFilter->execute();
+      if(rotateFilter->getErrorCode() < 0)
+      {
+        return false;
+      }
+    }
+
+    Int32ArrayType::Pointer featureIds = dcRotated->getAttributeMatrix(k_CellAMName)->getAttributeArrayAs<Int32ArrayType>(k_FeatureIdsName);
+    StringDataArray::Pointer phaseNames = dc->getAttributeMatrix(k_EnsembleAMName)->getAttributeArrayAs<StringDataArray>(k_PhaseNamesName);
+    ImageGeom::Pointer imageGeom = dcRotated->getGeometryAs<ImageGeom>();
+    if(featureIds == nullptr || phaseNames == nullptr || imageGeom == nullptr)
+    {
+      return false;
+    }
+
+    SizeVec3Type rotatedDims = imageGeom->getDimensions();
+    OnScaleTableFileWriter::PermutedGridView view;
+    view.sourceDims = {rotatedDims[0], rotatedDims[1], rotatedDims[2]};
+    return OnScaleTableFileWriter::write(imageGeom, *phaseNames, *featureIds, outputPath, k_FilePrefix, IntVec3Type(2, 2, 2), view).first >= 0;
+  }
+
+  // -----------------------------------------------------------------------------
+  // Dimensions that are not sorted from largest to smallest are written rotated into that order. Every order of the
+  // dimensions must give the same file, coordinates included, as rotating a copy of the data with RotateSampleRefFrame.
+  // -----------------------------------------------------------------------------
+  int TestRotatedOutput()
+  {
+    if(FilterManager::Instance()->getFactoryFromClassName("RotateSampleRefFrame") == nullptr)
+    {
+      DREAM3D_TEST_THROW_EXCEPTION("TestRotatedOutput compares against the RotateSampleRefFrame filter, which is found in the Sampling Plugin")
+    }
+    QDir().mkpath(k_RotatedDir);
+    QDir().mkpath(k_RotatedReferenceDir);
+
+    const int32_t numFeatures = 25;
+    std::array<size_t, 3> dims = {7, 23, 41};
+    do
+    {
+      DataContainerArray::Pointer dca = CreateDataContainerArray(dims[0], dims[1], dims[2], numFeatures);
+
+      ExportOnScaleTableFile::Pointer filter = ExportOnScaleTableFile::New();
+      filter->setDataContainerArray(dca);
+      filter->setOutputPath(k_RotatedDir);
+      filter->setOutputFilePrefix(k_FilePrefix);
+      filter->setNumKeypoints(IntVec3Type(2, 2, 2));
+      filter->setPzflexFeatureIdsArrayPath(DataArrayPath(k_DataContainerName, k_CellAMName, k_FeatureIdsName));
+      filter->setPhaseNamesArrayPath(DataArrayPath(k_DataContainerName, k_EnsembleAMName, k_PhaseNamesName));
+      filter->execute();
+      DREAM3D_REQUIRED(filter->getErrorCode(), >=, 0)
+      std::string actual = SimulationIOTestHelpers::ReadFile(k_RotatedDir + "/" + k_FilePrefix + ".flxtbl");
+      DREAM3D_REQUIRE(actual.find("divisions\n41 23 7\n") != std::string::npos)
+
+      DREAM3D_REQUIRE(WriteReferenceRotatedFile(dca, dims, k_RotatedReferenceDir))
+      std::string expected = SimulationIOTestHelpers::ReadFile(k_RotatedReferenceDir + "/" + k_FilePrefix + ".flxtbl");
+      DREAM3D_REQUIRE(actual == expected)
+    } while(std::next_permutation(dims.begin(), dims.end()));
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  // Canceling stops the material table between chunks
+  // -----------------------------------------------------------------------------
+  int TestCanceledMaterialTable()
+  {
+    std::vector<int32_t> featureIds = CreateFeatureIds(OnScaleTableFileWriter::k_EntriesPerChunk * 4, 25);
+    QFile file(k_TestFile);
+    DREAM3D_REQUIRE(file.open(QIODevice::WriteOnly))
+    size_t numChecks = 0;
+    auto stopAfterFirstChunk = [&numChecks]() { return ++numChecks > 1; };
+    DREAM3D_REQUIRE(!OnScaleTableFileWriter::writeMaterials(file, featureIds.data(), featureIds.size(), 2, stopAfterFirstChunk))
+    file.close();
+    DREAM3D_REQUIRE_EQUAL(numChecks, 2)
+    DREAM3D_REQUIRED(file.size(), <, static_cast<qint64>(featureIds.size()))
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  // The coordinates were written with QString::number(value, 'E', 8), so appendScientific must match it byte for byte
+  // -----------------------------------------------------------------------------
+  int TestNumberFormatter()
+  {
+    std::vector<double> values = {
+        // Exact ties of the 10th significant digit, which QString::number rounds away from zero
+        1234567885.0, -1234567885.0, 12345678.25, -12345678.25, 1021.0 / 1024.0, -1021.0 / 1024.0, 3.0 / 1024.0,
+        // Ties and near ties that carry into the exponent
+        9999999995.0, -9999999995.0, 9.999999995e10, 9.999999995e-10, -9.999999995e-10, 9.999999995e99, 9.999999995e-99,
+        // Rounding up to 10^100 needs a third exponent digit
+        9.9999999996e99, -9.9999999996e99, 9.9999999996e-100,
+        // Denormals
+        std::numeric_limits<double>::denorm_min(), -std::numeric_limits<double>::denorm_min(), std::numeric_limits<double>::min() / 3.0, 4.9406564584124654e-320,
+        // Zeros, whose sign QString::number drops
+        0.0, -0.0,
+        // Ordinary values
+        1.0, -1.0, 0.1, -0.25, 123.456, -1.0e-5, 6.02214076e23, std::numeric_limits<double>::max(), std::numeric_limits<double>::lowest()};
+
+    std::mt19937_64 generator(42);
+    std::uniform_int_distribution<int64_t> ties(1000000000, 9999999999);
+    std::uniform_real_distribution<double> mantissas(-10.0, 10.0);
+    std::uniform_int_distribution<int32_t> exponents(-320, 300);
+    for(size_t i = 0; i < 5000; i++)
+    {
+      values.push_back(static_cast<double>(ties(generator) / 10 * 10 + 5));
+      values.push_back(mantissas(generator) * std::pow(10.0, exponents(generator)));
+    }
+
+    for(double value : values)
+    {
+      std::string buffer;
+      NumberFormatter::appendScientific<8>(buffer, value);
+      DREAM3D_REQUIRE(QString::fromStdString(buffer) == QString::number(value, 'E', 8))
+    }
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  int TestMaterialTableBenchmark()
+  {
+    std::vector<int32_t> featureIds = CreateFeatureIds(256 * 256 * 256, 20000);
+
+    auto benchmark = [this](const std::string& label, const std::function<bool(QFile&)>& writer) {
+      QFile file(k_BenchmarkFile);
+      if(!file.open(QIODevice::WriteOnly))
+      {
+        return false;
+      }
+      auto start = std::chrono::steady_clock::now();
+      bool success = writer(file);
+      file.close();
+      auto end = std::chrono::steady_clock::now();
+      double seconds = std::chrono::duration<double>(end - start).count();
+      double megabytes = static_cast<double>(QFile(k_BenchmarkFile).size()) / (1024.0 * 1024.0);
+      std::cout << label << ": " << megabytes << " MB in " << seconds << " s (" << megabytes / seconds << " MB/s)" << std::endl;
+      return success;
+    };
+
+    bool success = benchmark("QTextStream matr (256^3)", [&](QFile& file) {
+      QTextStream stream(&file);
+      WriteReferenceMaterials(stream, featureIds);
+      stream.flush();
+      return stream.status() == QTextStream::Ok;
+    });
+    DREAM3D_REQUIRE(success)
+
+    for(int32_t numThreads : {1, 0})
+    {
+      std::string label = "Streaming matr (256^3, " + std::to_string(numThreads) + " threads)";
+      success = benchmark(label, [&](QFile& file) { return OnScaleTableFileWriter::writeMaterials(file, featureIds.data(), featureIds.size(), numThreads); });
+      DREAM3D_REQUIRE(success)
+    }
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  // Concurrent exports under a tight memory budget must write the same files as the serial export
+  // -----------------------------------------------------------------------------
+  int TestMultiExportOutput()
+  {
+    const int32_t numFeatures = 25;
+    DataContainerArray::Pointer dca = CreateDataContainerArray(4, 4, 4, numFeatures);
+    AddSweepDataContainers(dca, numFeatures);
+
+    auto runExport = [&](const QString& outputPath, int numWorkers, int memoryBudget) {
+      ExportMultiOnScaleTableFile::Pointer filter = ExportMultiOnScaleTableFile::New();
+      filter->setDataContainerArray(dca);
+      filter->setOutputPath(outputPath);
+      filter->setDataContainerPrefix(k_SweepPrefix);
+      filter->setMatrixName(k_CellAMName);
+      filter->setArrayName(k_FeatureIdsName);
+      filter->setNumKeypoints(IntVec3Type(2, 2, 2));
+      filter->setPhaseNamesArrayPath(DataArrayPath(k_DataContainerName, k_EnsembleAMName, k_PhaseNamesName));
+      filter->setNumWorkers(numWorkers);
+      filter->setMemoryBudget(memoryBudget);
+      filter->execute();
+      return filter->getErrorCode();
+    };
+
+    DREAM3D_REQUIRED(runExport(k_MultiSerialDir, 1, 0), >=, 0)
+    DREAM3D_REQUIRED(runExport(k_MultiParallelDir, 4, 1), >=, 0)
+
+    for(int32_t i = 0; i < k_NumSweepContainers; i++)
+    {
+      QString fileName = QDir::separator() + k_SweepPrefix + QString::number(i) + ".flxtbl";
+      std::string serial = SimulationIOTestHelpers::ReadFile(k_MultiSerialDir + fileName);
+      std::string parallel = SimulationIOTestHelpers::ReadFile(k_MultiParallelDir + fileName);
+      DREAM3D_REQUIRE(!serial.empty())
+      DREAM3D_REQUIRE(serial == parallel)
+    }
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    int err = EXIT_SUCCESS;
+    std::cout << "############ Starting ExportOnScaleTableFileTest  ##############" << std::endl;
+
+    DREAM3D_REGISTER_TEST(TestFilterAvailability());
+
+    DREAM3D_REGISTER_TEST(TestNumberFormatter())
+    DREAM3D_REGISTER_TEST(TestMaterialTableOutput())
+    DREAM3D_REGISTER_TEST(TestRotatedOutput())
+    DREAM3D_REGISTER_TEST(TestMultiExportOutput())
+    DREAM3D_REGISTER_TEST(TestCanceledMaterialTable())
+#ifdef SimulationIO_ENABLE_BENCHMARKS
+    DREAM3D_REGISTER_TEST(TestMaterialTableBenchmark())
+#endif
+
+    DREAM3D_REGISTER_TEST(RemoveTestFiles())
+  }
+};
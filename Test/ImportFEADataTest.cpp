@@ -3,23 +3,76 @@
 // -----------------------------------------------------------------------------
 #pragma once
 
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <map>
+#include <random>
+#include <string_view>
+#include <vector>
+
+#include <QtCore/QBuffer>
+#include <QtCore/QDateTime>
+#include <QtCore/QDir>
 #include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
+#include <QtCore/QSysInfo>
+#include <QtCore/QTextStream>
 
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/DataContainers/DataContainerBundle.h"
 #include "SIMPLib/Filtering/FilterFactory.hpp"
 #include "SIMPLib/Filtering/FilterManager.h"
 #include "SIMPLib/Filtering/FilterPipeline.h"
 #include "SIMPLib/Filtering/QMetaObjectUtilities.h"
+#include "SIMPLib/Geometry/HexahedralGeom.h"
+#include "SIMPLib/Geometry/VertexGeom.h"
 #include "SIMPLib/Plugin/ISIMPLibPlugin.h"
 #include "SIMPLib/Plugin/SIMPLibPluginLoader.h"
 
+#include "SimulationIO/SimulationIOFilters/ImportFEAData.h"
+#include "SimulationIO/SimulationIOFilters/Utility/AbaqusBulkDataReader.h"
+#include "SimulationIO/SimulationIOFilters/Utility/AbaqusDatReader.h"
+#include "SimulationIO/SimulationIOFilters/Utility/AbaqusFilReader.h"
+#include "SimulationIO/SimulationIOFilters/Utility/AbaqusResultCache.h"
+#include "SimulationIO/SimulationIOFilters/Utility/DeformColumnPlan.hpp"
+#include "SimulationIO/SimulationIOFilters/Utility/DeformDataParser.hpp"
+#include "SimulationIO/SimulationIOFilters/Utility/DeformPointTrackIndex.h"
+#include "SimulationIO/SimulationIOFilters/Utility/MappedTextReader.hpp"
+
 #include "UnitTestSupport.hpp"
 
 #include "SimulationIOTestFileLocations.h"
 
 class ImportFEADataTest
 {
+  const QString k_DatFile = UnitTest::TestTempDir + "/ImportFEADataTest_odbtotxt.dat";
+  const QString k_BenchmarkDatFile = UnitTest::TestTempDir + "/ImportFEADataTest_benchmark_odbtotxt.dat";
+  const QString k_BulkDataManifestFile = UnitTest::TestTempDir + "/ImportFEADataTest_odbtobin.json";
+  const QStringList k_BulkDataArrayFiles = {"nodeLabels", "coordinates", "elementLabels", "connectivity", "U_labels", "U_data", "S_labels", "S_ips", "S_data", "SDV1_labels", "SDV1_ips", "SDV1_data", "U2_data"};
+  const QString k_CacheOdbName = "ImportFEADataTest_cache";
+  const QString k_CacheOdbFile = UnitTest::TestTempDir + "/" + k_CacheOdbName + ".odb";
+  const QString k_CacheDirectory = UnitTest::TestTempDir + "/ImportFEADataTest_abqcache";
+  const QString k_FilOdbName = "ImportFEADataTest_fil";
+  const QString k_FilFile = UnitTest::TestTempDir + "/" + k_FilOdbName + ".fil";
+  const QString k_PointTrackFile = UnitTest::TestTempDir + "/ImportFEADataTest_PointTrack.dat";
+  const QString k_BenchmarkPointTrackFile = UnitTest::TestTempDir + "/ImportFEADataTest_benchmark_PointTrack.dat";
+
+  /**
+   * @brief Contents of an odbtotxt.dat file as read by the original QByteArray based scanner
+   */
+  struct ReferenceData
+  {
+    std::vector<float> vertices;
+    std::vector<MeshIndexType> hexes;
+    std::map<QString, std::vector<float>> fields;
+  };
 
 public:
   ImportFEADataTest() = default;
@@ -37,6 +90,20 @@ public:
 #if REMOVE_TEST_FILES
     QFile::remove(UnitTest::ImportFEADataTest::TestFile1);
     QFile::remove(UnitTest::ImportFEADataTest::TestFile2);
+    QFile::remove(k_DatFile);
+    QFile::remove(k_BenchmarkDatFile);
+    QFile::remove(k_BulkDataManifestFile);
+    for(const QString& arrayFile : k_BulkDataArrayFiles)
+    {
+      QFile::remove(BulkDataArrayPath(arrayFile));
+    }
+    QFile::remove(k_CacheOdbFile);
+    QDir(k_CacheDirectory).removeRecursively();
+    QFile::remove(k_FilFile);
+    QFile::remove(k_PointTrackFile);
+    QFile::remove(DeformPointTrackIndex::sidecarPath(k_PointTrackFile));
+    QFile::remove(k_BenchmarkPointTrackFile);
+    QFile::remove(DeformPointTrackIndex::sidecarPath(k_BenchmarkPointTrackFile));
 #endif
   }
 
@@ -88,6 +155,1395 @@ public:
     return EXIT_SUCCESS;
   }
 
+  // -----------------------------------------------------------------------------
+  // Writes a C3D8 mesh of dim^3 elements in the layout of the ABAQUS python script: elements, nodes, then
+  // a nodal vector, an integration point tensor and a position that carries no values
+  // -----------------------------------------------------------------------------
+  void WriteDatFile(const QString& filePath, size_t dim)
+  {
+    QFile file(filePath);
+    file.open(QIODevice::WriteOnly);
+    QTextStream out(&file);
+
+    std::mt19937 generator(5489u);
+    std::uniform_real_distribution<float> distribution(-1.0E6f, 1.0E6f);
+
+    size_t numNodesPerSide = dim + 1;
+    size_t numCells = dim * dim * dim;
+    size_t numVerts = numNodesPerSide * numNodesPerSide * numNodesPerSide;
+
+    out << "ELEMENTS " << numCells << " C3D8\n";
+    for(size_t z = 0; z < dim; z++)
+    {
+      for(size_t y = 0; y < dim; y++)
+      {
+        for(size_t x = 0; x < dim; x++)
+        {
+          size_t n = z * numNodesPerSide * numNodesPerSide + y * numNodesPerSide + x + 1;
+          size_t up = numNodesPerSide * numNodesPerSide;
+          out << (z * dim * dim + y * dim + x + 1) << " " << n << " " << n + 1 << " " << n + 1 + numNodesPerSide << " " << n + numNodesPerSide << " " << n + up << " " << n + 1 + up << " "
+              << n + 1 + numNodesPerSide + up << " " << n + numNodesPerSide + up << " \n";
+        }
+      }
+    }
+
+    out << "NODES " << numVerts << "\n";
+    for(size_t i = 0; i < numVerts; i++)
+    {
+      out << i + 1 << " " << QString::number(distribution(generator), 'g', 9) << " " << QString::number(distribution(generator), 'g', 9) << " " << QString::number(distribution(generator), 'g', 7)
+          << " \n";
+    }
+
+    out << "NODAL VECTOR U\n";
+    for(size_t i = 0; i < numVerts; i++)
+    {
+      out << i + 1 << " " << distribution(generator) * 1.0E-9f << " " << distribution(generator) << " " << QString::number(distribution(generator), 'e', 6) << " \n";
+    }
+
+    out << "WHOLE_ELEMENT SCALAR EVOL\n";
+
+    out << "INTEGRATION_POINT TENSOR_3D_FULL S\n";
+    for(size_t i = 0; i < numCells * 8; i++)
+    {
+      out << i / 8 + 1 << " ";
+      for(size_t c = 0; c < 6; c++)
+      {
+        out << QString::number(distribution(generator), 'g', 8) << " ";
+      }
+      out << "\n";
+    }
+
+    out << "\nINTEGRATION_POINT SCALAR SDV1\n";
+    for(size_t i = 0; i < numCells * 8; i++)
+    {
+      out << i / 8 + 1 << " " << QString::number(distribution(generator) * 1.0E-30f, 'g', 8) << "\n";
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  // The original readLine/simplified/split scanner restricted to C3D8 meshes
+  // -----------------------------------------------------------------------------
+  ReferenceData ReadReferenceData(const QString& filePath)
+  {
+    ReferenceData data;
+    QFile inStream(filePath);
+    inStream.open(QIODevice::ReadOnly | QIODevice::Text);
+
+    QByteArray buf;
+    QList<QByteArray> tokens;
+    bool ok = false;
+
+    auto readTokens = [&]() {
+      buf = inStream.readLine();
+      buf = buf.trimmed();
+      buf = buf.simplified();
+      tokens = buf.split(' ');
+    };
+
+    readTokens();
+    size_t numCells = tokens.at(1).toULongLong(&ok);
+    data.hexes.resize(numCells * 8);
+    for(size_t i = 0; i < numCells; i++)
+    {
+      readTokens();
+      for(size_t n = 0; n < 8; n++)
+      {
+        data.hexes[8 * i + n] = tokens[n + 1].toInt(&ok) - 1;
+      }
+    }
+
+    readTokens();
+    size_t numVerts = tokens.at(1).toULongLong(&ok);
+    data.vertices.resize(numVerts * 3);
+    for(size_t i = 0; i < numVerts; i++)
+    {
+      readTokens();
+      for(size_t c = 0; c < 3; c++)
+      {
+        data.vertices[3 * i + c] = tokens[c + 1].toFloat(&ok);
+      }
+    }
+
+    while(!inStream.atEnd())
+    {
+      readTokens();
+      if(buf.isEmpty())
+      {
+        continue;
+      }
+      QString position = tokens.at(0);
+      QString type = tokens.at(1);
+      QString name = tokens.at(2);
+      size_t numLines = position == "NODAL" ? numVerts : (position == "INTEGRATION_POINT" ? numCells * 8 : 0);
+      size_t numComp = type == "SCALAR" ? 1 : (type == "VECTOR" ? 3 : 6);
+      if(numLines == 0)
+      {
+        continue;
+      }
+      std::vector<float>& values = data.fields[name];
+      values.resize(numLines * numComp);
+      for(size_t i = 0; i < numLines; i++)
+      {
+        readTokens();
+        for(size_t c = 0; c < numComp; c++)
+        {
+          values[numComp * i + c] = tokens[c + 1].toFloat(&ok);
+        }
+      }
+    }
+    return data;
+  }
+
+  // -----------------------------------------------------------------------------
+  DataContainerArray::Pointer ReadDatFile(const QString& filePath, ImportFEAData* filter, int32_t numThreads = 0)
+  {
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainer::Pointer dc = DataContainer::New("FEAData");
+    dca->addOrReplaceDataContainer(dc);
+    AttributeMatrix::Pointer vertexAttrMat = AttributeMatrix::New(std::vector<size_t>(1, 0), "VertexData", AttributeMatrix::Type::Vertex);
+    dc->addOrReplaceAttributeMatrix(vertexAttrMat);
+    AttributeMatrix::Pointer cellAttrMat = AttributeMatrix::New(std::vector<size_t>(1, 0), "CellData", AttributeMatrix::Type::Cell);
+    dc->addOrReplaceAttributeMatrix(cellAttrMat);
+
+    if(!AbaqusDatReader::read(filter, filePath, *dc, *vertexAttrMat, *cellAttrMat, numThreads))
+    {
+      return DataContainerArray::NullPointer();
+    }
+    return dca;
+  }
+
+  // -----------------------------------------------------------------------------
+  // Feeds the text to the stream parser in chunks of random size, the way it arrives from the ABAQUS process
+  DataContainerArray::Pointer StreamDatText(const QByteArray& text, ImportFEAData* filter, uint32_t seed)
+  {
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainer::Pointer dc = DataContainer::New("FEAData");
+    dca->addOrReplaceDataContainer(dc);
+    AttributeMatrix::Pointer vertexAttrMat = AttributeMatrix::New(std::vector<size_t>(1, 0), "VertexData", AttributeMatrix::Type::Vertex);
+    dc->addOrReplaceAttributeMatrix(vertexAttrMat);
+    AttributeMatrix::Pointer cellAttrMat = AttributeMatrix::New(std::vector<size_t>(1, 0), "CellData", AttributeMatrix::Type::Cell);
+    dc->addOrReplaceAttributeMatrix(cellAttrMat);
+
+    AbaqusDatReader::StreamParser parser(filter, *dc, *vertexAttrMat, *cellAttrMat);
+    std::mt19937 generator(seed);
+    std::uniform_int_distribution<size_t> chunkSize(1, seed % 2 == 0 ? 16 : 4096);
+    size_t pos = 0;
+    size_t size = static_cast<size_t>(text.size());
+    while(pos < size)
+    {
+      size_t count = std::min(chunkSize(generator), size - pos);
+      if(!parser.append(text.constData() + pos, count))
+      {
+        return DataContainerArray::NullPointer();
+      }
+      pos += count;
+    }
+    if(!parser.finish())
+    {
+      return DataContainerArray::NullPointer();
+    }
+    return dca;
+  }
+
+  // -----------------------------------------------------------------------------
+  int TestAbaqusDatReader()
+  {
+    WriteDatFile(k_DatFile, 6);
+    ReferenceData expected = ReadReferenceData(k_DatFile);
+
+    ImportFEAData::Pointer filter = ImportFEAData::New();
+    DataContainerArray::Pointer dca = ReadDatFile(k_DatFile, filter.get());
+    DREAM3D_REQUIRE(dca != nullptr)
+    DREAM3D_REQUIRED(filter->getErrorCode(), >=, 0)
+
+    DataContainer::Pointer dc = dca->getDataContainer("FEAData");
+    HexahedralGeom::Pointer hexGeom = dc->getGeometryAs<HexahedralGeom>();
+    DREAM3D_REQUIRE(hexGeom != nullptr)
+    DREAM3D_REQUIRE_EQUAL(hexGeom->getNumberOfVertices(), expected.vertices.size() / 3)
+    DREAM3D_REQUIRE_EQUAL(hexGeom->getNumberOfElements(), expected.hexes.size() / 8)
+    DREAM3D_REQUIRE(std::equal(expected.vertices.cbegin(), expected.vertices.cend(), hexGeom->getVertexPointer(0)))
+    DREAM3D_REQUIRE(std::equal(expected.hexes.cbegin(), expected.hexes.cend(), hexGeom->getHexPointer(0)))
+
+    AttributeMatrix::Pointer vertexAttrMat = dc->getAttributeMatrix("VertexData");
+    AttributeMatrix::Pointer cellAttrMat = dc->getAttributeMatrix("CellData");
+    DREAM3D_REQUIRE_EQUAL(vertexAttrMat->getNumberOfTuples(), expected.vertices.size() / 3)
+    DREAM3D_REQUIRE_EQUAL(cellAttrMat->getNumberOfTuples(), expected.hexes.size() / 8)
+
+    FloatArrayType::Pointer displacement = vertexAttrMat->getAttributeArrayAs<FloatArrayType>("U");
+    DREAM3D_REQUIRE(displacement != nullptr)
+    DREAM3D_REQUIRE(displacement->getComponentDimensions() == std::vector<size_t>{3})
+    DREAM3D_REQUIRE(std::equal(expected.fields["U"].cbegin(), expected.fields["U"].cend(), displacement->begin()))
+
+    FloatArrayType::Pointer stress = cellAttrMat->getAttributeArrayAs<FloatArrayType>("S");
+    DREAM3D_REQUIRE(stress != nullptr)
+    DREAM3D_REQUIRE(stress->getComponentDimensions() == std::vector<size_t>{48})
+    DREAM3D_REQUIRE(std::equal(expected.fields["S"].cbegin(), expected.fields["S"].cend(), stress->begin()))
+
+    FloatArrayType::Pointer stateVariable = cellAttrMat->getAttributeArrayAs<FloatArrayType>("SDV1");
+    DREAM3D_REQUIRE(stateVariable != nullptr)
+    DREAM3D_REQUIRE(stateVariable->getComponentDimensions() == std::vector<size_t>{8})
+    DREAM3D_REQUIRE(std::equal(expected.fields["SDV1"].cbegin(), expected.fields["SDV1"].cend(), stateVariable->begin()))
+
+    DREAM3D_REQUIRE(cellAttrMat->getAttributeArray("EVOL") == nullptr)
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  int TestAbaqusDatReaderErrors()
+  {
+    QFile file(k_DatFile);
+    file.open(QIODevice::WriteOnly);
+    file.write("ELEMENTS 1 C3D8R\n1 1 2 3 4 5 6 7 8\nNODES 8\n1 0.0 0.0 0.0\n");
+    file.close();
+
+    ImportFEAData::Pointer filter = ImportFEAData::New();
+    DREAM3D_REQUIRE(ReadDatFile(k_DatFile, filter.get()) == nullptr)
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCode(), -103)
+
+    file.open(QIODevice::WriteOnly);
+    file.write("NODES 1\n1 0.0 0.0 0.0\n");
+    file.close();
+
+    filter = ImportFEAData::New();
+    DREAM3D_REQUIRE(ReadDatFile(k_DatFile, filter.get()) == nullptr)
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCode(), -101)
+
+    // Node labels outside 1 to the number of nodes, with the nodes after and before the elements
+    const QString nodes = "NODES 8\n1 0 0 0\n2 1 0 0\n3 1 1 0\n4 0 1 0\n5 0 0 1\n6 1 0 1\n7 1 1 1\n8 0 1 1\n";
+    for(const QString& element : {QString("1 0 2 3 4 5 6 7 8\n"), QString("1 1 2 3 4 5 6 7 9\n"), QString("1 -1 2 3 4 5 6 7 8\n")})
+    {
+      for(const QString& text : {"ELEMENTS 1 C3D8R\n" + element + nodes, nodes + "ELEMENTS 1 C3D8R\n" + element})
+      {
+        file.open(QIODevice::WriteOnly);
+        file.write(text.toLatin1());
+        file.close();
+
+        filter = ImportFEAData::New();
+        DREAM3D_REQUIRE(ReadDatFile(k_DatFile, filter.get()) == nullptr)
+        DREAM3D_REQUIRE_EQUAL(filter->getErrorCode(), -104)
+
+        filter = ImportFEAData::New();
+        DREAM3D_REQUIRE(StreamDatText(text.toLatin1(), filter.get(), 0) == nullptr)
+        DREAM3D_REQUIRE_EQUAL(filter->getErrorCode(), -104)
+      }
+    }
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  int TestAbaqusDatStreamParser()
+  {
+    WriteDatFile(k_DatFile, 6);
+    QFile file(k_DatFile);
+    DREAM3D_REQUIRE(file.open(QIODevice::ReadOnly))
+    QByteArray text = file.readAll();
+    file.close();
+
+    ImportFEAData::Pointer filter = ImportFEAData::New();
+    DataContainerArray::Pointer expected = ReadDatFile(k_DatFile, filter.get());
+    DREAM3D_REQUIRE(expected != nullptr)
+    HexahedralGeom::Pointer expectedGeom = expected->getDataContainer("FEAData")->getGeometryAs<HexahedralGeom>();
+
+    // Lines, and even numbers, split across chunks must come out the same as reading the whole file
+    for(uint32_t seed = 0; seed < 4; seed++)
+    {
+      filter = ImportFEAData::New();
+      DataContainerArray::Pointer dca = StreamDatText(text, filter.get(), seed);
+      DREAM3D_REQUIRE(dca != nullptr)
+      DREAM3D_REQUIRED(filter->getErrorCode(), >=, 0)
+
+      DataContainer::Pointer dc = dca->getDataContainer("FEAData");
+      HexahedralGeom::Pointer hexGeom = dc->getGeometryAs<HexahedralGeom>();
+      DREAM3D_REQUIRE(hexGeom != nullptr)
+      DREAM3D_REQUIRE_EQUAL(hexGeom->getNumberOfVertices(), expectedGeom->getNumberOfVertices())
+      DREAM3D_REQUIRE_EQUAL(hexGeom->getNumberOfElements(), expectedGeom->getNumberOfElements())
+      DREAM3D_REQUIRE(std::equal(expectedGeom->getVertexPointer(0), expectedGeom->getVertexPointer(0) + expectedGeom->getNumberOfVertices() * 3, hexGeom->getVertexPointer(0)))
+      DREAM3D_REQUIRE(std::equal(expectedGeom->getHexPointer(0), expectedGeom->getHexPointer(0) + expectedGeom->getNumberOfElements() * 8, hexGeom->getHexPointer(0)))
+
+      for(const QString& amName : {QString("VertexData"), QString("CellData")})
+      {
+        AttributeMatrix::Pointer expectedAttrMat = expected->getDataContainer("FEAData")->getAttributeMatrix(amName);
+        AttributeMatrix::Pointer attrMat = dc->getAttributeMatrix(amName);
+        DREAM3D_REQUIRE_EQUAL(attrMat->getNumberOfTuples(), expectedAttrMat->getNumberOfTuples())
+        DREAM3D_REQUIRE(attrMat->getAttributeArrayNames() == expectedAttrMat->getAttributeArrayNames())
+        for(const QString& name : expectedAttrMat->getAttributeArrayNames())
+        {
+          FloatArrayType::Pointer expectedArray = expectedAttrMat->getAttributeArrayAs<FloatArrayType>(name);
+          FloatArrayType::Pointer array = attrMat->getAttributeArrayAs<FloatArrayType>(name);
+          DREAM3D_REQUIRE(array != nullptr)
+          DREAM3D_REQUIRE(array->getComponentDimensions() == expectedArray->getComponentDimensions())
+          DREAM3D_REQUIRE(std::equal(expectedArray->begin(), expectedArray->end(), array->begin()))
+        }
+      }
+    }
+
+    // A stream that stops in the middle of a field output
+    filter = ImportFEAData::New();
+    DREAM3D_REQUIRE(StreamDatText(text.left(text.indexOf("INTEGRATION_POINT") + 100), filter.get(), 1) == nullptr)
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCode(), -107)
+
+    // A stream that stops before the nodes
+    filter = ImportFEAData::New();
+    DREAM3D_REQUIRE(StreamDatText(text.left(text.indexOf("NODES")), filter.get(), 0) == nullptr)
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCode(), -101)
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  int TestAbaqusDatReaderBenchmark()
+  {
+    WriteDatFile(k_BenchmarkDatFile, 64);
+    double fileSize = static_cast<double>(QFile(k_BenchmarkDatFile).size()) / (1024.0 * 1024.0);
+
+    auto start = std::chrono::steady_clock::now();
+    ReferenceData expected = ReadReferenceData(k_BenchmarkDatFile);
+    std::chrono::duration<double> referenceTime = std::chrono::steady_clock::now() - start;
+    std::cout << "odbtotxt.dat (" << fileSize << " MB) QByteArray scanner: " << referenceTime.count() << " s, " << fileSize / referenceTime.count() << " MB/s" << std::endl;
+
+    // The sections span many blocks here, so this also checks the parallel parse against the reference
+    for(int32_t numThreads : {1, 0})
+    {
+      ImportFEAData::Pointer filter = ImportFEAData::New();
+      start = std::chrono::steady_clock::now();
+      DataContainerArray::Pointer dca = ReadDatFile(k_BenchmarkDatFile, filter.get(), numThreads);
+      std::chrono::duration<double> mappedTime = std::chrono::steady_clock::now() - start;
+      DREAM3D_REQUIRE(dca != nullptr)
+
+      std::cout << "odbtotxt.dat (" << fileSize << " MB) mapped scanner, " << numThreads << " threads: " << mappedTime.count() << " s, " << fileSize / mappedTime.count()
+                << " MB/s, speedup " << referenceTime.count() / mappedTime.count() << "x" << std::endl;
+
+      DataContainer::Pointer dc = dca->getDataContainer("FEAData");
+      HexahedralGeom::Pointer hexGeom = dc->getGeometryAs<HexahedralGeom>();
+      DREAM3D_REQUIRE(std::equal(expected.vertices.cbegin(), expected.vertices.cend(), hexGeom->getVertexPointer(0)))
+      DREAM3D_REQUIRE(std::equal(expected.hexes.cbegin(), expected.hexes.cend(), hexGeom->getHexPointer(0)))
+      FloatArrayType::Pointer stress = dc->getAttributeMatrix("CellData")->getAttributeArrayAs<FloatArrayType>("S");
+      DREAM3D_REQUIRE(stress != nullptr)
+      DREAM3D_REQUIRE(std::equal(expected.fields["S"].cbegin(), expected.fields["S"].cend(), stress->begin()))
+    }
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  QString BulkDataArrayPath(const QString& name)
+  {
+    return UnitTest::TestTempDir + "/ImportFEADataTest_odbtobin_" + name + ".bin";
+  }
+
+  // -----------------------------------------------------------------------------
+  template <typename T>
+  QString WriteBulkDataArray(const QString& name, const std::vector<T>& values)
+  {
+    QFile file(BulkDataArrayPath(name));
+    file.open(QIODevice::WriteOnly);
+    file.write(reinterpret_cast<const char*>(values.data()), static_cast<qint64>(values.size() * sizeof(T)));
+    return QFileInfo(file).fileName();
+  }
+
+  // -----------------------------------------------------------------------------
+  // Writes what the binary extraction script would write for two C3D8 elements side by side. The node labels are
+  // sparse, U is listed in reverse node order and SDV1 only has values for the integration points of the second
+  // element in reverse order, so both the direct read and the scatter through the labels are exercised. With
+  // multiFrame the fields are listed as frame 0 and a frame 2 follows in which U is 1000 larger.
+  // -----------------------------------------------------------------------------
+  void WriteBulkData(int32_t unknownNode = 0, bool multiFrame = false)
+  {
+    constexpr int32_t numVerts = 12;
+    constexpr int32_t nodeLabelOffset = 50000000;
+    auto nodeLabel = [](int32_t x, int32_t y, int32_t z) { return nodeLabelOffset + 3 * (z * 6 + y * 3 + x); };
+
+    std::vector<int32_t> nodeLabels;
+    std::vector<float> coordinates;
+    for(int32_t i = 0; i < numVerts; i++)
+    {
+      nodeLabels.push_back(nodeLabelOffset + 3 * i);
+      coordinates.insert(coordinates.end(), {0.5f * i, 1.0f * i, 1.5f * i});
+    }
+
+    std::vector<int32_t> connectivity;
+    for(int32_t e = 0; e < 2; e++)
+    {
+      connectivity.insert(connectivity.end(), {nodeLabel(e, 0, 0), nodeLabel(e + 1, 0, 0), nodeLabel(e + 1, 1, 0), nodeLabel(e, 1, 0), nodeLabel(e, 0, 1), nodeLabel(e + 1, 0, 1),
+                                               nodeLabel(e + 1, 1, 1), nodeLabel(e, 1, 1)});
+    }
+    if(unknownNode != 0)
+    {
+      connectivity[5] = unknownNode;
+    }
+
+    std::vector<int32_t> uLabels;
+    std::vector<float> uData;
+    for(int32_t i = numVerts - 1; i >= 0; i--)
+    {
+      uLabels.push_back(nodeLabels[i]);
+      uData.insert(uData.end(), {10.0f * i, 10.0f * i + 1.0f, 10.0f * i + 2.0f});
+    }
+
+    std::vector<int32_t> sLabels;
+    std::vector<int32_t> sIntPoints;
+    std::vector<float> sData;
+    std::vector<int32_t> sdvLabels;
+    std::vector<int32_t> sdvIntPoints;
+    std::vector<float> sdvData;
+    for(int32_t e = 0; e < 2; e++)
+    {
+      for(int32_t ip = 1; ip <= 8; ip++)
+      {
+        sLabels.push_back(e + 1);
+        sIntPoints.push_back(ip);
+        for(int32_t c = 0; c < 6; c++)
+        {
+          sData.push_back(1000.0f * e + 10.0f * ip + c);
+        }
+        sdvLabels.push_back(2);
+        sdvIntPoints.push_back(9 - ip);
+        sdvData.push_back(-1.0f * (9 - ip));
+      }
+    }
+
+    QJsonObject manifest;
+    manifest["version"] = 1;
+    manifest["byteOrder"] = QSysInfo::ByteOrder == QSysInfo::LittleEndian ? "little" : "big";
+    manifest["elementType"] = "C3D8";
+    manifest["numElements"] = 2;
+    manifest["nodesPerElement"] = 8;
+    manifest["elementLabels"] = WriteBulkDataArray("elementLabels", std::vector<int32_t>{1, 2});
+    manifest["connectivity"] = WriteBulkDataArray("connectivity", connectivity);
+    manifest["numNodes"] = numVerts;
+    manifest["numCoords"] = 3;
+    manifest["nodeLabels"] = WriteBulkDataArray("nodeLabels", nodeLabels);
+    manifest["coordinates"] = WriteBulkDataArray("coordinates", coordinates);
+
+    QJsonArray fields;
+    QJsonObject u{{"name", "U"}, {"type", "VECTOR"}, {"position", "NODAL"}, {"numValues", numVerts}, {"numComponents", 3}};
+    u["labels"] = WriteBulkDataArray("U_labels", uLabels);
+    u["data"] = WriteBulkDataArray("U_data", uData);
+    fields.append(u);
+    fields.append(QJsonObject{{"name", "EVOL"}, {"type", "SCALAR"}, {"position", "WHOLE_ELEMENT"}});
+    QJsonObject stress{{"name", "S"}, {"type", "TENSOR_3D_FULL"}, {"position", "INTEGRATION_POINT"}, {"numValues", 16}, {"numComponents", 6}};
+    stress["labels"] = WriteBulkDataArray("S_labels", sLabels);
+    stress["integrationPoints"] = WriteBulkDataArray("S_ips", sIntPoints);
+    stress["data"] = WriteBulkDataArray("S_data", sData);
+    fields.append(stress);
+    QJsonObject stateVariable{{"name", "SDV1"}, {"type", "SCALAR"}, {"position", "INTEGRATION_POINT"}, {"numValues", 8}, {"numComponents", 1}};
+    stateVariable["labels"] = WriteBulkDataArray("SDV1_labels", sdvLabels);
+    stateVariable["integrationPoints"] = WriteBulkDataArray("SDV1_ips", sdvIntPoints);
+    stateVariable["data"] = WriteBulkDataArray("SDV1_data", sdvData);
+    fields.append(stateVariable);
+    if(multiFrame)
+    {
+      for(float& value : uData)
+      {
+        value += 1000.0f;
+      }
+      QJsonObject u2 = u;
+      u2["data"] = WriteBulkDataArray("U2_data", uData);
+      QJsonArray frames;
+      frames.append(QJsonObject{{"frame", 0}, {"frameValue", 0.0}, {"fields", fields}});
+      frames.append(QJsonObject{{"frame", 2}, {"frameValue", 0.5}, {"fields", QJsonArray{u2}}});
+      manifest["frames"] = frames;
+    }
+    else
+    {
+      manifest["fields"] = fields;
+    }
+
+    QFile file(k_BulkDataManifestFile);
+    file.open(QIODevice::WriteOnly);
+    file.write(QJsonDocument(manifest).toJson());
+  }
+
+  // -----------------------------------------------------------------------------
+  DataContainerArray::Pointer ReadBulkData(ImportFEAData* filter)
+  {
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainer::Pointer dc = DataContainer::New("FEAData");
+    dca->addOrReplaceDataContainer(dc);
+    AttributeMatrix::Pointer vertexAttrMat = AttributeMatrix::New(std::vector<size_t>(1, 0), "VertexData", AttributeMatrix::Type::Vertex);
+    dc->addOrReplaceAttributeMatrix(vertexAttrMat);
+    AttributeMatrix::Pointer cellAttrMat = AttributeMatrix::New(std::vector<size_t>(1, 0), "CellData", AttributeMatrix::Type::Cell);
+    dc->addOrReplaceAttributeMatrix(cellAttrMat);
+
+    if(!AbaqusBulkDataReader::read(filter, k_BulkDataManifestFile, *dc, *vertexAttrMat, *cellAttrMat))
+    {
+      return DataContainerArray::NullPointer();
+    }
+    return dca;
+  }
+
+  // -----------------------------------------------------------------------------
+  int TestAbaqusBulkDataReader()
+  {
+    WriteBulkData();
+
+    ImportFEAData::Pointer filter = ImportFEAData::New();
+    DataContainerArray::Pointer dca = ReadBulkData(filter.get());
+    DREAM3D_REQUIRE(dca != nullptr)
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCode(), 0)
+    DREAM3D_REQUIRE_EQUAL(filter->getWarningCode(), -106)
+
+    DataContainer::Pointer dc = dca->getDataContainer("FEAData");
+    HexahedralGeom::Pointer hexGeom = dc->getGeometryAs<HexahedralGeom>();
+    DREAM3D_REQUIRE(hexGeom != nullptr)
+    DREAM3D_REQUIRE_EQUAL(hexGeom->getNumberOfVertices(), 12)
+    DREAM3D_REQUIRE_EQUAL(hexGeom->getNumberOfElements(), 2)
+    for(size_t i = 0; i < 12; i++)
+    {
+      float* vertex = hexGeom->getVertexPointer(static_cast<int64_t>(i));
+      DREAM3D_REQUIRE(vertex[0] == 0.5f * i && vertex[1] == 1.0f * i && vertex[2] == 1.5f * i)
+    }
+    std::vector<MeshIndexType> expectedHexes = {0, 1, 4, 3, 6, 7, 10, 9, 1, 2, 5, 4, 7, 8, 11, 10};
+    DREAM3D_REQUIRE(std::equal(expectedHexes.cbegin(), expectedHexes.cend(), hexGeom->getHexPointer(0)))
+
+    AttributeMatrix::Pointer vertexAttrMat = dc->getAttributeMatrix("VertexData");
+    AttributeMatrix::Pointer cellAttrMat = dc->getAttributeMatrix("CellData");
+    DREAM3D_REQUIRE_EQUAL(vertexAttrMat->getNumberOfTuples(), 12)
+    DREAM3D_REQUIRE_EQUAL(cellAttrMat->getNumberOfTuples(), 2)
+
+    FloatArrayType::Pointer displacement = vertexAttrMat->getAttributeArrayAs<FloatArrayType>("U");
+    DREAM3D_REQUIRE(displacement != nullptr)
+    DREAM3D_REQUIRE(displacement->getComponentDimensions() == std::vector<size_t>{3})
+    for(size_t i = 0; i < 36; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(displacement->getValue(i), 10.0f * (i / 3) + (i % 3))
+    }
+
+    FloatArrayType::Pointer stress = cellAttrMat->getAttributeArrayAs<FloatArrayType>("S");
+    DREAM3D_REQUIRE(stress != nullptr)
+    DREAM3D_REQUIRE(stress->getComponentDimensions() == std::vector<size_t>{48})
+    for(size_t i = 0; i < 96; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(stress->getValue(i), 1000.0f * (i / 48) + 10.0f * (i % 48 / 6 + 1) + (i % 6))
+    }
+
+    FloatArrayType::Pointer stateVariable = cellAttrMat->getAttributeArrayAs<FloatArrayType>("SDV1");
+    DREAM3D_REQUIRE(stateVariable != nullptr)
+    DREAM3D_REQUIRE(stateVariable->getComponentDimensions() == std::vector<size_t>{8})
+    for(size_t i = 0; i < 16; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(stateVariable->getValue(i), i < 8 ? 0.0f : -1.0f * (i - 7))
+    }
+
+    DREAM3D_REQUIRE(cellAttrMat->getAttributeArray("EVOL") == nullptr)
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  int TestAbaqusBulkDataReaderFrames()
+  {
+    WriteBulkData(0, true);
+
+    ImportFEAData::Pointer filter = ImportFEAData::New();
+    AbaqusBulkDataReader::Data data;
+    DREAM3D_REQUIRE(AbaqusBulkDataReader::read(filter.get(), k_BulkDataManifestFile, data))
+    DREAM3D_REQUIRE(std::dynamic_pointer_cast<HexahedralGeom>(data.geometry) != nullptr)
+    DREAM3D_REQUIRE_EQUAL(data.numVerts, 12)
+    DREAM3D_REQUIRE_EQUAL(data.numCells, 2)
+    DREAM3D_REQUIRE_EQUAL(data.frames.size(), 2)
+
+    const AbaqusBulkDataReader::Frame& first = data.frames[0];
+    DREAM3D_REQUIRE_EQUAL(first.frameNumber, 0)
+    DREAM3D_REQUIRE_EQUAL(first.vertexArrays.size(), 1)
+    DREAM3D_REQUIRE_EQUAL(first.cellArrays.size(), 2)
+
+    const AbaqusBulkDataReader::Frame& second = data.frames[1];
+    DREAM3D_REQUIRE_EQUAL(second.frameNumber, 2)
+    DREAM3D_REQUIRE_EQUAL(second.frameValue, 0.5f)
+    DREAM3D_REQUIRE_EQUAL(second.vertexArrays.size(), 1)
+    DREAM3D_REQUIRE(second.cellArrays.empty())
+    for(size_t i = 0; i < 36; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(second.vertexArrays[0]->getValue(i), first.vertexArrays[0]->getValue(i) + 1000.0f)
+    }
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  void WriteCacheOdbFile(const QByteArray& contents)
+  {
+    QFile file(k_CacheOdbFile);
+    file.open(QIODevice::WriteOnly);
+    file.write(contents);
+  }
+
+  // -----------------------------------------------------------------------------
+  void SetLastUsed(const QString& filePath, int hoursAgo)
+  {
+    QFile file(filePath);
+    file.open(QIODevice::ReadWrite);
+    file.setFileTime(QDateTime::currentDateTimeUtc().addSecs(-3600 * hoursAgo), QFileDevice::FileModificationTime);
+  }
+
+  // -----------------------------------------------------------------------------
+  bool SameArrays(const std::vector<FloatArrayType::Pointer>& expected, const std::vector<FloatArrayType::Pointer>& arrays)
+  {
+    if(arrays.size() != expected.size())
+    {
+      return false;
+    }
+    for(size_t i = 0; i < arrays.size(); i++)
+    {
+      if(arrays[i]->getName() != expected[i]->getName() || arrays[i]->getComponentDimensions() != expected[i]->getComponentDimensions() ||
+         arrays[i]->getNumberOfTuples() != expected[i]->getNumberOfTuples() || !std::equal(expected[i]->begin(), expected[i]->end(), arrays[i]->begin()))
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // -----------------------------------------------------------------------------
+  int TestAbaqusResultCache()
+  {
+    WriteBulkData(0, true);
+    ImportFEAData::Pointer filter = ImportFEAData::New();
+    AbaqusBulkDataReader::Data data;
+    DREAM3D_REQUIRE(AbaqusBulkDataReader::read(filter.get(), k_BulkDataManifestFile, data))
+
+    QDir(k_CacheDirectory).removeRecursively();
+    WriteCacheOdbFile("odb");
+    QString key = AbaqusResultCache::key(k_CacheOdbFile, 1, "PART-1-1", "Step-1", {0, 2});
+    DREAM3D_REQUIRE(!key.isEmpty())
+    DREAM3D_REQUIRE(AbaqusResultCache::key(k_CacheOdbFile + ".missing", 1, "PART-1-1", "Step-1", {0, 2}).isEmpty())
+    DREAM3D_REQUIRE(AbaqusResultCache::key(k_CacheOdbFile, 1, "PART-1-1", "Step-1", {0}) != key)
+    DREAM3D_REQUIRE(AbaqusResultCache::key(k_CacheOdbFile, 1, "PART-1-1", "Step-2", {0, 2}) != key)
+    DREAM3D_REQUIRE(AbaqusResultCache::key(k_CacheOdbFile, 0, "PART-1-1", "Step-1", {0, 2}) != key)
+
+    // Reading the bulk data warns about the skipped WHOLE_ELEMENT output, so the cache gets a filter of its own
+    filter = ImportFEAData::New();
+    AbaqusResultCache cache(k_CacheDirectory, 1024 * 1024);
+    AbaqusBulkDataReader::Data cached;
+    DREAM3D_REQUIRE(!cache.load(filter.get(), key, cached))
+    DREAM3D_REQUIRE(cache.store(filter.get(), key, data))
+    DREAM3D_REQUIRE(cache.load(filter.get(), key, cached))
+    DREAM3D_REQUIRED(filter->getWarningCode(), >=, 0)
+
+    HexahedralGeom::Pointer expectedGeom = std::dynamic_pointer_cast<HexahedralGeom>(data.geometry);
+    HexahedralGeom::Pointer hexGeom = std::dynamic_pointer_cast<HexahedralGeom>(cached.geometry);
+    DREAM3D_REQUIRE(hexGeom != nullptr)
+    DREAM3D_REQUIRE_EQUAL(cached.numVerts, 12)
+    DREAM3D_REQUIRE_EQUAL(cached.numCells, 2)
+    DREAM3D_REQUIRE(std::equal(expectedGeom->getVertexPointer(0), expectedGeom->getVertexPointer(0) + 36, hexGeom->getVertexPointer(0)))
+    DREAM3D_REQUIRE(std::equal(expectedGeom->getHexPointer(0), expectedGeom->getHexPointer(0) + 16, hexGeom->getHexPointer(0)))
+    DREAM3D_REQUIRE_EQUAL(cached.frames.size(), 2)
+    for(size_t i = 0; i < cached.frames.size(); i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(cached.frames[i].frameNumber, data.frames[i].frameNumber)
+      DREAM3D_REQUIRE_EQUAL(cached.frames[i].frameValue, data.frames[i].frameValue)
+      DREAM3D_REQUIRE(SameArrays(data.frames[i].vertexArrays, cached.frames[i].vertexArrays))
+      DREAM3D_REQUIRE(SameArrays(data.frames[i].cellArrays, cached.frames[i].cellArrays))
+    }
+
+    // Rewriting the odb changes the key, so the old entry is no longer found
+    WriteCacheOdbFile("rewritten odb");
+    DREAM3D_REQUIRE(AbaqusResultCache::key(k_CacheOdbFile, 1, "PART-1-1", "Step-1", {0, 2}) != key)
+
+    // A damaged entry is removed with a warning
+    QString entryPath = cache.entryPath(key);
+    QFile entry(entryPath);
+    entry.resize(entry.size() - 1);
+    DREAM3D_REQUIRE(!cache.load(filter.get(), key, cached))
+    DREAM3D_REQUIRE_EQUAL(filter->getWarningCode(), -111)
+    DREAM3D_REQUIRE(!QFile::exists(entryPath))
+
+    // The least recently used entries go first, and reading an entry counts as using it
+    std::vector<QString> keys;
+    for(int frameNum : {4, 5, 6})
+    {
+      keys.push_back(AbaqusResultCache::key(k_CacheOdbFile, 1, "PART-1-1", "Step-1", {frameNum}));
+      DREAM3D_REQUIRE(cache.store(filter.get(), keys.back(), data))
+      SetLastUsed(cache.entryPath(keys.back()), 7 - frameNum);
+    }
+    qint64 entrySize = QFileInfo(cache.entryPath(keys[0])).size();
+
+    AbaqusResultCache(k_CacheDirectory, entrySize * 5 / 2).evict();
+    DREAM3D_REQUIRE(!QFile::exists(cache.entryPath(keys[0])))
+    DREAM3D_REQUIRE(QFile::exists(cache.entryPath(keys[1])))
+    DREAM3D_REQUIRE(QFile::exists(cache.entryPath(keys[2])))
+
+    AbaqusResultCache smallCache(k_CacheDirectory, entrySize * 3 / 2);
+    DREAM3D_REQUIRE(smallCache.load(filter.get(), keys[1], cached))
+    smallCache.evict();
+    DREAM3D_REQUIRE(QFile::exists(cache.entryPath(keys[1])))
+    DREAM3D_REQUIRE(!QFile::exists(cache.entryPath(keys[2])))
+
+    // Results that can never fit are not written at all
+    DREAM3D_REQUIRE(!AbaqusResultCache(k_CacheDirectory, 16).store(filter.get(), key, data))
+    DREAM3D_REQUIRE(!QFile::exists(entryPath))
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  // With the results in the cache, the filter imports the frame range without writing or running the python script
+  // -----------------------------------------------------------------------------
+  int TestAbaqusResultCacheHit()
+  {
+    WriteBulkData(0, true);
+    ImportFEAData::Pointer filter = ImportFEAData::New();
+    AbaqusBulkDataReader::Data data;
+    DREAM3D_REQUIRE(AbaqusBulkDataReader::read(filter.get(), k_BulkDataManifestFile, data))
+
+    QDir(k_CacheDirectory).removeRecursively();
+    WriteCacheOdbFile("odb");
+    AbaqusResultCache cache(k_CacheDirectory, 1024 * 1024);
+    DREAM3D_REQUIRE(cache.store(filter.get(), AbaqusResultCache::key(k_CacheOdbFile, 1, "PART-1-1", "Step-1", {0, 2}), data))
+
+    QString scriptFile = UnitTest::TestTempDir + "/" + k_CacheOdbName + ".py";
+    QFile::remove(scriptFile);
+
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    filter->setDataContainerArray(dca);
+    filter->setFEAPackage(0);
+    filter->setABQPythonCommand("ImportFEADataTest_missing_abaqus python");
+    filter->setodbName(k_CacheOdbName);
+    filter->setodbFilePath(UnitTest::TestTempDir);
+    filter->setInstanceName("PART-1-1");
+    filter->setStep("Step-1");
+    filter->setABQExtractionMode(1);
+    filter->setABQImportFrameRange(true);
+    filter->setFrameNumber(0);
+    filter->setABQLastFrameNumber(2);
+    filter->setABQFrameStride(2);
+    filter->setABQUseResultCache(true);
+    filter->setABQCacheDirectory(k_CacheDirectory);
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCode(), >=, 0)
+    DREAM3D_REQUIRE(!QFile::exists(scriptFile))
+
+    for(size_t i = 0; i < data.frames.size(); i++)
+    {
+      DataContainer::Pointer dc = dca->getDataContainer(filter->getDataContainerName() + "_" + QString::number(data.frames[i].frameNumber));
+      DREAM3D_REQUIRE(dc != nullptr)
+      DREAM3D_REQUIRE(dc->getGeometryAs<HexahedralGeom>() != nullptr)
+      AttributeMatrix::Pointer vertexAttrMat = dc->getAttributeMatrix(filter->getVertexAttributeMatrixName());
+      DREAM3D_REQUIRE_EQUAL(vertexAttrMat->getNumberOfTuples(), 12)
+      FloatArrayType::Pointer expected = data.frames[i].vertexArrays[0];
+      FloatArrayType::Pointer array = vertexAttrMat->getAttributeArrayAs<FloatArrayType>(expected->getName());
+      DREAM3D_REQUIRE(array != nullptr)
+      DREAM3D_REQUIRE(std::equal(expected->begin(), expected->end(), array->begin()))
+    }
+
+    // A changed setting misses the cache and falls through to running ABAQUS
+    filter->setStep("Step-2");
+    filter->setDataContainerArray(DataContainerArray::New());
+    filter->execute();
+    DREAM3D_REQUIRE(QFile::exists(scriptFile))
+    QFile::remove(scriptFile);
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  // A frame range is only checked and laid out during preflight; reading it requires ABAQUS
+  // -----------------------------------------------------------------------------
+  int TestAbaqusFrameRangePreflight()
+  {
+    ImportFEAData::Pointer filter = ImportFEAData::New();
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    filter->setDataContainerArray(dca);
+    filter->setFEAPackage(0);
+    filter->setABQPythonCommand("abaqus python");
+    filter->setABQExtractionMode(1);
+    filter->setABQImportFrameRange(true);
+    filter->setFrameNumber(1);
+    filter->setABQLastFrameNumber(6);
+    filter->setABQFrameStride(2);
+    filter->preflight();
+    DREAM3D_REQUIRED(filter->getErrorCode(), >=, 0)
+
+    IDataContainerBundle::Pointer bundle = dca->getDataContainerBundle(filter->getTimeSeriesBundleName());
+    DREAM3D_REQUIRE(bundle != nullptr)
+    for(int32_t frameNum : {1, 3, 5})
+    {
+      DataContainer::Pointer dc = dca->getDataContainer(filter->getDataContainerName() + "_" + QString::number(frameNum));
+      DREAM3D_REQUIRE(dc != nullptr)
+      DREAM3D_REQUIRE(dc->getAttributeMatrix(filter->getVertexAttributeMatrixName()) != nullptr)
+      DREAM3D_REQUIRE(dc->getAttributeMatrix(filter->getCellAttributeMatrixName()) != nullptr)
+    }
+    DREAM3D_REQUIRE(dca->getDataContainer(filter->getDataContainerName() + "_7") == nullptr)
+
+    filter->setABQExtractionMode(0);
+    filter->setDataContainerArray(DataContainerArray::New());
+    filter->preflight();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCode(), -4012)
+
+    filter->setABQExtractionMode(1);
+    filter->setABQLastFrameNumber(0);
+    filter->setDataContainerArray(DataContainerArray::New());
+    filter->preflight();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCode(), -4011)
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  int TestAbaqusBulkDataReaderErrors()
+  {
+    WriteBulkData(12345);
+    ImportFEAData::Pointer filter = ImportFEAData::New();
+    DREAM3D_REQUIRE(ReadBulkData(filter.get()) == nullptr)
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCode(), -110)
+
+    WriteBulkData();
+    QFile file(BulkDataArrayPath("S_data"));
+    file.resize(file.size() - 4);
+    filter = ImportFEAData::New();
+    DREAM3D_REQUIRE(ReadBulkData(filter.get()) == nullptr)
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCode(), -109)
+
+    file.setFileName(k_BulkDataManifestFile);
+    file.open(QIODevice::WriteOnly);
+    file.write("{\"elementType\": \"C3D8\"");
+    file.close();
+    filter = ImportFEAData::New();
+    DREAM3D_REQUIRE(ReadBulkData(filter.get()) == nullptr)
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCode(), -108)
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  // The values of the results file written by WriteFilFile encode the step, increment, element or node and component
+  // -----------------------------------------------------------------------------
+  static float FilStress(int32_t step, int32_t increment, size_t element, size_t intPoint, size_t c)
+  {
+    return 100000.0f * (10 * step + increment) + 1000.0f * element + 10.0f * intPoint + c;
+  }
+
+  // -----------------------------------------------------------------------------
+  static float FilDisplacement(int32_t step, int32_t increment, size_t node, size_t c)
+  {
+    return 100000.0f * (10 * step + increment) + 10.0f * node + c;
+  }
+
+  // -----------------------------------------------------------------------------
+  // Writes an ABAQUS results file for the two C3D8 elements of WriteBulkData with node numbers 10, 20, ... Step 1 has
+  // two increments and step 2 has one, each with S at every integration point, an unsupported VOIDR record and U
+  // listed in reverse node order. The words are written either in 512 word blocks framed by FORTRAN record markers,
+  // as ABAQUS writes them, or as a plain stream, in either byte order.
+  // -----------------------------------------------------------------------------
+  void WriteFilFile(bool blocked, bool swapBytes, qint64 truncateBytes = 0)
+  {
+    auto toWord = [swapBytes](const void* value) {
+      uint64_t word = 0;
+      std::memcpy(&word, value, sizeof(word));
+      if(swapBytes)
+      {
+        char* bytes = reinterpret_cast<char*>(&word);
+        std::reverse(bytes, bytes + sizeof(word));
+      }
+      return word;
+    };
+    auto integer = [&toWord](int64_t value) { return toWord(&value); };
+    auto real = [&toWord](double value) { return toWord(&value); };
+    auto text = [](const char* value) {
+      char bytes[8] = {' ', ' ', ' ', ' ', ' ', ' ', ' ', ' '};
+      std::memcpy(bytes, value, std::min<size_t>(sizeof(bytes), std::strlen(value)));
+      uint64_t word = 0;
+      std::memcpy(&word, bytes, sizeof(word));
+      return word;
+    };
+
+    std::vector<uint64_t> words;
+    auto record = [&words, &integer](int64_t key, const std::vector<uint64_t>& attributes) {
+      words.push_back(integer(static_cast<int64_t>(attributes.size()) + 2));
+      words.push_back(integer(key));
+      words.insert(words.end(), attributes.begin(), attributes.end());
+    };
+    auto nodeLabel = [&integer](int32_t x, int32_t y, int32_t z) { return integer(10 * (z * 6 + y * 3 + x + 1)); };
+
+    record(1921, {text("6.14-1"), text("18-Oct-2"), text("026"), text("12:00:00"), integer(2), integer(12), real(1.0)});
+    for(int32_t e = 0; e < 2; e++)
+    {
+      record(1900, {integer(e + 1), text("C3D8"), nodeLabel(e, 0, 0), nodeLabel(e + 1, 0, 0), nodeLabel(e + 1, 1, 0), nodeLabel(e, 1, 0), nodeLabel(e, 0, 1), nodeLabel(e + 1, 0, 1),
+                    nodeLabel(e + 1, 1, 1), nodeLabel(e, 1, 1)});
+    }
+    for(int32_t i = 0; i < 12; i++)
+    {
+      record(1901, {integer(10 * (i + 1)), real(0.5 * i), real(1.0 * i), real(1.5 * i)});
+    }
+    record(1922, {text("ImportFE"), text("ADataTes")});
+
+    for(std::pair<int32_t, int32_t> increment : std::vector<std::pair<int32_t, int32_t>>{{1, 1}, {1, 2}, {2, 1}})
+    {
+      int32_t step = increment.first;
+      int32_t inc = increment.second;
+      record(2000, {real(inc), real(inc), real(0.0), real(0.0), integer(1), integer(step), integer(inc), integer(0), real(1.0), real(0.1), real(0.1)});
+      for(size_t e = 0; e < 2; e++)
+      {
+        for(size_t ip = 1; ip <= 8; ip++)
+        {
+          record(1, {integer(static_cast<int64_t>(e) + 1), integer(static_cast<int64_t>(ip)), integer(0), integer(0), text(""), integer(3), integer(3), integer(6), integer(0)});
+          std::vector<uint64_t> stress;
+          for(size_t c = 0; c < 6; c++)
+          {
+            stress.push_back(real(FilStress(step, inc, e, ip, c)));
+          }
+          record(11, stress);
+          record(6, {real(0.5)});
+        }
+      }
+      for(size_t i = 12; i-- > 0;)
+      {
+        record(101, {integer(10 * (static_cast<int64_t>(i) + 1)), real(FilDisplacement(step, inc, i, 0)), real(FilDisplacement(step, inc, i, 1)), real(FilDisplacement(step, inc, i, 2))});
+      }
+      record(2001, {});
+    }
+
+    QByteArray contents;
+    if(blocked)
+    {
+      words.resize((words.size() + 511) / 512 * 512, 0);
+      int32_t marker = 4096;
+      if(swapBytes)
+      {
+        char* bytes = reinterpret_cast<char*>(&marker);
+        std::reverse(bytes, bytes + sizeof(marker));
+      }
+      for(size_t b = 0; b < words.size(); b += 512)
+      {
+        contents.append(reinterpret_cast<const char*>(&marker), sizeof(marker));
+        contents.append(reinterpret_cast<const char*>(words.data() + b), 4096);
+        contents.append(reinterpret_cast<const char*>(&marker), sizeof(marker));
+      }
+    }
+    else
+    {
+      contents.append(reinterpret_cast<const char*>(words.data()), static_cast<int>(words.size() * sizeof(uint64_t)));
+    }
+    contents.chop(static_cast<int>(truncateBytes));
+
+    QFile file(k_FilFile);
+    file.open(QIODevice::WriteOnly);
+    file.write(contents);
+  }
+
+  // -----------------------------------------------------------------------------
+  DataContainerArray::Pointer ReadFilFile(ImportFEAData* filter, int32_t step, int32_t increment)
+  {
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainer::Pointer dc = DataContainer::New("FEAData");
+    dca->addOrReplaceDataContainer(dc);
+    AttributeMatrix::Pointer vertexAttrMat = AttributeMatrix::New(std::vector<size_t>(1, 0), "VertexData", AttributeMatrix::Type::Vertex);
+    dc->addOrReplaceAttributeMatrix(vertexAttrMat);
+    AttributeMatrix::Pointer cellAttrMat = AttributeMatrix::New(std::vector<size_t>(1, 0), "CellData", AttributeMatrix::Type::Cell);
+    dc->addOrReplaceAttributeMatrix(cellAttrMat);
+
+    if(!AbaqusFilReader::read(filter, k_FilFile, step, increment, *dc, *vertexAttrMat, *cellAttrMat))
+    {
+      return DataContainerArray::NullPointer();
+    }
+    return dca;
+  }
+
+  // -----------------------------------------------------------------------------
+  int CheckFilData(DataContainer* dc, int32_t step, int32_t increment)
+  {
+    HexahedralGeom::Pointer hexGeom = dc->getGeometryAs<HexahedralGeom>();
+    DREAM3D_REQUIRE(hexGeom != nullptr)
+    DREAM3D_REQUIRE_EQUAL(hexGeom->getNumberOfVertices(), 12)
+    DREAM3D_REQUIRE_EQUAL(hexGeom->getNumberOfElements(), 2)
+    for(size_t i = 0; i < 12; i++)
+    {
+      float* vertex = hexGeom->getVertexPointer(static_cast<int64_t>(i));
+      DREAM3D_REQUIRE(vertex[0] == 0.5f * i && vertex[1] == 1.0f * i && vertex[2] == 1.5f * i)
+    }
+    std::vector<MeshIndexType> expectedHexes = {0, 1, 4, 3, 6, 7, 10, 9, 1, 2, 5, 4, 7, 8, 11, 10};
+    DREAM3D_REQUIRE(std::equal(expectedHexes.cbegin(), expectedHexes.cend(), hexGeom->getHexPointer(0)))
+
+    AttributeMatrix::Pointer vertexAttrMat = dc->getAttributeMatrix("VertexData");
+    AttributeMatrix::Pointer cellAttrMat = dc->getAttributeMatrix("CellData");
+    DREAM3D_REQUIRE_EQUAL(vertexAttrMat->getNumberOfTuples(), 12)
+    DREAM3D_REQUIRE_EQUAL(cellAttrMat->getNumberOfTuples(), 2)
+    DREAM3D_REQUIRE_EQUAL(cellAttrMat->getNumAttributeArrays(), 1)
+
+    FloatArrayType::Pointer displacement = vertexAttrMat->getAttributeArrayAs<FloatArrayType>("U");
+    DREAM3D_REQUIRE(displacement != nullptr)
+    DREAM3D_REQUIRE(displacement->getComponentDimensions() == std::vector<size_t>{3})
+    for(size_t i = 0; i < 36; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(displacement->getValue(i), FilDisplacement(step, increment, i / 3, i % 3))
+    }
+
+    FloatArrayType::Pointer stress = cellAttrMat->getAttributeArrayAs<FloatArrayType>("S");
+    DREAM3D_REQUIRE(stress != nullptr)
+    DREAM3D_REQUIRE(stress->getComponentDimensions() == std::vector<size_t>{48})
+    for(size_t i = 0; i < 96; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(stress->getValue(i), FilStress(step, increment, i / 48, i % 48 / 6 + 1, i % 6))
+    }
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  int TestAbaqusFilReader()
+  {
+    WriteFilFile(true, false);
+    ImportFEAData::Pointer filter = ImportFEAData::New();
+    DataContainerArray::Pointer dca = ReadFilFile(filter.get(), 1, 0);
+    DREAM3D_REQUIRE(dca != nullptr)
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCode(), 0)
+    DREAM3D_REQUIRE_EQUAL(filter->getWarningCode(), -115)
+    DREAM3D_REQUIRE_EQUAL(CheckFilData(dca->getDataContainer("FEAData").get(), 1, 2), EXIT_SUCCESS)
+
+    filter = ImportFEAData::New();
+    dca = ReadFilFile(filter.get(), 1, 1);
+    DREAM3D_REQUIRE(dca != nullptr)
+    DREAM3D_REQUIRE_EQUAL(CheckFilData(dca->getDataContainer("FEAData").get(), 1, 1), EXIT_SUCCESS)
+
+    // Plain word streams and files written on a machine of the other byte order
+    WriteFilFile(false, true);
+    filter = ImportFEAData::New();
+    dca = ReadFilFile(filter.get(), 2, 0);
+    DREAM3D_REQUIRE(dca != nullptr)
+    DREAM3D_REQUIRE_EQUAL(CheckFilData(dca->getDataContainer("FEAData").get(), 2, 1), EXIT_SUCCESS)
+
+    WriteFilFile(true, true);
+    filter = ImportFEAData::New();
+    dca = ReadFilFile(filter.get(), 1, 2);
+    DREAM3D_REQUIRE(dca != nullptr)
+    DREAM3D_REQUIRE_EQUAL(CheckFilData(dca->getDataContainer("FEAData").get(), 1, 2), EXIT_SUCCESS)
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  int TestAbaqusFilReaderErrors()
+  {
+    WriteFilFile(true, false);
+    ImportFEAData::Pointer filter = ImportFEAData::New();
+    DREAM3D_REQUIRE(ReadFilFile(filter.get(), 3, 0) == nullptr)
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCode(), -114)
+
+    filter = ImportFEAData::New();
+    DREAM3D_REQUIRE(ReadFilFile(filter.get(), 1, 3) == nullptr)
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCode(), -114)
+
+    WriteFilFile(true, false, 100);
+    filter = ImportFEAData::New();
+    DREAM3D_REQUIRE(ReadFilFile(filter.get(), 2, 0) == nullptr)
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCode(), -113)
+
+    WriteFilFile(false, false, 100);
+    filter = ImportFEAData::New();
+    DREAM3D_REQUIRE(ReadFilFile(filter.get(), 2, 0) == nullptr)
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCode(), -113)
+
+    QFile file(k_FilFile);
+    file.open(QIODevice::WriteOnly);
+    file.write("*I  5D  19216A6.14-1A18-Oct-2A026     A12:00:00I 12I 212D 1.00000000000000D+00\n");
+    file.close();
+    filter = ImportFEAData::New();
+    DREAM3D_REQUIRE(ReadFilFile(filter.get(), 1, 0) == nullptr)
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCode(), -113)
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  // The Results File extraction mode reads the .fil file next to the odb without an ABAQUS python command
+  // -----------------------------------------------------------------------------
+  int TestAbaqusFilImport()
+  {
+    WriteFilFile(true, false);
+
+    ImportFEAData::Pointer filter = ImportFEAData::New();
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    filter->setDataContainerArray(dca);
+    filter->setFEAPackage(0);
+    filter->setABQPythonCommand("");
+    filter->setodbName(k_FilOdbName);
+    filter->setodbFilePath(UnitTest::TestTempDir);
+    filter->setABQExtractionMode(3);
+    filter->setABQFilStepNumber(1);
+    filter->setABQFilIncrement(1);
+    filter->setDataContainerName("FEAData");
+    filter->setVertexAttributeMatrixName("VertexData");
+    filter->setCellAttributeMatrixName("CellData");
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCode(), >=, 0)
+    DREAM3D_REQUIRE_EQUAL(CheckFilData(dca->getDataContainer("FEAData").get(), 1, 1), EXIT_SUCCESS)
+
+    filter->setABQFilIncrement(-1);
+    filter->setDataContainerArray(DataContainerArray::New());
+    filter->preflight();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCode(), -4016)
+
+    filter->setodbName(k_FilOdbName + "_missing");
+    filter->setDataContainerArray(DataContainerArray::New());
+    filter->preflight();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCode(), -4015)
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  // Writes a DEFORM point tracking file with two lines per record. The values encode the point and the time step
+  // so any record can be checked without keeping the whole file around.
+  // -----------------------------------------------------------------------------
+  void WritePointTrackFile(const QString& filePath, int32_t numPoints, int32_t numTimeSteps)
+  {
+    QFile file(filePath);
+    file.open(QIODevice::WriteOnly | QIODevice::Text);
+    QTextStream out(&file);
+    out << "******************************************************\n";
+    out << "* DEFORM Point Tracking Data\n";
+    out << "* Each Record contains 2 lines\n";
+    out << "******************************************************\n";
+    out << "Line 1: Point #, Step #, Time, R/X Coord., Z/Y Coord.,\n";
+    out << "        (-) (-) (sec) (mm) (mm)\n";
+    out << "Line 2: Temperature, Eff. Strain\n";
+    out << "        (C) (mm/mm)\n";
+    out << "------------------------------------------------------\n";
+    for(int32_t t = 0; t < numTimeSteps; t++)
+    {
+      for(int32_t p = 1; p <= numPoints; p++)
+      {
+        out << "\n";
+        out << "  " << p << "  " << t * 10 << "  " << t * 0.5 << "  " << p * 0.25 << "  " << t + p * 0.5 << "\n";
+        out << "  " << 300.0 + t + p * 0.001 << "  " << t * 0.01 << "\n";
+      }
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  DataContainerArray::Pointer ReadPointTrackFile(const QString& filePath, bool singleTimeStep, int32_t timeStep)
+  {
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    ImportFEAData::Pointer filter = ImportFEAData::New();
+    filter->setDataContainerArray(dca);
+    filter->setFEAPackage(3);
+    filter->setDEFORMPointTrackInputFile(filePath);
+    filter->setImportSingleTimeStep(singleTimeStep);
+    filter->setSingleTimeStepValue(timeStep);
+    filter->execute();
+    if(filter->getErrorCode() < 0)
+    {
+      return DataContainerArray::NullPointer();
+    }
+    return dca;
+  }
+
+  // -----------------------------------------------------------------------------
+  int CheckPointTrackTimeStep(DataContainerArray* dca, int32_t numPoints, int32_t t)
+  {
+    DataContainer::Pointer dc = dca->getDataContainer(SIMPL::Defaults::DataContainerName + "_" + QString::number(t));
+    DREAM3D_REQUIRE(dc != nullptr)
+    VertexGeom::Pointer vertices = dc->getGeometryAs<VertexGeom>();
+    DREAM3D_REQUIRE(vertices != nullptr)
+    DREAM3D_REQUIRE_EQUAL(vertices->getNumberOfVertices(), static_cast<size_t>(numPoints))
+
+    AttributeMatrix::Pointer attrMat = dc->getAttributeMatrix(SIMPL::Defaults::VertexAttributeMatrixName);
+    FloatArrayType::Pointer temperature = attrMat->getAttributeArrayAs<FloatArrayType>(SimulationIOConstants::DEFORMData::Temperature);
+    DREAM3D_REQUIRE(temperature != nullptr)
+    for(int32_t p = 0; p < numPoints; p++)
+    {
+      DREAM3D_REQUIRE_EQUAL(vertices->getVertexPointer(p)[0], QByteArray::number((p + 1) * 0.25).toFloat())
+      DREAM3D_REQUIRE_EQUAL(vertices->getVertexPointer(p)[1], QByteArray::number(t + (p + 1) * 0.5).toFloat())
+      DREAM3D_REQUIRE_EQUAL(temperature->getValue(p), QByteArray::number(300.0 + t + (p + 1) * 0.001).toFloat())
+    }
+
+    Int32ArrayType::Pointer step = dc->getAttributeMatrix(DataContainerBundle::GetMetaDataName())->getAttributeArrayAs<Int32ArrayType>(SimulationIOConstants::DEFORMData::Step);
+    DREAM3D_REQUIRE(step != nullptr)
+    DREAM3D_REQUIRE_EQUAL(step->getValue(0), t * 10)
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  int TestPointTrackIndex()
+  {
+    const int32_t numPoints = 25;
+    const int32_t numTimeSteps = 12;
+    WritePointTrackFile(k_PointTrackFile, numPoints, numTimeSteps);
+    QFile::remove(DeformPointTrackIndex::sidecarPath(k_PointTrackFile));
+
+    // Reading every time step builds the index and caches it next to the file
+    DataContainerArray::Pointer dca = ReadPointTrackFile(k_PointTrackFile, false, 0);
+    DREAM3D_REQUIRE(dca != nullptr)
+    DREAM3D_REQUIRE(QFile::exists(DeformPointTrackIndex::sidecarPath(k_PointTrackFile)))
+    for(int32_t t = 0; t < numTimeSteps; t++)
+    {
+      DREAM3D_REQUIRE_EQUAL(CheckPointTrackTimeStep(dca.get(), numPoints, t), EXIT_SUCCESS)
+    }
+
+    // A single late time step is read from the cached index without touching the steps before it
+    dca = ReadPointTrackFile(k_PointTrackFile, true, numTimeSteps - 2);
+    DREAM3D_REQUIRE(dca != nullptr)
+    DREAM3D_REQUIRE(dca->getDataContainer(SIMPL::Defaults::DataContainerName + "_0") == nullptr)
+    DREAM3D_REQUIRE_EQUAL(CheckPointTrackTimeStep(dca.get(), numPoints, numTimeSteps - 2), EXIT_SUCCESS)
+
+    // A rewritten file invalidates the cached index
+    WritePointTrackFile(k_PointTrackFile, numPoints, numTimeSteps + 3);
+    dca = ReadPointTrackFile(k_PointTrackFile, true, numTimeSteps + 2);
+    DREAM3D_REQUIRE(dca != nullptr)
+    DREAM3D_REQUIRE_EQUAL(CheckPointTrackTimeStep(dca.get(), numPoints, numTimeSteps + 2), EXIT_SUCCESS)
+
+    DeformPointTrackIndex::Index index;
+    QFile file(k_PointTrackFile);
+    file.open(QIODevice::ReadOnly);
+    QByteArray text = file.readAll();
+    index.dataOffset = text.indexOf("---\n") + 4;
+    index.linesPerBlock = 3;
+    index.pointNumColumn = 0;
+    DREAM3D_REQUIRE(DeformPointTrackIndex::build(std::string_view(text.constData(), text.size()), index))
+    DREAM3D_REQUIRE_EQUAL(index.numPoints, numPoints)
+    DREAM3D_REQUIRE_EQUAL(index.numBlocks, static_cast<qint64>(numPoints) * (numTimeSteps + 3))
+    DREAM3D_REQUIRE_EQUAL(index.timeStepOffsets.size(), static_cast<size_t>(numTimeSteps + 3))
+
+    // A header that does not match the one the cache was built from must not reuse it
+    index.linesPerBlock = 2;
+    DREAM3D_REQUIRE_EQUAL(DeformPointTrackIndex::load(k_PointTrackFile, index), false)
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  int TestPointTrackIndexBenchmark()
+  {
+    const int32_t numPoints = 2000;
+    const int32_t numTimeSteps = 250;
+    WritePointTrackFile(k_BenchmarkPointTrackFile, numPoints, numTimeSteps);
+    QFile::remove(DeformPointTrackIndex::sidecarPath(k_BenchmarkPointTrackFile));
+    double fileSize = static_cast<double>(QFile(k_BenchmarkPointTrackFile).size()) / (1024.0 * 1024.0);
+
+    // Index is built on the first read and loaded from the sidecar on the second
+    for(const char* label : {"building the index", "cached index"})
+    {
+      auto start = std::chrono::steady_clock::now();
+      DataContainerArray::Pointer dca = ReadPointTrackFile(k_BenchmarkPointTrackFile, true, numTimeSteps - 1);
+      std::chrono::duration<double> time = std::chrono::steady_clock::now() - start;
+      DREAM3D_REQUIRE(dca != nullptr)
+      DREAM3D_REQUIRE_EQUAL(CheckPointTrackTimeStep(dca.get(), numPoints, numTimeSteps - 1), EXIT_SUCCESS)
+      std::cout << "Point track (" << fileSize << " MB) last time step, " << label << ": " << time.count() << " s" << std::endl;
+    }
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  // Parses numRecords point track records with the DeformDataParser hierarchy and the column plan and compares them
+  // -----------------------------------------------------------------------------
+  int CompareDeformColumnPlan(size_t numRecords)
+  {
+    const int32_t linesPerBlock = 3;
+    QByteArray text;
+    {
+      QTextStream out(&text);
+      for(size_t p = 1; p <= numRecords; p++)
+      {
+        out << "\n";
+        out << "  " << p << "  " << p % 97 << "  " << p * 0.5 << "  " << p * 0.25 << "  " << p * 1.0e-3 << "\n";
+        out << "  " << 300.0 + p * 0.001 << "  " << p * 0.01 << "\n";
+      }
+    }
+    double fileSize = static_cast<double>(text.size()) / (1024.0 * 1024.0);
+
+    const QStringList names = {SimulationIOConstants::DEFORMData::PointNum,  SimulationIOConstants::DEFORMData::Step,        SimulationIOConstants::DEFORMData::Time,
+                               SimulationIOConstants::DEFORMData::RXCoord,   SimulationIOConstants::DEFORMData::ZYCoord,     SimulationIOConstants::DEFORMData::Temperature,
+                               SimulationIOConstants::DEFORMData::EffStrain};
+
+    // The DeformDataParser hierarchy: a QMap of parsers, a QVector of tokens per record and a virtual call per value
+    QMap<QString, SimulationIO::DeformDataParser::Pointer> parsers;
+    for(int32_t c = 0; c < names.size(); c++)
+    {
+      if(c < 2)
+      {
+        parsers.insert(names[c], SimulationIO::Int32Parser::New(Int32ArrayType::CreateArray(numRecords, names[c], true), names[c], c));
+      }
+      else
+      {
+        parsers.insert(names[c], SimulationIO::FloatParser::New(FloatArrayType::CreateArray(numRecords, names[c], true), names[c], c));
+      }
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    {
+      QBuffer buffer(&text);
+      buffer.open(QIODevice::ReadOnly);
+      for(size_t p = 0; p < numRecords; p++)
+      {
+        QVector<QByteArray> tokens;
+        buffer.readLine();
+        for(int32_t l = 0; l < linesPerBlock - 1; ++l)
+        {
+          QList<QByteArray> lineTokens = buffer.readLine().trimmed().simplified().split(' ');
+          for(const auto& token : lineTokens)
+          {
+            tokens.push_back(token);
+          }
+        }
+        QMapIterator<QString, SimulationIO::DeformDataParser::Pointer> parserIter(parsers);
+        while(parserIter.hasNext())
+        {
+          parserIter.next();
+          parserIter.value()->parse(tokens.at(parserIter.value()->getColumnIndex()), p);
+        }
+      }
+    }
+    std::chrono::duration<double> parserTime = std::chrono::steady_clock::now() - start;
+    std::cout << "Point track records (" << fileSize << " MB) DeformDataParser: " << parserTime.count() << " s" << std::endl;
+
+    // The compiled column plan
+    SimulationIO::DeformColumnPlan plan;
+    AttributeMatrix::Pointer attrMat = AttributeMatrix::New(std::vector<size_t>(1, numRecords), "VertexData", AttributeMatrix::Type::Vertex);
+    for(int32_t c = 0; c < names.size(); c++)
+    {
+      plan.addColumn(c, c < 2 ? SimulationIO::DeformColumnPlan::Conversion::Int32 : SimulationIO::DeformColumnPlan::Conversion::Float, names[c]);
+    }
+    for(const auto& column : plan.columns())
+    {
+      attrMat->insertOrAssign(SimulationIO::DeformColumnPlan::createArray(column, numRecords, true));
+    }
+    DREAM3D_REQUIRE(plan.bind(*attrMat, numRecords))
+
+    start = std::chrono::steady_clock::now();
+    MappedTextReader::LineReader reader(std::string_view(text.constData(), static_cast<size_t>(text.size())));
+    for(size_t p = 0; p < numRecords; p++)
+    {
+      reader.readLine();
+      DREAM3D_REQUIRE(plan.parseRecord(reader, linesPerBlock - 1, p))
+    }
+    std::chrono::duration<double> planTime = std::chrono::steady_clock::now() - start;
+    std::cout << "Point track records (" << fileSize << " MB) column plan: " << planTime.count() << " s, speedup " << parserTime.count() / planTime.count() << "x" << std::endl;
+
+    for(int32_t c = 0; c < names.size(); c++)
+    {
+      IDataArray::Pointer expected = parsers[names[c]]->getDataArray();
+      if(c < 2)
+      {
+        Int32ArrayType::Pointer expectedValues = std::dynamic_pointer_cast<Int32ArrayType>(expected);
+        Int32ArrayType::Pointer values = attrMat->getAttributeArrayAs<Int32ArrayType>(names[c]);
+        DREAM3D_REQUIRE(std::equal(expectedValues->begin(), expectedValues->end(), values->begin()))
+      }
+      else
+      {
+        FloatArrayType::Pointer expectedValues = std::dynamic_pointer_cast<FloatArrayType>(expected);
+        FloatArrayType::Pointer values = attrMat->getAttributeArrayAs<FloatArrayType>(names[c]);
+        DREAM3D_REQUIRE(std::equal(expectedValues->begin(), expectedValues->end(), values->begin()))
+      }
+    }
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  int TestDeformColumnPlan()
+  {
+    return CompareDeformColumnPlan(2000);
+  }
+
+  // -----------------------------------------------------------------------------
+  int TestDeformColumnPlanBenchmark()
+  {
+    return CompareDeformColumnPlan(200000);
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -98,6 +1554,25 @@ public:
     DREAM3D_REGISTER_TEST(TestFilterAvailability());
 
     DREAM3D_REGISTER_TEST(TestImportFEADataTest())
+    DREAM3D_REGISTER_TEST(TestAbaqusDatReader())
+    DREAM3D_REGISTER_TEST(TestAbaqusDatReaderErrors())
+    DREAM3D_REGISTER_TEST(TestAbaqusDatStreamParser())
+    DREAM3D_REGISTER_TEST(TestAbaqusBulkDataReader())
+    DREAM3D_REGISTER_TEST(TestAbaqusBulkDataReaderFrames())
+    DREAM3D_REGISTER_TEST(TestAbaqusFrameRangePreflight())
+    DREAM3D_REGISTER_TEST(TestAbaqusResultCache())
+    DREAM3D_REGISTER_TEST(TestAbaqusResultCacheHit())
+    DREAM3D_REGISTER_TEST(TestAbaqusBulkDataReaderErrors())
+    DREAM3D_REGISTER_TEST(TestAbaqusFilReader())
+    DREAM3D_REGISTER_TEST(TestAbaqusFilReaderErrors())
+    DREAM3D_REGISTER_TEST(TestAbaqusFilImport())
+    DREAM3D_REGISTER_TEST(TestPointTrackIndex())
+    DREAM3D_REGISTER_TEST(TestDeformColumnPlan())
+#ifdef SimulationIO_ENABLE_BENCHMARKS
+    DREAM3D_REGISTER_TEST(TestAbaqusDatReaderBenchmark())
+    DREAM3D_REGISTER_TEST(TestPointTrackIndexBenchmark())
+    DREAM3D_REGISTER_TEST(TestDeformColumnPlanBenchmark())
+#endif
 
     DREAM3D_REGISTER_TEST(RemoveTestFiles())
   }
@@ -0,0 +1,51 @@
+// -----------------------------------------------------------------------------
+// Insert your license & copyright information here
+// -----------------------------------------------------------------------------
+#pragma once
+
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <QtCore/QString>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
+#include "SIMPLib/DataContainers/DataContainer.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/Geometry/ImageGeom.h"
+
+namespace SimulationIOTestHelpers
+{
+// -----------------------------------------------------------------------------
+// Adds a Data Container with an image geometry and an empty Cell Attribute Matrix
+// sized to it. The caller fills in the cell arrays its filter needs.
+// -----------------------------------------------------------------------------
+inline AttributeMatrix::Pointer CreateImageDataContainer(const DataContainerArray::Pointer& dca, const QString& dcName, const QString& cellAMName, const SizeVec3Type& dims,
+                                                         const FloatVec3Type& spacing, const FloatVec3Type& origin)
+{
+  DataContainer::Pointer dc = DataContainer::New(dcName);
+  dca->addOrReplaceDataContainer(dc);
+
+  ImageGeom::Pointer imageGeom = ImageGeom::CreateGeometry(SIMPL::Geometry::ImageGeometry);
+  imageGeom->setDimensions(dims);
+  imageGeom->setSpacing(spacing);
+  imageGeom->setOrigin(origin);
+  dc->setGeometry(imageGeom);
+
+  std::vector<size_t> tDims = {dims[0], dims[1], dims[2]};
+  AttributeMatrix::Pointer cellAM = AttributeMatrix::New(tDims, cellAMName, AttributeMatrix::Type::Cell);
+  dc->addOrReplaceAttributeMatrix(cellAM);
+  return cellAM;
+}
+
+// -----------------------------------------------------------------------------
+inline std::string ReadFile(const QString& filePath)
+{
+  std::ifstream inFile(filePath.toStdString(), std::ios_base::in | std::ios_base::binary);
+  std::stringstream ss;
+  ss << inFile.rdbuf();
+  return ss.str();
+}
+} // namespace SimulationIOTestHelpers